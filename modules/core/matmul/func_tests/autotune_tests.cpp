@@ -0,0 +1,97 @@
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <string>
+
+#include "core/matmul/include/autotune.hpp"
+
+namespace {
+
+class ScopedTempDir {
+ public:
+  ScopedTempDir()
+      : path_(std::filesystem::temp_directory_path() /
+              ("ppc_autotune_test_" + std::to_string(std::random_device{}()))) {}
+  ScopedTempDir(const ScopedTempDir&) = delete;
+  ScopedTempDir& operator=(const ScopedTempDir&) = delete;
+  ~ScopedTempDir() {
+    std::error_code error;
+    std::filesystem::remove_all(path_, error);
+  }
+
+  [[nodiscard]] const std::filesystem::path& Path() const { return path_; }
+
+ private:
+  std::filesystem::path path_;
+};
+
+}  // namespace
+
+TEST(autotune_tests, measured_blocks_fit_their_cache_level) {
+  const ppc::matmul::CacheSizes caches{.l1 = size_t{4} << 10, .l2 = size_t{16} << 10, .l3 = size_t{64} << 10};
+  const auto sizes = ppc::matmul::MeasureBlockSizes(caches);
+  for (auto [block, bytes] : {std::pair{sizes.l1, caches.l1}, {sizes.l2, caches.l2}, {sizes.l3, caches.l3}}) {
+    EXPECT_EQ(block % ppc::matmul::kBlockGranularity, 0U);
+    EXPECT_LE(3 * block * block * sizeof(double), bytes);
+  }
+  EXPECT_LE(sizes.l1, sizes.l2);
+  EXPECT_LE(sizes.l2, sizes.l3);
+  EXPECT_EQ(sizes.gemm % ppc::matmul::kBlockGranularity, 0U);
+  EXPECT_GT(sizes.gemm, 0U);
+  EXPECT_LE(sizes.gemm, ppc::matmul::kMaxTunedBlock);
+}
+
+TEST(autotune_tests, stored_sizes_are_read_back_for_the_same_cpu_only) {
+  const ScopedTempDir dir;
+  const ppc::matmul::BlockSizes sizes{.l1 = 24, .l2 = 96, .l3 = 256, .gemm = 128};
+  ASSERT_TRUE(ppc::matmul::StoreBlockSizes(dir.Path(), "cpu a", sizes));
+
+  const auto loaded = ppc::matmul::LoadBlockSizes(dir.Path(), "cpu a");
+  ASSERT_TRUE(loaded.has_value());
+  EXPECT_EQ(loaded->l1, sizes.l1);
+  EXPECT_EQ(loaded->l2, sizes.l2);
+  EXPECT_EQ(loaded->l3, sizes.l3);
+  EXPECT_EQ(loaded->gemm, sizes.gemm);
+  EXPECT_FALSE(ppc::matmul::LoadBlockSizes(dir.Path(), "cpu b").has_value());
+}
+
+TEST(autotune_tests, stored_sizes_without_a_gemm_tile_are_measured_again) {
+  const ScopedTempDir dir;
+  const ppc::matmul::BlockSizes sizes{.l1 = 8, .l2 = 16, .l3 = 32, .gemm = 64};
+  ASSERT_TRUE(ppc::matmul::StoreBlockSizes(dir.Path(), "cpu a", sizes));
+  // Rewrite the file in the format from before the gemm tile was tuned
+  for (const auto& entry : std::filesystem::directory_iterator(dir.Path())) {
+    std::ofstream(entry.path()) << "cpu a\n8 16 32\n";
+  }
+  EXPECT_FALSE(ppc::matmul::LoadBlockSizes(dir.Path(), "cpu a").has_value());
+}
+
+TEST(autotune_tests, stored_sizes_skip_the_measurement) {
+  const ScopedTempDir dir;
+  const ppc::matmul::BlockSizes sizes{.l1 = 8, .l2 = 16, .l3 = 32, .gemm = 64};
+  ASSERT_TRUE(ppc::matmul::StoreBlockSizes(dir.Path(), ppc::matmul::CpuSignature(), sizes));
+
+  const auto loaded = ppc::matmul::LoadOrMeasureBlockSizes(dir.Path());
+  EXPECT_EQ(loaded.l1, sizes.l1);
+  EXPECT_EQ(loaded.l2, sizes.l2);
+  EXPECT_EQ(loaded.l3, sizes.l3);
+  EXPECT_EQ(loaded.gemm, sizes.gemm);
+}
+
+TEST(autotune_tests, detects_nonzero_cache_sizes) {
+  const auto caches = ppc::matmul::DetectCacheSizes();
+  EXPECT_GT(caches.l1, 0U);
+  EXPECT_GT(caches.l2, 0U);
+  EXPECT_GT(caches.l3, 0U);
+}
+
+TEST(autotune_tests, parallel_block_leaves_a_block_row_per_thread) {
+  EXPECT_EQ(ppc::matmul::ParallelBlock(128, 500, 4), 125U);
+  EXPECT_EQ(ppc::matmul::ParallelBlock(128, 2048, 4), 128U);
+  EXPECT_EQ(ppc::matmul::ParallelBlock(128, 100, 8), 13U);
+  EXPECT_EQ(ppc::matmul::ParallelBlock(128, 3, 8), 1U);
+  EXPECT_EQ(ppc::matmul::ParallelBlock(128, 64, 0), 64U);
+}
@@ -0,0 +1,140 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "core/matmul/include/gemm.hpp"
+
+namespace {
+
+std::vector<double> RandomMatrix(size_t rows, size_t cols, uint64_t seed) {
+  std::mt19937_64 gen(seed);
+  std::uniform_real_distribution<double> dist(-1.0, 1.0);
+  std::vector<double> matrix(rows * cols);
+  std::ranges::generate(matrix, [&] { return dist(gen); });
+  return matrix;
+}
+
+// C = A * B by the definition, for row-major matrices with the given leading dimensions
+std::vector<double> NaiveProduct(size_t m, size_t n, size_t k, const std::vector<double>& a, size_t lda,
+                                 const std::vector<double>& b, size_t ldb) {
+  std::vector<double> c(m * n, 0.0);
+  for (size_t i = 0; i < m; ++i) {
+    for (size_t p = 0; p < k; ++p) {
+      for (size_t j = 0; j < n; ++j) {
+        c[(i * n) + j] += a[(i * lda) + p] * b[(p * ldb) + j];
+      }
+    }
+  }
+  return c;
+}
+
+void ExpectNear(const std::vector<double>& actual, const std::vector<double>& expected) {
+  ASSERT_EQ(actual.size(), expected.size());
+  for (size_t i = 0; i < actual.size(); ++i) {
+    EXPECT_NEAR(actual[i], expected[i], 1e-9) << "at " << i;
+  }
+}
+
+void ExpectGemmMatchesNaive(size_t m, size_t n, size_t k) {
+  const auto a = RandomMatrix(m, k, m);
+  const auto b = RandomMatrix(k, n, n);
+  std::vector<double> c(m * n, 42.0);
+  ppc::matmul::Gemm(m, n, k, a.data(), k, b.data(), n, c.data(), n);
+  ExpectNear(c, NaiveProduct(m, n, k, a, k, b, n));
+}
+
+}  // namespace
+
+TEST(gemm_tests, matches_naive_product_on_tile_multiples) { ExpectGemmMatchesNaive(64, 64, 64); }
+
+TEST(gemm_tests, matches_naive_product_on_ragged_shapes) {
+  ExpectGemmMatchesNaive(1, 1, 1);
+  ExpectGemmMatchesNaive(3, 5, 7);
+  ExpectGemmMatchesNaive(131, 67, 300);
+  ExpectGemmMatchesNaive(17, 2100, 9);
+}
+
+TEST(gemm_tests, works_on_strided_submatrices_and_accumulates) {
+  constexpr size_t kLd = 50;
+  const auto a = RandomMatrix(kLd, kLd, 1);
+  const auto b = RandomMatrix(kLd, kLd, 2);
+  // Top-right 20 x 30 block of A times bottom-left 30 x 25 block of B, added to a block of C
+  std::vector<double> c(kLd * kLd, 1.0);
+  ppc::matmul::Gemm(20, 25, 30, a.data() + 20, kLd, b.data() + (20 * kLd), kLd, c.data() + (kLd + 1), kLd, true);
+
+  const std::vector<double> a_block(a.begin() + 20, a.end());
+  const std::vector<double> b_block(b.begin() + (20 * kLd), b.end());
+  const auto product = NaiveProduct(20, 25, 30, a_block, kLd, b_block, kLd);
+  for (size_t i = 0; i < kLd; ++i) {
+    for (size_t j = 0; j < kLd; ++j) {
+      const bool inside = i >= 1 && i < 21 && j >= 1 && j < 26;
+      const double expected = 1.0 + (inside ? product[((i - 1) * 25) + (j - 1)] : 0.0);
+      EXPECT_NEAR(c[(i * kLd) + j], expected, 1e-9);
+    }
+  }
+}
+
+TEST(gemm_tests, empty_inner_dimension_clears_output) {
+  std::vector<double> c(6, 3.0);
+  ppc::matmul::Gemm<double>(2, 3, 0, nullptr, 0, nullptr, 3, c.data(), 3);
+  EXPECT_EQ(c, std::vector<double>(6, 0.0));
+}
+
+TEST(gemm_tests, float_matches_double_product) {
+  constexpr size_t kM = 67;
+  constexpr size_t kN = 45;
+  constexpr size_t kK = 300;
+  const auto a = RandomMatrix(kM, kK, 5);
+  const auto b = RandomMatrix(kK, kN, 6);
+  const std::vector<float> a_float(a.begin(), a.end());
+  const std::vector<float> b_float(b.begin(), b.end());
+  std::vector<float> c(kM * kN);
+  ppc::matmul::Gemm(kM, kN, kK, a_float.data(), kK, b_float.data(), kN, c.data(), kN);
+  const auto expected = NaiveProduct(kM, kN, kK, a, kK, b, kN);
+  for (size_t i = 0; i < c.size(); ++i) {
+    EXPECT_NEAR(c[i], expected[i], 1e-4) << "at " << i;
+  }
+}
+
+TEST(gemm_tests, float_inputs_accumulate_in_double) {
+  constexpr size_t kN = 40;
+  constexpr size_t kK = 4000;
+  // Products of these are exact in float, so only the accumulation can round: a float sum of 4000 terms
+  // near 1 loses the last bits, a double sum does not
+  std::vector<float> a(kN * kK);
+  std::vector<float> b(kK * kN);
+  for (size_t i = 0; i < a.size(); ++i) {
+    a[i] = 1.0F + (static_cast<float>(i % 7) / 1024.0F);
+    b[i] = 1.0F - (static_cast<float>(i % 5) / 2048.0F);
+  }
+  std::vector<double> c(kN * kN);
+  ppc::matmul::Gemm<float, double>(kN, kN, kK, a.data(), kK, b.data(), kN, c.data(), kN);
+  for (size_t i = 0; i < kN; ++i) {
+    for (size_t j = 0; j < kN; ++j) {
+      double expected = 0.0;
+      for (size_t p = 0; p < kK; ++p) {
+        expected += static_cast<double>(a[(i * kK) + p]) * static_cast<double>(b[(p * kN) + j]);
+      }
+      EXPECT_DOUBLE_EQ(c[(i * kN) + j], expected);
+    }
+  }
+}
+
+TEST(gemm_tests, strassen_level_matches_gemm) {
+  constexpr size_t kN = 96;
+  const auto a = RandomMatrix(kN, kN, 3);
+  const auto b = RandomMatrix(kN, kN, 4);
+  std::vector<double> c(kN * kN);
+  ppc::matmul::detail::StrassenLevel(kN, a.data(), b.data(), c.data());
+  ExpectNear(c, ppc::matmul::Multiply(a, b, kN));
+}
+
+TEST(gemm_tests, strassen_cutoff_is_a_candidate_and_stable) {
+  const size_t cutoff = ppc::matmul::StrassenCutoff();
+  EXPECT_GE(cutoff, ppc::matmul::kStrassenCutoffCandidates.front());
+  EXPECT_EQ(ppc::matmul::StrassenCutoff(), cutoff);
+}
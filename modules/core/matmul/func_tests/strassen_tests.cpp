@@ -0,0 +1,127 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <span>
+#include <vector>
+
+#include "core/matmul/include/gemm.hpp"
+#include "core/matmul/include/strassen.hpp"
+#include "core/util/include/fork_join.hpp"
+
+namespace {
+
+std::vector<double> RandomMatrix(size_t rows, size_t cols, uint64_t seed) {
+  std::mt19937_64 gen(seed);
+  std::uniform_real_distribution<double> dist(-1.0, 1.0);
+  std::vector<double> matrix(rows * cols);
+  std::ranges::generate(matrix, [&] { return dist(gen); });
+  return matrix;
+}
+
+void ExpectStrassenMatchesGemm(size_t m, size_t n, size_t k, size_t cutoff) {
+  const auto a = RandomMatrix(m, k, (m * 7) + k);
+  const auto b = RandomMatrix(k, n, (n * 5) + k);
+  std::vector<double> expected(m * n);
+  ppc::matmul::Gemm(m, n, k, a.data(), k, b.data(), n, expected.data(), n);
+
+  // Exactly the advertised workspace, so an overrun is caught by the sanitizers
+  std::vector<double> workspace(ppc::matmul::StrassenWorkspaceSize(m, n, k, cutoff));
+  std::vector<double> c(m * n, 42.0);
+  ppc::matmul::Strassen(m, n, k, a.data(), k, b.data(), n, c.data(), n, workspace, cutoff);
+  for (size_t i = 0; i < c.size(); ++i) {
+    ASSERT_NEAR(c[i], expected[i], 1e-9) << m << "x" << n << "x" << k << " at " << i;
+  }
+}
+
+void ExpectParallelStrassenMatchesGemm(size_t m, size_t n, size_t k, size_t depth, size_t cutoff) {
+  const auto a = RandomMatrix(m, k, m + k);
+  const auto b = RandomMatrix(k, n, n + k);
+  std::vector<double> expected(m * n);
+  ppc::matmul::Gemm(m, n, k, a.data(), k, b.data(), n, expected.data(), n);
+
+  std::vector<double> workspace(ppc::matmul::ParallelStrassenWorkspaceSize(m, n, k, depth, cutoff));
+  std::vector<double> c(m * n, 42.0);
+  auto fork_join = [](size_t count, const auto& func) { ppc::util::ThreadForkJoin(count, func); };
+  ppc::matmul::ParallelStrassen(m, n, k, a.data(), k, b.data(), n, c.data(), n, workspace, depth, fork_join, cutoff);
+  for (size_t i = 0; i < c.size(); ++i) {
+    ASSERT_NEAR(c[i], expected[i], 1e-9) << m << "x" << n << "x" << k << " at " << i;
+  }
+}
+
+}  // namespace
+
+TEST(strassen_tests, matches_gemm_on_powers_of_two) {
+  ExpectStrassenMatchesGemm(64, 64, 64, 8);
+  ExpectStrassenMatchesGemm(128, 128, 128, 16);
+}
+
+TEST(strassen_tests, peels_odd_sizes_at_every_level) {
+  for (size_t n : {1, 2, 3, 5, 17, 33, 63, 65, 129}) {
+    ExpectStrassenMatchesGemm(n, n, n, 4);
+  }
+}
+
+TEST(strassen_tests, handles_rectangular_operands) {
+  ExpectStrassenMatchesGemm(37, 50, 23, 4);
+  ExpectStrassenMatchesGemm(100, 9, 64, 4);
+  ExpectStrassenMatchesGemm(9, 100, 65, 4);
+}
+
+TEST(strassen_tests, works_on_strided_views) {
+  constexpr size_t kLd = 80;
+  constexpr size_t kN = 45;
+  const auto a = RandomMatrix(kLd, kLd, 1);
+  const auto b = RandomMatrix(kLd, kLd, 2);
+  std::vector<double> c(kLd * kLd, 7.0);
+  std::vector<double> expected = c;
+  const double* a_view = a.data() + (3 * kLd) + 10;
+  const double* b_view = b.data() + (20 * kLd) + 1;
+  ppc::matmul::Gemm(kN, kN, kN, a_view, kLd, b_view, kLd, expected.data() + kLd + 2, kLd);
+
+  std::vector<double> workspace(ppc::matmul::StrassenWorkspaceSize(kN, kN, kN, 4));
+  ppc::matmul::Strassen(kN, kN, kN, a_view, kLd, b_view, kLd, c.data() + kLd + 2, kLd, workspace, 4);
+  for (size_t i = 0; i < c.size(); ++i) {
+    ASSERT_NEAR(c[i], expected[i], 1e-9) << "at " << i;
+  }
+}
+
+TEST(strassen_tests, runs_in_float) {
+  constexpr size_t kN = 77;
+  const auto a = RandomMatrix(kN, kN, 3);
+  const auto b = RandomMatrix(kN, kN, 4);
+  std::vector<double> expected(kN * kN);
+  ppc::matmul::Gemm(kN, kN, kN, a.data(), kN, b.data(), kN, expected.data(), kN);
+
+  const std::vector<float> a_float(a.begin(), a.end());
+  const std::vector<float> b_float(b.begin(), b.end());
+  std::vector<float> workspace(ppc::matmul::StrassenWorkspaceSize(kN, kN, kN, 8));
+  std::vector<float> c(kN * kN);
+  ppc::matmul::Strassen(kN, kN, kN, a_float.data(), kN, b_float.data(), kN, c.data(), kN, workspace, 8);
+  for (size_t i = 0; i < c.size(); ++i) {
+    ASSERT_NEAR(c[i], expected[i], 1e-4) << "at " << i;
+  }
+}
+
+TEST(strassen_tests, workspace_is_quadratic) {
+  constexpr size_t kN = 1024;
+  EXPECT_EQ(ppc::matmul::StrassenWorkspaceSize(kN, kN, kN, kN), 0U);
+  EXPECT_LE(ppc::matmul::StrassenWorkspaceSize(kN, kN, kN, 1), kN * kN);
+}
+
+TEST(strassen_tests, parallel_levels_match_gemm) {
+  ExpectParallelStrassenMatchesGemm(128, 128, 128, 2, 8);
+  ExpectParallelStrassenMatchesGemm(97, 97, 97, 2, 4);
+  ExpectParallelStrassenMatchesGemm(70, 41, 55, 3, 4);
+  ExpectParallelStrassenMatchesGemm(5, 5, 5, 1, 8);
+}
+
+TEST(strassen_tests, task_depth_reaches_thread_count) {
+  EXPECT_EQ(ppc::matmul::StrassenTaskDepth(4096, 7, 4, 64), 0U);
+  EXPECT_EQ(ppc::matmul::StrassenTaskDepth(4096, 1, 7, 64), 1U);
+  EXPECT_EQ(ppc::matmul::StrassenTaskDepth(4096, 7, 64, 64), 2U);
+  // Never splits below the cutoff
+  EXPECT_EQ(ppc::matmul::StrassenTaskDepth(100, 1, 1000, 64), 1U);
+}
@@ -0,0 +1,33 @@
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <numeric>
+#include <vector>
+
+#include "core/matmul/include/tiled.hpp"
+
+TEST(tiled_tests, round_trips_through_ragged_tiles) {
+  constexpr size_t kN = 10;
+  std::vector<double> matrix(kN * kN);
+  std::iota(matrix.begin(), matrix.end(), 0.0);
+
+  const auto tiled = ppc::matmul::TiledMatrix::FromRowMajor(matrix.data(), kN, 4);
+  EXPECT_EQ(tiled.TilesPerSide(), 3U);
+  std::vector<double> back(kN * kN, -1.0);
+  tiled.ToRowMajor(back.data());
+  EXPECT_EQ(back, matrix);
+}
+
+TEST(tiled_tests, tiles_are_contiguous_and_zero_padded) {
+  constexpr size_t kN = 5;
+  std::vector<double> matrix(kN * kN);
+  std::iota(matrix.begin(), matrix.end(), 1.0);
+
+  const auto tiled = ppc::matmul::TiledMatrix::FromRowMajor(matrix.data(), kN, 3);
+  // Tile (0, 1) holds columns 3..4 of rows 0..2 and a zero third column
+  const double* tile = tiled.Tile(0, 1);
+  EXPECT_EQ(std::vector<double>(tile, tile + 9), (std::vector<double>{4, 5, 0, 9, 10, 0, 14, 15, 0}));
+  // Tile (1, 1) only has the bottom-right 2 x 2 corner
+  tile = tiled.Tile(1, 1);
+  EXPECT_EQ(std::vector<double>(tile, tile + 9), (std::vector<double>{19, 20, 0, 24, 25, 0, 0, 0, 0}));
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <filesystem>
+#include <optional>
+#include <string>
+
+namespace ppc::matmul {
+
+// Data cache capacities in bytes
+struct CacheSizes {
+  size_t l1 = 0;
+  size_t l2 = 0;
+  size_t l3 = 0;
+};
+
+// Square block edges (in elements) for blocked matrix multiplication. l1, l2 and l3 are for blocks multiplied by
+// plain loops: three blocks of edge l1 fit the L1 cache, three of edge l2 the L2 cache and so on, and Fox/Cannon-style
+// tasks with a single block size should use l2. gemm is for tiles handed to Gemm(), which packs and blocks for the
+// caches itself, so it is timed on Gemm() rather than derived from a cache size.
+struct BlockSizes {
+  size_t l1 = 0;
+  size_t l2 = 0;
+  size_t l3 = 0;
+  size_t gemm = 0;
+};
+
+// Block edges are multiples of this (one cache line of doubles) and never exceed kMaxTunedBlock
+constexpr size_t kBlockGranularity = 8;
+constexpr size_t kMaxTunedBlock = 256;
+
+// Cache sizes reported by the OS; levels it does not report get typical values (32 KiB, 1 MiB, 8 MiB)
+CacheSizes DetectCacheSizes();
+
+// Identifies the CPU a tuning result belongs to: model name, logical core count and cache sizes
+std::string CpuSignature();
+
+// Times a blocked multiply for a few block edges around the largest one that fits each cache level and keeps the
+// fastest of each level, then times Gemm() on a few tile edges for gemm. Takes a fraction of a second
+BlockSizes MeasureBlockSizes(const CacheSizes& caches);
+
+// Reads the result stored for signature in dir
+std::optional<BlockSizes> LoadBlockSizes(const std::filesystem::path& dir, const std::string& signature);
+// Stores the result for signature in dir; returns false if the directory is not writable
+bool StoreBlockSizes(const std::filesystem::path& dir, const std::string& signature, const BlockSizes& sizes);
+
+// The stored result for this CPU, measured and stored first if there is none yet
+BlockSizes LoadOrMeasureBlockSizes(const std::filesystem::path& dir);
+
+// Directory of the tuning cache: the PPC_TUNE_CACHE_DIR environment variable, or ppc_tune in the temp directory
+std::filesystem::path TuneCacheDir();
+
+// Tuned block sizes for this CPU, measured at most once per machine and once per process
+BlockSizes TunedBlockSizes();
+
+// Block edge for an n x n matrix whose block rows are shared by threads: block, shrunk so that n has at least one
+// block row per thread
+inline size_t ParallelBlock(size_t block, size_t n, size_t threads) {
+  const size_t per_thread = (n + std::max<size_t>(threads, 1) - 1) / std::max<size_t>(threads, 1);
+  return std::max<size_t>(std::min(block, per_thread), 1);
+}
+
+}  // namespace ppc::matmul
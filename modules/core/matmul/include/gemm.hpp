@@ -0,0 +1,247 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <vector>
+
+namespace ppc::matmul {
+
+// Register tile of the micro-kernel: kMr rows of A times kNr columns of B. A float tile fills half the vector
+// registers of a double one, so each instruction of the float kernel handles twice the elements.
+constexpr size_t kMr = 4;
+constexpr size_t kNr = 8;
+// Cache blocking: a kMc x kKc block of A stays in L2, a kKc x kNr sliver of B in L1
+constexpr size_t kMc = 128;
+constexpr size_t kKc = 256;
+constexpr size_t kNc = 2048;
+
+// Candidate Strassen cutoffs tried by StrassenCutoff(), in ascending order
+constexpr std::array<size_t, 4> kStrassenCutoffCandidates{32, 64, 128, 256};
+
+namespace detail {
+
+// Copies the mc x kc block of A into kMr-row panels, each stored column by column and padded with zeros
+template <typename T>
+void PackA(size_t mc, size_t kc, const T* a, size_t lda, T* packed) {
+  for (size_t i = 0; i < mc; i += kMr) {
+    const size_t rows = std::min(kMr, mc - i);
+    for (size_t p = 0; p < kc; ++p) {
+      for (size_t r = 0; r < kMr; ++r) {
+        *packed++ = r < rows ? a[((i + r) * lda) + p] : T{};
+      }
+    }
+  }
+}
+
+// Copies the kc x nc block of B into kNr-column panels, each stored row by row and padded with zeros
+template <typename T>
+void PackB(size_t kc, size_t nc, const T* b, size_t ldb, T* packed) {
+  for (size_t j = 0; j < nc; j += kNr) {
+    const size_t cols = std::min(kNr, nc - j);
+    for (size_t p = 0; p < kc; ++p) {
+      const T* row = b + (p * ldb) + j;
+      for (size_t c = 0; c < kNr; ++c) {
+        *packed++ = c < cols ? row[c] : T{};
+      }
+    }
+  }
+}
+
+// C[rows x cols] (+)= packed A panel * packed B panel; the accumulators are sized to stay in registers.
+// Products are formed in T and summed in Acc, so float inputs may accumulate in double.
+template <typename T, typename Acc>
+void MicroKernel(size_t kc, const T* a, const T* b, Acc* c, size_t ldc, size_t rows, size_t cols, bool overwrite) {
+  std::array<std::array<Acc, kNr>, kMr> acc{};
+  for (size_t p = 0; p < kc; ++p) {
+    for (size_t r = 0; r < kMr; ++r) {
+      const T a_value = a[r];
+      for (size_t col = 0; col < kNr; ++col) {
+        acc[r][col] += static_cast<Acc>(a_value * b[col]);
+      }
+    }
+    a += kMr;
+    b += kNr;
+  }
+  for (size_t r = 0; r < rows; ++r) {
+    Acc* c_row = c + (r * ldc);
+    for (size_t col = 0; col < cols; ++col) {
+      c_row[col] = overwrite ? acc[r][col] : c_row[col] + acc[r][col];
+    }
+  }
+}
+
+}  // namespace detail
+
+// C (+)= A * B for row-major A (m x k, leading dimension lda), B (k x n, ldb) and C (m x n, ldc).
+// C is overwritten unless accumulate is set. Safe to call from several threads at once.
+// With Acc wider than T (Gemm<float, double>) the products are computed in T but summed and stored in Acc: A and B
+// take half the memory and cache of double, while the rounding error no longer grows with k.
+template <typename T, typename Acc = T>
+void Gemm(size_t m, size_t n, size_t k, const T* a, size_t lda, const T* b, size_t ldb, Acc* c, size_t ldc,
+          bool accumulate = false) {
+  if (m == 0 || n == 0) {
+    return;
+  }
+  if (k == 0) {
+    if (!accumulate) {
+      for (size_t i = 0; i < m; ++i) {
+        std::fill(c + (i * ldc), c + (i * ldc) + n, Acc{});
+      }
+    }
+    return;
+  }
+
+  thread_local std::vector<T> packed_a;
+  thread_local std::vector<T> packed_b;
+  packed_a.resize(((std::min(m, kMc) + kMr - 1) / kMr) * kMr * std::min(k, kKc));
+  packed_b.resize(((std::min(n, kNc) + kNr - 1) / kNr) * kNr * std::min(k, kKc));
+
+  for (size_t jc = 0; jc < n; jc += kNc) {
+    const size_t nc = std::min(kNc, n - jc);
+    for (size_t pc = 0; pc < k; pc += kKc) {
+      const size_t kc = std::min(kKc, k - pc);
+      const bool overwrite = pc == 0 && !accumulate;
+      detail::PackB(kc, nc, b + (pc * ldb) + jc, ldb, packed_b.data());
+      for (size_t ic = 0; ic < m; ic += kMc) {
+        const size_t mc = std::min(kMc, m - ic);
+        detail::PackA(mc, kc, a + (ic * lda) + pc, lda, packed_a.data());
+        for (size_t jr = 0; jr < nc; jr += kNr) {
+          const T* b_panel = packed_b.data() + (jr * kc);
+          for (size_t ir = 0; ir < mc; ir += kMr) {
+            detail::MicroKernel(kc, packed_a.data() + (ir * kc), b_panel, c + ((ic + ir) * ldc) + jc + jr, ldc,
+                                std::min(kMr, mc - ir), std::min(kNr, nc - jr), overwrite);
+          }
+        }
+      }
+    }
+  }
+}
+
+// C = A * B for square row-major n x n matrices
+template <typename T, typename Acc = T>
+std::vector<Acc> Multiply(const std::vector<T>& a, const std::vector<T>& b, size_t n) {
+  std::vector<Acc> c(n * n);
+  Gemm(n, n, n, a.data(), n, b.data(), n, c.data(), n);
+  return c;
+}
+
+namespace detail {
+
+// One Strassen level on top of Gemm, used to find where the recursion starts to pay off
+inline void StrassenLevel(size_t n, const double* a, const double* b, double* c) {
+  const size_t h = n / 2;
+  auto block = [&](auto* m, size_t row, size_t col) { return m + (row * h * n) + (col * h); };
+  // out = x + sign * y for h x h blocks of the n x n inputs
+  auto combine = [&](const double* x, const double* y, double sign, std::vector<double>& out) {
+    for (size_t i = 0; i < h; ++i) {
+      for (size_t j = 0; j < h; ++j) {
+        out[(i * h) + j] = x[(i * n) + j] + (sign * y[(i * n) + j]);
+      }
+    }
+  };
+  std::vector<double> s(h * h);
+  std::vector<double> t(h * h);
+  std::vector<double> p(h * h);
+  // c_block (+)= sign * p
+  auto scatter = [&](size_t row, size_t col, double sign, bool overwrite) {
+    double* out = block(c, row, col);
+    for (size_t i = 0; i < h; ++i) {
+      for (size_t j = 0; j < h; ++j) {
+        out[(i * n) + j] = (overwrite ? 0.0 : out[(i * n) + j]) + (sign * p[(i * h) + j]);
+      }
+    }
+  };
+  const double* a11 = block(a, 0, 0);
+  const double* a12 = block(a, 0, 1);
+  const double* a21 = block(a, 1, 0);
+  const double* a22 = block(a, 1, 1);
+  const double* b11 = block(b, 0, 0);
+  const double* b12 = block(b, 0, 1);
+  const double* b21 = block(b, 1, 0);
+  const double* b22 = block(b, 1, 1);
+
+  combine(a11, a22, 1.0, s);
+  combine(b11, b22, 1.0, t);
+  Gemm(h, h, h, s.data(), h, t.data(), h, p.data(), h);
+  scatter(0, 0, 1.0, true);
+  scatter(1, 1, 1.0, true);
+
+  combine(a21, a22, 1.0, s);
+  Gemm(h, h, h, s.data(), h, b11, n, p.data(), h);
+  scatter(1, 0, 1.0, true);
+  scatter(1, 1, -1.0, false);
+
+  combine(b12, b22, -1.0, t);
+  Gemm(h, h, h, a11, n, t.data(), h, p.data(), h);
+  scatter(0, 1, 1.0, true);
+  scatter(1, 1, 1.0, false);
+
+  combine(b21, b11, -1.0, t);
+  Gemm(h, h, h, a22, n, t.data(), h, p.data(), h);
+  scatter(0, 0, 1.0, false);
+  scatter(1, 0, 1.0, false);
+
+  combine(a11, a12, 1.0, s);
+  Gemm(h, h, h, s.data(), h, b22, n, p.data(), h);
+  scatter(0, 0, -1.0, false);
+  scatter(0, 1, 1.0, false);
+
+  combine(a21, a11, -1.0, s);
+  combine(b11, b12, 1.0, t);
+  Gemm(h, h, h, s.data(), h, t.data(), h, p.data(), h);
+  scatter(1, 1, 1.0, false);
+
+  combine(a12, a22, -1.0, s);
+  combine(b21, b22, 1.0, t);
+  Gemm(h, h, h, s.data(), h, t.data(), h, p.data(), h);
+  scatter(0, 0, 1.0, false);
+}
+
+template <typename Func>
+double BestTime(Func&& func) {
+  constexpr int kRepeats = 3;
+  double best = 0.0;
+  for (int r = 0; r < kRepeats; ++r) {
+    const auto t0 = std::chrono::steady_clock::now();
+    func();
+    const double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+    best = r == 0 ? elapsed : std::min(best, elapsed);
+  }
+  return best;
+}
+
+inline size_t TuneStrassenCutoff() {
+  if (const char* env = std::getenv("PPC_STRASSEN_CUTOFF")) {
+    const auto requested = std::strtoull(env, nullptr, 10);
+    if (requested > 0) {
+      return requested;
+    }
+  }
+  for (size_t cutoff : kStrassenCutoffCandidates) {
+    // Recursing from 2 * cutoff down to cutoff must beat a single Gemm of size 2 * cutoff
+    const size_t n = 2 * cutoff;
+    std::vector<double> a(n * n, 1.0);
+    std::vector<double> b(n * n, 0.5);
+    std::vector<double> c(n * n);
+    const double gemm_time = BestTime([&] { Gemm(n, n, n, a.data(), n, b.data(), n, c.data(), n); });
+    const double strassen_time = BestTime([&] { StrassenLevel(n, a.data(), b.data(), c.data()); });
+    if (strassen_time < gemm_time) {
+      return cutoff;
+    }
+  }
+  return kStrassenCutoffCandidates.back();
+}
+
+}  // namespace detail
+
+// Largest size a Strassen recursion should hand to Gemm instead of splitting further.
+// Measured once per process on this machine; the PPC_STRASSEN_CUTOFF environment variable overrides it.
+inline size_t StrassenCutoff() {
+  static const size_t kCutoff = detail::TuneStrassenCutoff();
+  return kCutoff;
+}
+
+}  // namespace ppc::matmul
@@ -0,0 +1,276 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+
+#include "core/matmul/include/gemm.hpp"
+
+namespace ppc::matmul {
+
+// out = x + sign * y for rows x cols blocks with their own leading dimensions
+template <typename T>
+void Combine(size_t rows, size_t cols, const T* x, size_t ldx, const T* y, size_t ldy, std::type_identity_t<T> sign,
+             T* out, size_t ldo) {
+  for (size_t i = 0; i < rows; ++i) {
+    const T* x_row = x + (i * ldx);
+    const T* y_row = y + (i * ldy);
+    T* out_row = out + (i * ldo);
+    for (size_t j = 0; j < cols; ++j) {
+      out_row[j] = x_row[j] + (sign * y_row[j]);
+    }
+  }
+}
+
+namespace detail {
+
+inline bool StrassenLeaf(size_t m, size_t n, size_t k, size_t cutoff) {
+  return m <= cutoff || n <= cutoff || k <= cutoff || m < 2 || n < 2 || k < 2;
+}
+
+}  // namespace detail
+
+// Given C holding the product of the even-sized leading blocks of A and B, adds the contribution of the
+// last column of A / row of B for odd k and computes the last column of C for odd n and its last row for odd m
+template <typename T>
+void CompleteOddEdges(size_t m, size_t n, size_t k, const T* a, size_t lda, const T* b, size_t ldb, T* c,
+                      size_t ldc) {
+  const size_t even_m = m - (m % 2);
+  const size_t even_n = n - (n % 2);
+  if (k % 2 != 0) {
+    Gemm(even_m, even_n, 1, a + (k - 1), lda, b + ((k - 1) * ldb), ldb, c, ldc, true);
+  }
+  if (n % 2 != 0) {
+    Gemm(m, 1, k, a, lda, b + (n - 1), ldb, c + (n - 1), ldc);
+  }
+  if (m % 2 != 0) {
+    Gemm(1, even_n, k, a + ((m - 1) * lda), lda, b, ldb, c + ((m - 1) * ldc), ldc);
+  }
+}
+
+// Number of products in one Strassen level
+constexpr size_t kStrassenProducts = 7;
+
+// Operands of one Winograd product; each is either a block of the input or one of the caller's buffers
+template <typename T>
+struct WinogradOperands {
+  const T* lhs;
+  size_t ld_lhs;
+  const T* rhs;
+  size_t ld_rhs;
+};
+
+// Prepares product P(index + 1) of Winograd's scheme for the even-sized leading blocks of A and B:
+// P1 = A11 * B11, P2 = A12 * B21, P3 = S4 * B22, P4 = A22 * T4, P5 = S1 * T1, P6 = S2 * T2, P7 = S3 * T3 with
+// S1 = A21 + A22, S2 = S1 - A11, S3 = A11 - A21, S4 = A12 - S2, T1 = B12 - B11, T2 = B22 - T1, T3 = B22 - B12,
+// T4 = T2 - B21. The sums go to s (hm x hk) and t (hk x hn), which are packed; the products are independent.
+template <typename T>
+WinogradOperands<T> PrepareWinogradProduct(size_t index, size_t hm, size_t hn, size_t hk, const T* a, size_t lda,
+                                           const T* b, size_t ldb, T* s, T* t) {
+  const T* a11 = a;
+  const T* a12 = a + hk;
+  const T* a21 = a + (hm * lda);
+  const T* a22 = a21 + hk;
+  const T* b11 = b;
+  const T* b12 = b + hn;
+  const T* b21 = b + (hk * ldb);
+  const T* b22 = b21 + hn;
+  auto s_sum = [&](const T* x, size_t ldx, const T* y, size_t ldy, T sign) {
+    Combine<T>(hm, hk, x, ldx, y, ldy, sign, s, hk);
+  };
+  auto t_sum = [&](const T* x, size_t ldx, const T* y, size_t ldy, T sign) {
+    Combine<T>(hk, hn, x, ldx, y, ldy, sign, t, hn);
+  };
+  switch (index) {
+    case 0:
+      return {a11, lda, b11, ldb};
+    case 1:
+      return {a12, lda, b21, ldb};
+    case 2:
+      s_sum(a21, lda, a22, lda, 1.0);
+      s_sum(s, hk, a11, lda, -1.0);
+      s_sum(a12, lda, s, hk, -1.0);
+      return {s, hk, b22, ldb};
+    case 3:
+      t_sum(b12, ldb, b11, ldb, -1.0);
+      t_sum(b22, ldb, t, hn, -1.0);
+      t_sum(t, hn, b21, ldb, -1.0);
+      return {a22, lda, t, hn};
+    case 4:
+      s_sum(a21, lda, a22, lda, 1.0);
+      t_sum(b12, ldb, b11, ldb, -1.0);
+      return {s, hk, t, hn};
+    case 5:
+      s_sum(a21, lda, a22, lda, 1.0);
+      s_sum(s, hk, a11, lda, -1.0);
+      t_sum(b12, ldb, b11, ldb, -1.0);
+      t_sum(b22, ldb, t, hn, -1.0);
+      return {s, hk, t, hn};
+    default:
+      s_sum(a11, lda, a21, lda, -1.0);
+      t_sum(b22, ldb, b12, ldb, -1.0);
+      return {s, hk, t, hn};
+  }
+}
+
+// Assembles the even-sized leading blocks of C from the seven packed hm x hn Winograd products:
+// C11 = P1 + P2, C12 = P1 + P6 + P5 + P3, C21 = P1 + P6 + P7 - P4, C22 = P1 + P6 + P7 + P5
+template <typename T>
+void CombineWinogradProducts(size_t hm, size_t hn, const std::array<const T*, kStrassenProducts>& p, T* c,
+                             size_t ldc) {
+  T* c11 = c;
+  T* c12 = c + hn;
+  T* c21 = c + (hm * ldc);
+  T* c22 = c21 + hn;
+  Combine(hm, hn, p[0], hn, p[1], hn, 1.0, c11, ldc);
+  Combine(hm, hn, p[0], hn, p[5], hn, 1.0, c12, ldc);
+  Combine(hm, hn, c12, ldc, p[6], hn, 1.0, c21, ldc);
+  Combine(hm, hn, c21, ldc, p[4], hn, 1.0, c22, ldc);
+  Combine(hm, hn, c21, ldc, p[3], hn, -1.0, c21, ldc);
+  Combine(hm, hn, c12, ldc, p[4], hn, 1.0, c12, ldc);
+  Combine(hm, hn, c12, ldc, p[2], hn, 1.0, c12, ldc);
+}
+
+// Elements of workspace Strassen() needs for an (m x k) * (k x n) product: three half-size temporaries per level
+inline size_t StrassenWorkspaceSize(size_t m, size_t n, size_t k, size_t cutoff = StrassenCutoff()) {
+  size_t total = 0;
+  while (!detail::StrassenLeaf(m, n, k, cutoff)) {
+    m /= 2;
+    n /= 2;
+    k /= 2;
+    total += (m * k) + (k * n) + (m * n);
+  }
+  return total;
+}
+
+// C = A * B by Winograd's variant of Strassen (7 products, 15 additions) on strided row-major views.
+// Odd dimensions are peeled off and fixed up with Gemm, so no padding is needed; all temporaries live in
+// workspace, which must hold StrassenWorkspaceSize(m, n, k, cutoff) elements. Never allocates.
+template <typename T>
+void Strassen(size_t m, size_t n, size_t k, const T* a, size_t lda, const T* b, size_t ldb, T* c, size_t ldc,
+              std::span<std::type_identity_t<T>> workspace, size_t cutoff = StrassenCutoff()) {
+  if (detail::StrassenLeaf(m, n, k, cutoff)) {
+    Gemm(m, n, k, a, lda, b, ldb, c, ldc);
+    return;
+  }
+  const size_t hm = m / 2;
+  const size_t hn = n / 2;
+  const size_t hk = k / 2;
+
+  const T* a11 = a;
+  const T* a12 = a + hk;
+  const T* a21 = a + (hm * lda);
+  const T* a22 = a21 + hk;
+  const T* b11 = b;
+  const T* b12 = b + hn;
+  const T* b21 = b + (hk * ldb);
+  const T* b22 = b21 + hn;
+  T* c11 = c;
+  T* c12 = c + hn;
+  T* c21 = c + (hm * ldc);
+  T* c22 = c21 + hn;
+
+  T* x = workspace.data();
+  T* y = x + (hm * hk);
+  T* z = y + (hk * hn);
+  const auto rest = workspace.subspan((hm * hk) + (hk * hn) + (hm * hn));
+  auto product = [&](const T* lhs, size_t ld_lhs, const T* rhs, size_t ld_rhs, T* out, size_t ld_out) {
+    Strassen(hm, hn, hk, lhs, ld_lhs, rhs, ld_rhs, out, ld_out, rest, cutoff);
+  };
+  auto add = [&](T* out, const T* lhs, const T* rhs, T sign) {
+    Combine(hm, hn, lhs, ldc, rhs, ldc, sign, out, ldc);
+  };
+
+  // S3 = A11 - A21, T3 = B22 - B12, P7 = S3 * T3
+  Combine(hm, hk, a11, lda, a21, lda, -1.0, x, hk);
+  Combine(hk, hn, b22, ldb, b12, ldb, -1.0, y, hn);
+  product(x, hk, y, hn, c21, ldc);
+  // S1 = A21 + A22, T1 = B12 - B11, P5 = S1 * T1
+  Combine(hm, hk, a21, lda, a22, lda, 1.0, x, hk);
+  Combine(hk, hn, b12, ldb, b11, ldb, -1.0, y, hn);
+  product(x, hk, y, hn, c22, ldc);
+  // S2 = S1 - A11, T2 = B22 - T1, P6 = S2 * T2
+  Combine(hm, hk, x, hk, a11, lda, -1.0, x, hk);
+  Combine(hk, hn, b22, ldb, y, hn, -1.0, y, hn);
+  product(x, hk, y, hn, c12, ldc);
+  // S4 = A12 - S2, P3 = S4 * B22
+  Combine(hm, hk, a12, lda, x, hk, -1.0, x, hk);
+  product(x, hk, b22, ldb, c11, ldc);
+  // P1 = A11 * B11, then U2 = P1 + P6, U3 = U2 + P7, U4 = U2 + P5, C22 = U3 + P5, C12 = U4 + P3
+  product(a11, lda, b11, ldb, z, hn);
+  Combine(hm, hn, z, hn, c12, ldc, 1.0, c12, ldc);
+  add(c21, c12, c21, 1.0);
+  add(c12, c12, c22, 1.0);
+  add(c22, c21, c22, 1.0);
+  add(c12, c12, c11, 1.0);
+  // T4 = T2 - B21, P4 = A22 * T4, C21 = U3 - P4
+  Combine(hk, hn, y, hn, b21, ldb, -1.0, y, hn);
+  product(a22, lda, y, hn, c11, ldc);
+  add(c21, c21, c11, -1.0);
+  // P2 = A12 * B21, C11 = P1 + P2
+  product(a12, lda, b21, ldb, c11, ldc);
+  Combine(hm, hn, z, hn, c11, ldc, 1.0, c11, ldc);
+
+  CompleteOddEdges(m, n, k, a, lda, b, ldb, c, ldc);
+}
+
+// Strassen levels to run as parallel tasks so that top_tasks independent products grow to at least threads tasks
+inline size_t StrassenTaskDepth(size_t n, size_t top_tasks, size_t threads, size_t cutoff = StrassenCutoff()) {
+  size_t depth = 0;
+  for (size_t tasks = top_tasks; tasks < threads && !detail::StrassenLeaf(n, n, n, cutoff); ++depth) {
+    tasks *= kStrassenProducts;
+    n /= 2;
+  }
+  return depth;
+}
+
+// Elements of workspace ParallelStrassen() needs. Each parallel level keeps all seven products and their operands
+// alive at once, so the workspace grows by (7/4)^depth over the sequential one
+inline size_t ParallelStrassenWorkspaceSize(size_t m, size_t n, size_t k, size_t depth,
+                                            size_t cutoff = StrassenCutoff()) {
+  if (depth == 0 || detail::StrassenLeaf(m, n, k, cutoff)) {
+    return StrassenWorkspaceSize(m, n, k, cutoff);
+  }
+  m /= 2;
+  n /= 2;
+  k /= 2;
+  return kStrassenProducts * ((m * k) + (k * n) + (m * n) + ParallelStrassenWorkspaceSize(m, n, k, depth - 1, cutoff));
+}
+
+// Strassen() whose top depth levels compute their seven products as independent tasks. fork_join(count, func) must
+// call func(i) for every i in [0, count), possibly concurrently, and return once all calls are done (a TBB
+// task_group, OpenMP tasks or plain threads). Every task writes only to its own slice of workspace, which must hold
+// ParallelStrassenWorkspaceSize(m, n, k, depth, cutoff) elements, so no locking is needed.
+template <typename T, typename ForkJoin>
+void ParallelStrassen(size_t m, size_t n, size_t k, const T* a, size_t lda, const T* b, size_t ldb, T* c, size_t ldc,
+                      std::span<std::type_identity_t<T>> workspace, size_t depth, ForkJoin&& fork_join,
+                      size_t cutoff = StrassenCutoff()) {
+  if (depth == 0 || detail::StrassenLeaf(m, n, k, cutoff)) {
+    Strassen(m, n, k, a, lda, b, ldb, c, ldc, workspace, cutoff);
+    return;
+  }
+  const size_t hm = m / 2;
+  const size_t hn = n / 2;
+  const size_t hk = k / 2;
+  const size_t child_workspace = ParallelStrassenWorkspaceSize(hm, hn, hk, depth - 1, cutoff);
+  const size_t slice = (hm * hk) + (hk * hn) + (hm * hn) + child_workspace;
+
+  std::array<const T*, kStrassenProducts> products{};
+  for (size_t i = 0; i < kStrassenProducts; ++i) {
+    products[i] = workspace.data() + (i * slice);
+  }
+  fork_join(kStrassenProducts, [&](size_t i) {
+    const auto task_workspace = workspace.subspan(i * slice, slice);
+    T* p = task_workspace.data();
+    T* s = p + (hm * hn);
+    T* t = s + (hm * hk);
+    const auto operands = PrepareWinogradProduct(i, hm, hn, hk, a, lda, b, ldb, s, t);
+    ParallelStrassen(hm, hn, hk, operands.lhs, operands.ld_lhs, operands.rhs, operands.ld_rhs, p, hn,
+                     task_workspace.subspan(slice - child_workspace), depth - 1, fork_join, cutoff);
+  });
+  CombineWinogradProducts(hm, hn, products, c, ldc);
+  CompleteOddEdges(m, n, k, a, lda, b, ldb, c, ldc);
+}
+
+}  // namespace ppc::matmul
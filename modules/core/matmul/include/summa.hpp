@@ -0,0 +1,294 @@
+#pragma once
+
+#include <mpi.h>
+
+#include <algorithm>
+#include <array>
+#include <boost/mpi/communicator.hpp>
+#include <boost/mpi/datatype.hpp>
+#include <cstddef>
+#include <vector>
+
+#include "core/matmul/include/gemm.hpp"
+#include "core/util/include/fork_join.hpp"
+
+namespace ppc::matmul {
+
+// Default width of the k panels broadcast at every SUMMA step
+constexpr size_t kSummaPanel = 256;
+// Block of local C updated by one task between two polls of the pending broadcasts
+constexpr size_t kSummaTaskRows = kMc;
+constexpr size_t kSummaTaskCols = 128;
+
+// [first, last) of part index when size items are split into parts nearly equal parts
+struct BlockRange {
+  BlockRange(size_t size, size_t parts, size_t index)
+      : first(index * size / parts), last((index + 1) * size / parts) {}
+  BlockRange(size_t first, size_t last) : first(first), last(last) {}
+
+  [[nodiscard]] size_t Size() const { return last - first; }
+  // Part of this range that holds item offset (counted from first) when it is split into parts parts
+  [[nodiscard]] size_t Owner(size_t parts, size_t offset) const { return (((offset + 1) * parts) - 1) / Size(); }
+  [[nodiscard]] BlockRange Part(size_t parts, size_t index) const {
+    const BlockRange part(Size(), parts, index);
+    return {first + part.first, first + part.last};
+  }
+
+  size_t first;
+  size_t last;
+};
+
+// layers x rows x cols process grid. Rank (l, i, j) is (l * rows + i) * cols + j
+struct SummaGrid {
+  // Uses all p processes: layers is the largest divisor of p not above max_layers (the cube root of p when 0),
+  // and every layer is the most square rows x cols factorization of p / layers, so any p works
+  static SummaGrid ForProcesses(size_t p, size_t max_layers = 0) {
+    if (max_layers == 0) {
+      while ((max_layers + 1) * (max_layers + 1) * (max_layers + 1) <= p) {
+        ++max_layers;
+      }
+    }
+    SummaGrid grid;
+    for (size_t layers = std::max<size_t>(std::min(max_layers, p), 1); layers > 0; --layers) {
+      if (p % layers == 0) {
+        grid.layers = layers;
+        break;
+      }
+    }
+    const size_t layer_size = p / grid.layers;
+    for (size_t rows = 1; rows * rows <= layer_size; ++rows) {
+      if (layer_size % rows == 0) {
+        grid.rows = rows;
+      }
+    }
+    grid.cols = layer_size / grid.rows;
+    return grid;
+  }
+
+  [[nodiscard]] size_t Size() const { return layers * rows * cols; }
+
+  size_t layers = 1;
+  size_t rows = 1;
+  size_t cols = 1;
+};
+
+struct SummaOptions {
+  // Upper bound on the replication factor c of the 2.5D scheme; 0 picks the cube root of the process count
+  size_t max_layers = 0;
+  size_t panel = kSummaPanel;
+};
+
+namespace detail {
+
+enum SummaTag : int { kSummaTagA = 1, kSummaTagB, kSummaTagC };
+
+// Copies the rows x cols block of a row-major matrix with leading dimension ld into the packed buffer out
+template <typename T>
+void CopyBlock(const T* matrix, size_t ld, BlockRange rows, BlockRange cols, T* out) {
+  for (size_t i = rows.first; i < rows.last; ++i) {
+    std::copy(matrix + (i * ld) + cols.first, matrix + (i * ld) + cols.last, out + ((i - rows.first) * cols.Size()));
+  }
+}
+
+// Inverse of CopyBlock
+template <typename T>
+void PasteBlock(const T* block, BlockRange rows, BlockRange cols, T* matrix, size_t ld) {
+  for (size_t i = rows.first; i < rows.last; ++i) {
+    const T* row = block + ((i - rows.first) * cols.Size());
+    std::copy(row, row + cols.Size(), matrix + (i * ld) + cols.first);
+  }
+}
+
+// Blocks of A, B and C a process of the grid owns. Layer l handles the k range BlockRange(k, layers, l); inside a
+// layer A is split by rows over grid rows and by k over grid columns, B by k over grid rows and by columns over
+// grid columns, and C by rows and columns
+struct SummaBlocks {
+  SummaBlocks(const SummaGrid& grid, size_t rank, size_t m, size_t n, size_t k)
+      : layer(rank / (grid.rows * grid.cols)),
+        row((rank / grid.cols) % grid.rows),
+        col(rank % grid.cols),
+        rows(m, grid.rows, row),
+        cols(n, grid.cols, col),
+        depth(k, grid.layers, layer),
+        a_depth(depth.Part(grid.cols, col)),
+        b_depth(depth.Part(grid.rows, row)) {}
+
+  size_t layer;
+  size_t row;
+  size_t col;
+  BlockRange rows;
+  BlockRange cols;
+  BlockRange depth;
+  BlockRange a_depth;
+  BlockRange b_depth;
+};
+
+}  // namespace detail
+
+// C = A * B on a 2.5D process grid (SUMMA inside each layer, k split across layers).
+// m, n and k must be the same on all ranks of world; A (m x k), B (k x n) and C (m x n) are row-major and only
+// used on rank 0, which sends every process just its own blocks and gathers C back. Each step broadcasts one A
+// panel along grid rows and one B panel along grid columns with nonblocking collectives; the next panels are in
+// flight while the current ones are multiplied. The local update is cut into tiles and fork_join(count, func)
+// must call func(i) for every i in [0, count), possibly concurrently, and return once all calls are done.
+// T is any element type Boost.MPI knows a datatype for (float, double).
+template <typename T, typename ForkJoin>
+void Summa(const boost::mpi::communicator& world, size_t m, size_t n, size_t k, const T* a, const T* b, T* c,
+           const SummaOptions& options, ForkJoin&& fork_join) {
+  const MPI_Datatype mpi_type = boost::mpi::get_mpi_datatype<T>(T{});
+  const auto grid = SummaGrid::ForProcesses(world.size(), options.max_layers);
+  const size_t panel = std::max<size_t>(options.panel, 1);
+  const detail::SummaBlocks own(grid, world.rank(), m, n, k);
+
+  std::vector<T> a_local(own.rows.Size() * own.a_depth.Size());
+  std::vector<T> b_local(own.b_depth.Size() * own.cols.Size());
+  std::vector<T> c_local(own.rows.Size() * own.cols.Size(), T{});
+
+  if (world.rank() == 0) {
+    std::vector<T> buffer;
+    for (int r = 1; r < world.size(); ++r) {
+      const detail::SummaBlocks blocks(grid, r, m, n, k);
+      buffer.resize(blocks.rows.Size() * blocks.a_depth.Size());
+      if (!buffer.empty()) {
+        detail::CopyBlock(a, k, blocks.rows, blocks.a_depth, buffer.data());
+        world.send(r, detail::kSummaTagA, buffer.data(), static_cast<int>(buffer.size()));
+      }
+      buffer.resize(blocks.b_depth.Size() * blocks.cols.Size());
+      if (!buffer.empty()) {
+        detail::CopyBlock(b, n, blocks.b_depth, blocks.cols, buffer.data());
+        world.send(r, detail::kSummaTagB, buffer.data(), static_cast<int>(buffer.size()));
+      }
+    }
+    detail::CopyBlock(a, k, own.rows, own.a_depth, a_local.data());
+    detail::CopyBlock(b, n, own.b_depth, own.cols, b_local.data());
+  } else {
+    if (!a_local.empty()) {
+      world.recv(0, detail::kSummaTagA, a_local.data(), static_cast<int>(a_local.size()));
+    }
+    if (!b_local.empty()) {
+      world.recv(0, detail::kSummaTagB, b_local.data(), static_cast<int>(b_local.size()));
+    }
+  }
+
+  const int row_color = static_cast<int>((own.layer * grid.rows) + own.row);
+  const int col_color = static_cast<int>((own.layer * grid.cols) + own.col);
+  const int fiber_color = static_cast<int>((own.row * grid.cols) + own.col);
+  boost::mpi::communicator row_comm = world.split(row_color, static_cast<int>(own.col));
+  boost::mpi::communicator col_comm = world.split(col_color, static_cast<int>(own.row));
+  boost::mpi::communicator fiber_comm = world.split(fiber_color, static_cast<int>(own.layer));
+
+  // Step s multiplies the A columns / B rows [first, first + width) of this layer's k range; a step never
+  // crosses the boundary of an A or B block, so each panel has a single owner
+  struct Step {
+    size_t first;
+    size_t width;
+    size_t a_owner;
+    size_t b_owner;
+  };
+  std::vector<Step> steps;
+  for (size_t kk = own.depth.first; kk < own.depth.last;) {
+    const size_t offset = kk - own.depth.first;
+    Step step{.first = kk,
+              .width = 0,
+              .a_owner = own.depth.Owner(grid.cols, offset),
+              .b_owner = own.depth.Owner(grid.rows, offset)};
+    const size_t a_end = own.depth.Part(grid.cols, step.a_owner).last;
+    const size_t b_end = own.depth.Part(grid.rows, step.b_owner).last;
+    step.width = std::min({panel, a_end - kk, b_end - kk});
+    steps.push_back(step);
+    kk += step.width;
+  }
+
+  const size_t rows = own.rows.Size();
+  const size_t cols = own.cols.Size();
+  std::array<std::vector<T>, 2> a_panels;
+  std::array<std::vector<T>, 2> b_panels;
+  std::array<T*, 2> b_panel_data{};
+  std::array<std::array<MPI_Request, 2>, 2> requests{};
+  for (auto& panel_buffer : a_panels) {
+    panel_buffer.resize(rows * panel);
+  }
+  for (auto& panel_buffer : b_panels) {
+    panel_buffer.resize(panel * cols);
+  }
+
+  auto post = [&](size_t s) {
+    const Step& step = steps[s];
+    const size_t slot = s % 2;
+    T* a_panel = a_panels[slot].data();
+    if (step.a_owner == own.col) {
+      const BlockRange panel_cols(step.first - own.a_depth.first, step.first - own.a_depth.first + step.width);
+      detail::CopyBlock(a_local.data(), own.a_depth.Size(), BlockRange(0, rows), panel_cols, a_panel);
+    }
+    // The owner broadcasts its B rows in place: they are already contiguous
+    b_panel_data[slot] = step.b_owner == own.row ? b_local.data() + ((step.first - own.b_depth.first) * cols)
+                                                 : b_panels[slot].data();
+    MPI_Ibcast(a_panel, static_cast<int>(rows * step.width), mpi_type, static_cast<int>(step.a_owner),
+               static_cast<MPI_Comm>(row_comm), requests[slot].data());
+    MPI_Ibcast(b_panel_data[slot], static_cast<int>(step.width * cols), mpi_type, static_cast<int>(step.b_owner),
+               static_cast<MPI_Comm>(col_comm), &requests[slot][1]);
+  };
+
+  const size_t col_tiles = (cols + kSummaTaskCols - 1) / kSummaTaskCols;
+  if (!steps.empty()) {
+    post(0);
+  }
+  for (size_t s = 0; s < steps.size(); ++s) {
+    const size_t slot = s % 2;
+    MPI_Waitall(2, requests[slot].data(), MPI_STATUSES_IGNORE);
+    const bool has_next = s + 1 < steps.size();
+    if (has_next) {
+      post(s + 1);
+    }
+    const size_t width = steps[s].width;
+    const T* a_panel = a_panels[slot].data();
+    const T* b_panel = b_panel_data[slot];
+    for (size_t r0 = 0; r0 < rows; r0 += kSummaTaskRows) {
+      const size_t tile_rows = std::min(kSummaTaskRows, rows - r0);
+      fork_join(col_tiles, [&](size_t tile) {
+        const size_t c0 = tile * kSummaTaskCols;
+        Gemm(tile_rows, std::min(kSummaTaskCols, cols - c0), width, a_panel + (r0 * width), width, b_panel + c0, cols,
+             c_local.data() + (r0 * cols) + c0, cols, true);
+      });
+      // Lets the MPI library progress the next panels while this process is busy computing
+      if (has_next) {
+        int done = 0;
+        MPI_Testall(2, requests[1 - slot].data(), &done, MPI_STATUSES_IGNORE);
+      }
+    }
+  }
+
+  if (grid.layers > 1) {
+    const int count = static_cast<int>(c_local.size());
+    if (own.layer == 0) {
+      MPI_Reduce(MPI_IN_PLACE, c_local.data(), count, mpi_type, MPI_SUM, 0, static_cast<MPI_Comm>(fiber_comm));
+    } else {
+      MPI_Reduce(c_local.data(), nullptr, count, mpi_type, MPI_SUM, 0, static_cast<MPI_Comm>(fiber_comm));
+    }
+  }
+
+  if (world.rank() == 0) {
+    detail::PasteBlock(c_local.data(), own.rows, own.cols, c, n);
+    const auto layer_size = static_cast<int>(grid.rows * grid.cols);
+    for (int r = 1; r < layer_size; ++r) {
+      const detail::SummaBlocks blocks(grid, r, m, n, k);
+      c_local.resize(blocks.rows.Size() * blocks.cols.Size());
+      if (!c_local.empty()) {
+        world.recv(r, detail::kSummaTagC, c_local.data(), static_cast<int>(c_local.size()));
+        detail::PasteBlock(c_local.data(), blocks.rows, blocks.cols, c, n);
+      }
+    }
+  } else if (own.layer == 0 && !c_local.empty()) {
+    world.send(0, detail::kSummaTagC, c_local.data(), static_cast<int>(c_local.size()));
+  }
+}
+
+// Summa() with the local update run on the calling thread
+template <typename T>
+void Summa(const boost::mpi::communicator& world, size_t m, size_t n, size_t k, const T* a, const T* b, T* c,
+           const SummaOptions& options = {}) {
+  Summa(world, m, n, k, a, b, c, options,
+        [](size_t count, const auto& func) { ppc::util::SequentialForkJoin(count, func); });
+}
+
+}  // namespace ppc::matmul
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+namespace ppc::matmul {
+
+// Square n x n matrix stored tile by tile: tile (ti, tj) is a contiguous row-major tile x tile block and tiles
+// follow each other in row-major order. Edge tiles are padded with zeros, so every tile has the full size and
+// block algorithms (Cannon, Fox) can multiply tiles directly and "move" them by changing tile indices.
+template <typename T>
+class BasicTiledMatrix {
+ public:
+  BasicTiledMatrix() = default;
+  BasicTiledMatrix(size_t n, size_t tile)
+      : n_(n), tile_(tile), tiles_((n + tile - 1) / tile), data_(tiles_ * tiles_ * tile * tile, T{}) {}
+
+  static BasicTiledMatrix FromRowMajor(const T* data, size_t n, size_t tile) {
+    BasicTiledMatrix matrix(n, tile);
+    for (size_t i = 0; i < n; ++i) {
+      for (size_t tj = 0; tj < matrix.tiles_; ++tj) {
+        const size_t first = tj * tile;
+        const size_t last = std::min(n, first + tile);
+        std::copy(data + (i * n) + first, data + (i * n) + last, matrix.Row(i, tj));
+      }
+    }
+    return matrix;
+  }
+
+  void ToRowMajor(T* data) const {
+    for (size_t i = 0; i < n_; ++i) {
+      for (size_t tj = 0; tj < tiles_; ++tj) {
+        const size_t first = tj * tile_;
+        const size_t count = std::min(n_, first + tile_) - first;
+        std::copy(Row(i, tj), Row(i, tj) + count, data + (i * n_) + first);
+      }
+    }
+  }
+
+  [[nodiscard]] size_t Size() const { return n_; }
+  [[nodiscard]] size_t TileSize() const { return tile_; }
+  [[nodiscard]] size_t TilesPerSide() const { return tiles_; }
+
+  T* Tile(size_t ti, size_t tj) { return data_.data() + (((ti * tiles_) + tj) * tile_ * tile_); }
+  [[nodiscard]] const T* Tile(size_t ti, size_t tj) const {
+    return data_.data() + (((ti * tiles_) + tj) * tile_ * tile_);
+  }
+
+ private:
+  // Part of matrix row i that lies in tile column tj
+  T* Row(size_t i, size_t tj) { return Tile(i / tile_, tj) + ((i % tile_) * tile_); }
+  [[nodiscard]] const T* Row(size_t i, size_t tj) const { return Tile(i / tile_, tj) + ((i % tile_) * tile_); }
+
+  size_t n_ = 0;
+  size_t tile_ = 1;
+  size_t tiles_ = 0;
+  std::vector<T> data_;
+};
+
+using TiledMatrix = BasicTiledMatrix<double>;
+
+}  // namespace ppc::matmul
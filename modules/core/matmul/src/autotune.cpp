@@ -0,0 +1,225 @@
+#include "core/matmul/include/autotune.hpp"
+
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <optional>
+#include <random>
+#include <sstream>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#include "core/matmul/include/gemm.hpp"
+
+namespace {
+
+constexpr size_t kDefaultL1 = size_t{32} << 10;
+constexpr size_t kDefaultL2 = size_t{1} << 20;
+constexpr size_t kDefaultL3 = size_t{8} << 20;
+#ifdef _SC_LEVEL1_DCACHE_SIZE
+size_t SysconfOr(int name, size_t fallback) {
+  const long value = sysconf(name);
+  return value > 0 ? static_cast<size_t>(value) : fallback;
+}
+#endif
+
+// Largest multiple of kBlockGranularity such that three blocks of doubles fit into bytes
+size_t FittingBlock(size_t bytes) {
+  const auto edge = static_cast<size_t>(std::sqrt(static_cast<double>(bytes) / (3.0 * sizeof(double))));
+  return std::clamp(edge / ppc::matmul::kBlockGranularity * ppc::matmul::kBlockGranularity,
+                    ppc::matmul::kBlockGranularity, ppc::matmul::kMaxTunedBlock);
+}
+
+// One block of C += A * B where A is a block row and B a block column of length n, multiplied block by block with
+// i-k-j loops inside a block: the kernel shape of the blocked tasks
+void BlockMultiply(size_t n, size_t block, const double* a, const double* b, double* c) {
+  for (size_t kb = 0; kb < n; kb += block) {
+    for (size_t i = 0; i < block; ++i) {
+      double* c_row = c + (i * n);
+      for (size_t k = kb; k < kb + block; ++k) {
+        const double a_ik = a[(i * n) + k];
+        const double* b_row = b + (k * n);
+        for (size_t j = 0; j < block; ++j) {
+          c_row[j] += a_ik * b_row[j];
+        }
+      }
+    }
+  }
+}
+
+// The same product with every block handed to Gemm(): the kernel shape of the tiled tasks
+void GemmBlockMultiply(size_t n, size_t block, const double* a, const double* b, double* c) {
+  for (size_t kb = 0; kb < n; kb += block) {
+    ppc::matmul::Gemm(block, block, block, a + kb, n, b + (kb * n), n, c, n, true);
+  }
+}
+
+// Seconds per multiply-add of multiply (BlockMultiply or GemmBlockMultiply) with the given block edge (best of a few
+// runs)
+template <typename Multiply>
+double TimePerFlop(size_t block, Multiply multiply) {
+  const size_t n = 2 * block;
+  std::vector<double> a(block * n, 1.0);
+  std::vector<double> b(n * n, 0.5);
+  std::vector<double> c(block * n, 0.0);
+  constexpr int kRepeats = 2;
+  double best = 0.0;
+  for (int r = 0; r < kRepeats; ++r) {
+    const auto t0 = std::chrono::steady_clock::now();
+    multiply(n, block, a.data(), b.data(), c.data());
+    const double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+    best = r == 0 ? elapsed : std::min(best, elapsed);
+  }
+  return best / static_cast<double>(block * block * n);
+}
+
+// Fastest of the block edges at 1/2, 3/4 and 1 of the largest one that fits
+size_t TuneLevel(size_t bytes) {
+  const size_t fitting = FittingBlock(bytes);
+  size_t best_block = fitting;
+  double best_time = 0.0;
+  for (size_t fraction : {2, 3, 4}) {
+    const size_t block =
+        std::max(fitting * fraction / 4 / ppc::matmul::kBlockGranularity * ppc::matmul::kBlockGranularity,
+                 ppc::matmul::kBlockGranularity);
+    const double time = TimePerFlop(block, BlockMultiply);
+    if (fraction == 2 || time < best_time) {
+      best_time = time;
+      best_block = block;
+    }
+  }
+  return best_block;
+}
+
+// Fastest Gemm() tile edge; small tiles pay the packing for too few products, large ones leave fewer tiles to share
+size_t TuneGemmTile() {
+  size_t best_tile = 0;
+  double best_time = 0.0;
+  for (size_t tile = ppc::matmul::kMaxTunedBlock / 4; tile <= ppc::matmul::kMaxTunedBlock; tile *= 2) {
+    const double time = TimePerFlop(tile, GemmBlockMultiply);
+    if (best_tile == 0 || time < best_time) {
+      best_time = time;
+      best_tile = tile;
+    }
+  }
+  return best_tile;
+}
+
+std::filesystem::path CacheFile(const std::filesystem::path& dir, const std::string& signature) {
+  std::ostringstream name;
+  name << "matmul_blocks_" << std::hex << std::hash<std::string>{}(signature) << ".txt";
+  return dir / name.str();
+}
+
+}  // namespace
+
+ppc::matmul::CacheSizes ppc::matmul::DetectCacheSizes() {
+  CacheSizes caches{.l1 = kDefaultL1, .l2 = kDefaultL2, .l3 = kDefaultL3};
+#ifdef _SC_LEVEL1_DCACHE_SIZE
+  caches.l1 = SysconfOr(_SC_LEVEL1_DCACHE_SIZE, caches.l1);
+  caches.l2 = SysconfOr(_SC_LEVEL2_CACHE_SIZE, caches.l2);
+  caches.l3 = SysconfOr(_SC_LEVEL3_CACHE_SIZE, caches.l3);
+#endif
+  return caches;
+}
+
+std::string ppc::matmul::CpuSignature() {
+  std::string model = "unknown";
+  std::ifstream cpuinfo("/proc/cpuinfo");
+  for (std::string line; std::getline(cpuinfo, line);) {
+    if (line.starts_with("model name")) {
+      model = line.substr(line.find(':') + 2);
+      break;
+    }
+  }
+  const CacheSizes caches = DetectCacheSizes();
+  std::ostringstream signature;
+  signature << model << ";threads=" << std::thread::hardware_concurrency() << ";l1=" << caches.l1
+            << ";l2=" << caches.l2 << ";l3=" << caches.l3;
+  return signature.str();
+}
+
+ppc::matmul::BlockSizes ppc::matmul::MeasureBlockSizes(const CacheSizes& caches) {
+  BlockSizes sizes;
+  sizes.l1 = TuneLevel(caches.l1);
+  sizes.l2 = std::max(TuneLevel(caches.l2), sizes.l1);
+  sizes.l3 = std::max(TuneLevel(caches.l3), sizes.l2);
+  sizes.gemm = TuneGemmTile();
+  return sizes;
+}
+
+std::optional<ppc::matmul::BlockSizes> ppc::matmul::LoadBlockSizes(const std::filesystem::path& dir,
+                                                                   const std::string& signature) {
+  std::ifstream file(CacheFile(dir, signature));
+  std::string stored_signature;
+  BlockSizes sizes;
+  if (!std::getline(file, stored_signature) || stored_signature != signature ||
+      !(file >> sizes.l1 >> sizes.l2 >> sizes.l3 >> sizes.gemm) || sizes.l1 == 0 || sizes.l2 == 0 || sizes.l3 == 0 ||
+      sizes.gemm == 0) {
+    return std::nullopt;
+  }
+  return sizes;
+}
+
+bool ppc::matmul::StoreBlockSizes(const std::filesystem::path& dir, const std::string& signature,
+                                  const BlockSizes& sizes) {
+  std::error_code error;
+  std::filesystem::create_directories(dir, error);
+  // Several processes may tune at once: each writes its own file and renames it into place atomically
+  const std::filesystem::path target = CacheFile(dir, signature);
+  std::filesystem::path temp = target;
+  temp += '.';
+  temp += std::to_string(std::random_device{}());
+  temp += ".tmp";
+  {
+    std::ofstream file(temp);
+    file << signature << '\n' << sizes.l1 << ' ' << sizes.l2 << ' ' << sizes.l3 << ' ' << sizes.gemm << '\n';
+    if (!file) {
+      std::filesystem::remove(temp, error);
+      return false;
+    }
+  }
+  std::filesystem::rename(temp, target, error);
+  if (error) {
+    std::filesystem::remove(temp, error);
+    return false;
+  }
+  return true;
+}
+
+ppc::matmul::BlockSizes ppc::matmul::LoadOrMeasureBlockSizes(const std::filesystem::path& dir) {
+  const std::string signature = CpuSignature();
+  if (auto stored = LoadBlockSizes(dir, signature)) {
+    return *stored;
+  }
+  const BlockSizes sizes = MeasureBlockSizes(DetectCacheSizes());
+  StoreBlockSizes(dir, signature, sizes);
+  return sizes;
+}
+
+std::filesystem::path ppc::matmul::TuneCacheDir() {
+  if (const char* env = std::getenv("PPC_TUNE_CACHE_DIR")) {
+    if (*env != '\0') {
+      return env;
+    }
+  }
+  std::error_code error;
+  const std::filesystem::path temp = std::filesystem::temp_directory_path(error);
+  return (error ? std::filesystem::path(".") : temp) / "ppc_tune";
+}
+
+ppc::matmul::BlockSizes ppc::matmul::TunedBlockSizes() {
+  static const BlockSizes kSizes = LoadOrMeasureBlockSizes(TuneCacheDir());
+  return kSizes;
+}
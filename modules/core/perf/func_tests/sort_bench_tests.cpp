@@ -0,0 +1,99 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <set>
+#include <vector>
+
+#include "core/perf/include/sort_bench.hpp"
+#include "core/task/include/task.hpp"
+
+namespace {
+
+template <class T>
+class StdSortTask : public ppc::core::Task {
+ public:
+  explicit StdSortTask(const ppc::core::TaskDataPtr &task_data) : Task(task_data) {}
+
+  bool PreProcessingImpl() override {
+    auto *in = reinterpret_cast<T *>(task_data->inputs[0]);
+    data_.assign(in, in + task_data->inputs_count[0]);
+    return true;
+  }
+
+  bool ValidationImpl() override { return task_data->inputs_count[0] == task_data->outputs_count[0]; }
+
+  bool RunImpl() override {
+    std::ranges::sort(data_);
+    return true;
+  }
+
+  bool PostProcessingImpl() override {
+    std::ranges::copy(data_, reinterpret_cast<T *>(task_data->outputs[0]));
+    return true;
+  }
+
+ private:
+  std::vector<T> data_;
+};
+
+}  // namespace
+
+TEST(sort_bench_tests, distributions_have_expected_shape) {
+  constexpr size_t kSize = 10000;
+  using ppc::core::KeyDistribution;
+  EXPECT_TRUE(std::ranges::is_sorted(ppc::core::GenerateKeys<int>(KeyDistribution::kSorted, kSize)));
+  EXPECT_TRUE(std::ranges::is_sorted(ppc::core::GenerateKeys<double>(KeyDistribution::kReverse, kSize),
+                                     std::greater<>()));
+
+  const auto all_equal = ppc::core::GenerateKeys<int>(KeyDistribution::kAllEqual, kSize);
+  EXPECT_EQ(std::ranges::count(all_equal, all_equal[0]), static_cast<std::ptrdiff_t>(kSize));
+
+  const auto few_unique = ppc::core::GenerateKeys<int>(KeyDistribution::kFewUnique, kSize);
+  EXPECT_LE(std::set<int>(few_unique.begin(), few_unique.end()).size(), ppc::core::kFewUniqueKeys);
+
+  const auto sawtooth = ppc::core::GenerateKeys<int>(KeyDistribution::kSawtooth, kSize);
+  size_t descents = 0;
+  for (size_t i = 1; i < kSize; ++i) {
+    descents += static_cast<size_t>(sawtooth[i] < sawtooth[i - 1]);
+  }
+  EXPECT_EQ(descents, ppc::core::kSawtoothTeeth - 1);
+
+  // The most frequent Zipf key takes a large share of the input
+  auto zipf = ppc::core::GenerateKeys<int>(KeyDistribution::kZipf, kSize);
+  EXPECT_GT(std::ranges::count(zipf, *std::ranges::min_element(zipf)), static_cast<std::ptrdiff_t>(kSize / 20));
+}
+
+TEST(sort_bench_tests, keys_are_reproducible_and_unsigned_keys_are_shifted) {
+  using ppc::core::KeyDistribution;
+  EXPECT_EQ(ppc::core::GenerateKeys<double>(KeyDistribution::kGaussian, 1000),
+            ppc::core::GenerateKeys<double>(KeyDistribution::kGaussian, 1000));
+  const auto keys = ppc::core::GenerateKeys<uint32_t>(KeyDistribution::kSorted, 1000);
+  EXPECT_TRUE(std::ranges::is_sorted(keys));
+}
+
+TEST(sort_bench_tests, suite_runs_every_distribution) {
+  const auto results = ppc::core::RunSortBenchSuite("std_sort", ppc::core::MakeSortTaskFactory<StdSortTask<int>, int>(),
+                                                    std::vector<size_t>{1000, 10000});
+  ASSERT_EQ(results.size(), 2 * ppc::core::kAllKeyDistributions.size());
+  for (const auto &result : results) {
+    EXPECT_TRUE(result.sorted);
+    EXPECT_GT(result.keys_per_sec, 0.0);
+  }
+}
+
+TEST(sort_bench_tests, default_sizes_start_at_one_thousand) {
+  const auto sizes = ppc::core::SortBenchSizes();
+  ASSERT_FALSE(sizes.empty());
+  EXPECT_EQ(sizes.front(), 1000U);
+  EXPECT_LE(sizes.back(), 100000000U);
+}
+
+TEST(sort_bench_tests, sizes_stop_at_limit) {
+  const auto sizes = ppc::core::SortBenchSizes(10000);
+  ASSERT_FALSE(sizes.empty());
+  EXPECT_EQ(sizes.front(), 1000U);
+  EXPECT_LE(sizes.back(), 10000U);
+}
@@ -0,0 +1,75 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <complex>
+#include <cstddef>
+#include <set>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "core/perf/include/spmv_bench.hpp"
+#include "core/util/include/fork_join.hpp"
+#include "core/util/include/util.hpp"
+
+TEST(spmv_bench_tests, patterns_have_expected_shape) {
+  constexpr int kN = 1024;
+  using ppc::core::SparsePattern;
+  const auto uniform = ppc::core::GenerateSparse<double>(SparsePattern::kUniform, kN);
+  EXPECT_EQ(uniform.ptr.size(), static_cast<size_t>(kN) + 1);
+  EXPECT_GT(uniform.values.size(), static_cast<size_t>(kN) * (ppc::core::kBenchEntriesPerRow - 1));
+
+  const auto banded = ppc::core::GenerateSparse<double>(SparsePattern::kBanded, kN);
+  for (int row = 0; row < kN; ++row) {
+    for (int e = banded.ptr[row]; e < banded.ptr[row + 1]; ++e) {
+      EXPECT_LE(std::abs(banded.index[e] - row), ppc::core::kBenchEntriesPerRow);
+    }
+  }
+
+  const auto power_law = ppc::core::GenerateSparse<double>(SparsePattern::kPowerLaw, kN);
+  int longest = 0;
+  for (int row = 0; row < kN; ++row) {
+    longest = std::max(longest, power_law.ptr[row + 1] - power_law.ptr[row]);
+  }
+  EXPECT_GT(longest, 10 * ppc::core::kBenchEntriesPerRow);
+}
+
+TEST(spmv_bench_tests, suite_covers_every_kernel_and_matches) {
+  const auto results = ppc::core::RunSpmvBenchSuite<double>(
+      "test", 2, [](size_t count, const auto& func) { ppc::util::SequentialForkJoin(count, func); }, {1024});
+  std::set<std::string> kernels;
+  for (const auto& result : results) {
+    EXPECT_TRUE(result.matches) << result.kernel << " " << ppc::core::ToString(result.pattern);
+    EXPECT_GT(result.gflops, 0.0);
+    kernels.insert(result.kernel);
+  }
+  EXPECT_EQ(kernels,
+            (std::set<std::string>{"row_split", "merge_path", "sell", "ccs", "spmm_crs", "spmm_ccs", "dense"}));
+}
+
+// Runs one kernel of the bench suite on GetPPCNumThreads() threads at the bench sizes
+template <typename T>
+void ExpectBenchKernelMatches(std::string_view kernel) {
+  const std::array<std::string_view, 1> selected{kernel};
+  const auto threads = static_cast<size_t>(std::max(ppc::util::GetPPCNumThreads(), 1));
+  const auto results = ppc::core::RunSpmvBenchSuite<T>(
+      "core/sparse", threads, [](size_t count, const auto& func) { ppc::util::ThreadForkJoin(count, func); },
+      ppc::core::SpmvBenchSizes(), selected);
+  EXPECT_FALSE(results.empty());
+  for (const auto& result : results) {
+    EXPECT_EQ(result.kernel, kernel);
+    EXPECT_TRUE(result.matches) << ppc::core::ToString(result.pattern) << " " << result.size;
+  }
+}
+
+class spmv_bench_suite : public ::testing::TestWithParam<std::string_view> {};
+
+TEST_P(spmv_bench_suite, double_kernel) { ExpectBenchKernelMatches<double>(GetParam()); }
+
+TEST_P(spmv_bench_suite, complex_kernel) { ExpectBenchKernelMatches<std::complex<double>>(GetParam()); }
+
+INSTANTIATE_TEST_SUITE_P(spmv_bench_tests, spmv_bench_suite, ::testing::ValuesIn(ppc::core::kSpmvBenchKernels),
+                         [](const ::testing::TestParamInfo<std::string_view>& info) {
+                           return std::string(info.param);
+                         });
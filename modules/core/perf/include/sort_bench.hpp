@@ -0,0 +1,198 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "core/perf/include/perf.hpp"
+#include "core/task/include/task.hpp"
+
+namespace ppc::core {
+
+enum class KeyDistribution : uint8_t {
+  kUniform,
+  kGaussian,
+  kSorted,
+  kReverse,
+  kSawtooth,
+  kFewUnique,
+  kAllEqual,
+  kZipf,
+};
+
+constexpr std::array<KeyDistribution, 8> kAllKeyDistributions{
+    KeyDistribution::kUniform,  KeyDistribution::kGaussian,  KeyDistribution::kSorted,   KeyDistribution::kReverse,
+    KeyDistribution::kSawtooth, KeyDistribution::kFewUnique, KeyDistribution::kAllEqual, KeyDistribution::kZipf};
+
+// Keys are drawn from [-kKeyRange, kKeyRange] (shifted to [0, 2 * kKeyRange] for unsigned types)
+constexpr double kKeyRange = 1e9;
+// Ascending teeth of the sawtooth input
+constexpr size_t kSawtoothTeeth = 16;
+// Distinct keys of the few-unique input
+constexpr size_t kFewUniqueKeys = 16;
+// Ranks and exponent of the Zipf input
+constexpr size_t kZipfRanks = size_t{1} << 16;
+constexpr double kZipfExponent = 1.1;
+// Keys sorted per measurement; small inputs are sorted several times to get a stable time
+constexpr size_t kBenchKeysPerCase = 1000000;
+
+std::string ToString(KeyDistribution distribution);
+
+// Input sizes 10^3, 10^4, ..., 10^8, up to the PPC_SORT_BENCH_MAX_SIZE environment variable (10^6 by default)
+// and up to limit; kernels that are quadratic on some distributions pass a lower limit
+std::vector<size_t> SortBenchSizes(size_t limit = 100000000);
+
+template <typename T>
+T KeyFromDouble(double value) {
+  if constexpr (std::is_integral_v<T> && std::is_unsigned_v<T>) {
+    return static_cast<T>(value + kKeyRange);
+  } else {
+    return static_cast<T>(value);
+  }
+}
+
+// Reproducible input of the given distribution
+template <typename T>
+std::vector<T> GenerateKeys(KeyDistribution distribution, size_t size, uint64_t seed = 42) {
+  std::mt19937_64 gen(seed);
+  std::vector<T> keys(size);
+  auto ramp = [](size_t i, size_t length) {
+    return -kKeyRange + (2.0 * kKeyRange * static_cast<double>(i) / static_cast<double>(std::max<size_t>(length, 1)));
+  };
+
+  switch (distribution) {
+    case KeyDistribution::kUniform: {
+      std::uniform_real_distribution<double> dist(-kKeyRange, kKeyRange);
+      std::ranges::generate(keys, [&] { return KeyFromDouble<T>(dist(gen)); });
+      break;
+    }
+    case KeyDistribution::kGaussian: {
+      std::normal_distribution<double> dist(0.0, kKeyRange / 8.0);
+      std::ranges::generate(keys, [&] { return KeyFromDouble<T>(std::clamp(dist(gen), -kKeyRange, kKeyRange)); });
+      break;
+    }
+    case KeyDistribution::kSorted:
+      for (size_t i = 0; i < size; ++i) {
+        keys[i] = KeyFromDouble<T>(ramp(i, size));
+      }
+      break;
+    case KeyDistribution::kReverse:
+      for (size_t i = 0; i < size; ++i) {
+        keys[i] = KeyFromDouble<T>(ramp(size - 1 - i, size));
+      }
+      break;
+    case KeyDistribution::kSawtooth: {
+      const size_t period = std::max<size_t>(size / kSawtoothTeeth, 1);
+      for (size_t i = 0; i < size; ++i) {
+        keys[i] = KeyFromDouble<T>(ramp(i % period, period));
+      }
+      break;
+    }
+    case KeyDistribution::kFewUnique: {
+      std::uniform_int_distribution<size_t> dist(0, kFewUniqueKeys - 1);
+      std::ranges::generate(keys, [&] { return KeyFromDouble<T>(ramp(dist(gen), kFewUniqueKeys)); });
+      break;
+    }
+    case KeyDistribution::kAllEqual:
+      std::ranges::fill(keys, KeyFromDouble<T>(42.0));
+      break;
+    case KeyDistribution::kZipf: {
+      std::vector<double> cdf(kZipfRanks);
+      double total = 0.0;
+      for (size_t r = 0; r < kZipfRanks; ++r) {
+        total += 1.0 / std::pow(static_cast<double>(r + 1), kZipfExponent);
+        cdf[r] = total;
+      }
+      std::uniform_real_distribution<double> dist(0.0, total);
+      std::ranges::generate(keys, [&] {
+        const auto rank = static_cast<size_t>(std::ranges::upper_bound(cdf, dist(gen)) - cdf.begin());
+        return KeyFromDouble<T>(ramp(std::min(rank, kZipfRanks - 1), kZipfRanks));
+      });
+      break;
+    }
+  }
+  return keys;
+}
+
+// Builds a sort task whose TaskData refers to input and output; both outlive the task
+template <typename T>
+using SortTaskFactory = std::function<std::shared_ptr<Task>(std::vector<T>& input, std::vector<T>& output)>;
+
+// Factory for the common contract: inputs[0] and outputs[0] point at the keys and inputs_count[0] and
+// outputs_count[0] hold their number. Extra constructor arguments are passed after the TaskData
+template <typename SortTask, typename T, typename... Args>
+SortTaskFactory<T> MakeSortTaskFactory(Args... args) {
+  return [args...](std::vector<T>& input, std::vector<T>& output) {
+    auto task_data = std::make_shared<TaskData>();
+    task_data->inputs.emplace_back(reinterpret_cast<uint8_t*>(input.data()));
+    task_data->inputs_count.emplace_back(input.size());
+    task_data->outputs.emplace_back(reinterpret_cast<uint8_t*>(output.data()));
+    task_data->outputs_count.emplace_back(output.size());
+    return std::make_shared<SortTask>(task_data, args...);
+  };
+}
+
+struct SortBenchResult {
+  std::string task_name;
+  KeyDistribution distribution = KeyDistribution::kUniform;
+  size_t size = 0;
+  // time of one full pipeline run (in seconds)
+  double time_sec = 0.0;
+  double keys_per_sec = 0.0;
+  bool sorted = false;
+};
+
+// Prints "task:distribution:size:keys_per_sec"
+void PrintSortBenchResult(const SortBenchResult& result);
+
+template <typename T>
+SortBenchResult RunSortBench(const std::string& task_name, const SortTaskFactory<T>& factory,
+                             KeyDistribution distribution, size_t size) {
+  std::vector<T> input = GenerateKeys<T>(distribution, size);
+  std::vector<T> output(size);
+  auto task = factory(input, output);
+
+  auto perf_attr = std::make_shared<PerfAttr>();
+  perf_attr->num_running = std::max<size_t>(kBenchKeysPerCase / std::max<size_t>(size, 1), 1);
+  const auto t0 = std::chrono::steady_clock::now();
+  perf_attr->current_timer = [&] {
+    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - t0);
+    return static_cast<double>(duration.count()) * 1e-9;
+  };
+  auto perf_results = std::make_shared<PerfResults>();
+  Perf(task).PipelineRun(perf_attr, perf_results);
+
+  SortBenchResult result;
+  result.task_name = task_name;
+  result.distribution = distribution;
+  result.size = size;
+  result.time_sec = perf_results->time_sec / static_cast<double>(perf_attr->num_running);
+  result.keys_per_sec = result.time_sec > 0.0 ? static_cast<double>(size) / result.time_sec : 0.0;
+  result.sorted = std::ranges::is_sorted(output);
+  return result;
+}
+
+// Drives one sort task through every distribution and size and prints keys/s for each case
+template <typename T>
+std::vector<SortBenchResult> RunSortBenchSuite(const std::string& task_name, const SortTaskFactory<T>& factory,
+                                               const std::vector<size_t>& sizes = SortBenchSizes()) {
+  std::vector<SortBenchResult> results;
+  for (size_t size : sizes) {
+    for (KeyDistribution distribution : kAllKeyDistributions) {
+      results.push_back(RunSortBench<T>(task_name, factory, distribution, size));
+      PrintSortBenchResult(results.back());
+    }
+  }
+  return results;
+}
+
+}  // namespace ppc::core
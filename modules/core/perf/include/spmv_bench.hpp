@@ -0,0 +1,218 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "core/sparse/include/compressed.hpp"
+#include "core/sparse/include/spmv.hpp"
+#include "core/sparse/include/transpose.hpp"
+
+namespace ppc::core {
+
+enum class SparsePattern : uint8_t {
+  kUniform,
+  kBanded,
+  kPowerLaw,
+};
+
+constexpr std::array<SparsePattern, 3> kAllSparsePatterns{SparsePattern::kUniform, SparsePattern::kBanded,
+                                                          SparsePattern::kPowerLaw};
+
+// Average entries per row of the generated matrices
+constexpr int kBenchEntriesPerRow = 16;
+// Columns of the dense block in the SpMM cases
+constexpr size_t kBenchBlockColumns = 8;
+// The dense path stores n x n elements, so it only runs up to this size
+constexpr int kMaxDenseBenchSize = 2048;
+// Multiply-adds per measurement; cheap cases are repeated to get a stable time
+constexpr size_t kBenchMultiplyAddsPerCase = 10000000;
+// Kernels timed by RunSpmvBenchSuite(): the SpMV ones on a vector, the SpMM ones on a block, and the dense path on both
+constexpr std::array<std::string_view, 7> kSpmvBenchKernels{"row_split", "merge_path", "sell", "ccs", "spmm_crs",
+                                                            "spmm_ccs", "dense"};
+
+std::string ToString(SparsePattern pattern);
+
+// Square matrix sizes 2^10, 2^13, ..., up to the PPC_SPMV_BENCH_MAX_SIZE environment variable (2^13 by default)
+std::vector<int> SpmvBenchSizes();
+
+// Reproducible n x n CRS matrix: kUniform scatters kBenchEntriesPerRow entries over each row, kBanded puts them
+// around the diagonal, and kPowerLaw gives the row of rank r about 1 / (r + 1) of the entries (rows shuffled), so a
+// few rows hold a large part of the matrix.
+template <typename T>
+sparse::CrsMatrix<T> GenerateSparse(SparsePattern pattern, int n, uint64_t seed = 42) {
+  std::mt19937_64 gen(seed);
+  std::uniform_real_distribution<double> value(-1.0, 1.0);
+  std::uniform_int_distribution<int> column(0, std::max(n - 1, 0));
+  std::vector<int> lengths(static_cast<size_t>(n), std::min(kBenchEntriesPerRow, n));
+  if (pattern == SparsePattern::kPowerLaw) {
+    const double scale = static_cast<double>(kBenchEntriesPerRow) * n / std::log(static_cast<double>(n) + 1.0);
+    for (int rank = 0; rank < n; ++rank) {
+      lengths[rank] = std::clamp(static_cast<int>(scale / (rank + 1)), 1, n);
+    }
+    std::ranges::shuffle(lengths, gen);
+  }
+
+  sparse::CrsMatrix<T> matrix;
+  matrix.shape.rows = n;
+  matrix.shape.cols = n;
+  std::vector<int> columns;
+  for (int row = 0; row < n; ++row) {
+    columns.clear();
+    if (pattern == SparsePattern::kBanded) {
+      const int first = std::clamp(row - (lengths[row] / 2), 0, n - lengths[row]);
+      columns.resize(lengths[row]);
+      std::iota(columns.begin(), columns.end(), first);
+    } else {
+      for (int e = 0; e < lengths[row]; ++e) {
+        columns.push_back(column(gen));
+      }
+      std::ranges::sort(columns);
+      columns.erase(std::unique(columns.begin(), columns.end()), columns.end());
+    }
+    for (int col : columns) {
+      matrix.index.push_back(col);
+      matrix.values.push_back(static_cast<T>(value(gen)));
+    }
+    matrix.ptr.push_back(static_cast<int>(matrix.index.size()));
+  }
+  return matrix;
+}
+
+struct SpmvBenchResult {
+  std::string task_name;
+  std::string kernel;
+  SparsePattern pattern = SparsePattern::kUniform;
+  int size = 0;
+  // Columns of the dense operand: 1 for SpMV
+  size_t columns = 1;
+  // time of one product (in seconds)
+  double time_sec = 0.0;
+  // Useful multiply-adds (2 * nnz * columns flops) per second, whatever the kernel actually computes
+  double gflops = 0.0;
+  bool matches = false;
+};
+
+// Prints "task:kernel:pattern:size:columns:gflops"
+void PrintSpmvBenchResult(const SpmvBenchResult& result);
+
+namespace detail {
+
+// Seconds per call of run, repeated until about kBenchMultiplyAddsPerCase multiply-adds of work are done
+template <typename Run>
+double TimePerCall(size_t work, const Run& run) {
+  const size_t repeats = std::max<size_t>(kBenchMultiplyAddsPerCase / std::max<size_t>(work, 1), 1);
+  const auto t0 = std::chrono::steady_clock::now();
+  for (size_t r = 0; r < repeats; ++r) {
+    run();
+  }
+  const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - t0;
+  return elapsed.count() / static_cast<double>(repeats);
+}
+
+template <typename T>
+bool Matches(const std::vector<T>& actual, const std::vector<T>& expected) {
+  for (size_t i = 0; i < actual.size(); ++i) {
+    if (std::abs(actual[i] - expected[i]) > 1e-9 * (1.0 + std::abs(expected[i]))) {
+      return false;
+    }
+  }
+  return actual.size() == expected.size();
+}
+
+}  // namespace detail
+
+// Times the SpMV kernels (row split, merge path, SELL-C-sigma, CCS scatter) and the SpMM kernels (CRS, CCS) against
+// the dense path, the same product with the matrix stored densely, on every pattern and size. parts and fork_join
+// are passed to the kernels as is; the dense path splits its rows the same way. Only the kernels named in kernels
+// are timed. Prints one line per case.
+template <typename T, typename ForkJoin>
+std::vector<SpmvBenchResult> RunSpmvBenchSuite(const std::string& task_name, size_t parts, ForkJoin&& fork_join,
+                                               const std::vector<int>& sizes = SpmvBenchSizes(),
+                                               std::span<const std::string_view> kernels = kSpmvBenchKernels) {
+  std::vector<SpmvBenchResult> results;
+  for (int n : sizes) {
+    for (SparsePattern pattern : kAllSparsePatterns) {
+      const auto crs = GenerateSparse<T>(pattern, n);
+      std::vector<T> dense_matrix;
+      if (n <= kMaxDenseBenchSize) {
+        dense_matrix.resize(static_cast<size_t>(n) * n);
+        crs.ToDense(dense_matrix.data());
+      }
+      const auto dense = std::span<const T>(dense_matrix);
+      const auto ccs = sparse::CcsMatrix<T>::FromCompressed(sparse::Transpose(crs.View(), parts, fork_join));
+      const auto sell = sparse::SellMatrix<T>::FromCrs(crs.View());
+      const size_t entries = crs.values.size();
+
+      for (size_t columns : {size_t{1}, kBenchBlockColumns}) {
+        std::vector<T> b(static_cast<size_t>(n) * columns);
+        std::mt19937_64 gen(7);
+        std::uniform_real_distribution<double> value(-1.0, 1.0);
+        std::ranges::generate(b, [&] { return static_cast<T>(value(gen)); });
+        std::vector<T> expected(static_cast<size_t>(n) * columns);
+        sparse::SpmmCrs<T>(crs.View(), b, columns, expected, 1, [](size_t, const auto& func) { func(0); });
+
+        auto measure = [&](const std::string& kernel, size_t work, const auto& run) {
+          if (std::ranges::find(kernels, kernel) == kernels.end()) {
+            return;
+          }
+          std::vector<T> c(expected.size(), T{});
+          SpmvBenchResult result;
+          result.task_name = task_name;
+          result.kernel = kernel;
+          result.pattern = pattern;
+          result.size = n;
+          result.columns = columns;
+          result.time_sec = detail::TimePerCall(work * columns, [&] { run(std::span<T>(c)); });
+          result.gflops = 2.0 * static_cast<double>(entries * columns) / result.time_sec * 1e-9;
+          result.matches = detail::Matches(c, expected);
+          PrintSpmvBenchResult(result);
+          results.push_back(result);
+        };
+
+        const auto view = crs.View();
+        if (columns == 1) {
+          measure("row_split", entries, [&](std::span<T> y) { sparse::SpmvRowSplit<T>(view, b, y, parts, fork_join); });
+          measure("merge_path", entries,
+                  [&](std::span<T> y) { sparse::SpmvMergePath<T>(view, b, y, parts, fork_join); });
+          measure("sell", sell.values.size(),
+                  [&](std::span<T> y) { sparse::SpmvSell<T>(sell, b, y, parts, fork_join); });
+        } else {
+          measure("spmm_crs", entries,
+                  [&](std::span<T> c) { sparse::SpmmCrs<T>(view, b, columns, c, parts, fork_join); });
+        }
+        measure(columns == 1 ? "ccs" : "spmm_ccs", entries,
+                [&](std::span<T> c) { sparse::SpmmCcs<T>(ccs.View(), b, columns, c, parts, fork_join); });
+        if (!dense.empty()) {
+          measure("dense", static_cast<size_t>(n) * n, [&](std::span<T> c) {
+            fork_join(parts, [&](size_t p) {
+              for (size_t i = n * p / parts; i < n * (p + 1) / parts; ++i) {
+                T* c_row = c.data() + (i * columns);
+                std::fill(c_row, c_row + columns, T{});
+                for (size_t k = 0; k < static_cast<size_t>(n); ++k) {
+                  const T a_ik = dense[(i * n) + k];
+                  for (size_t j = 0; j < columns; ++j) {
+                    c_row[j] += a_ik * b[(k * columns) + j];
+                  }
+                }
+              }
+            });
+          });
+        }
+      }
+    }
+  }
+  return results;
+}
+
+}  // namespace ppc::core
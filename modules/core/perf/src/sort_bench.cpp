@@ -0,0 +1,57 @@
+#include "core/perf/include/sort_bench.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+std::string ppc::core::ToString(KeyDistribution distribution) {
+  switch (distribution) {
+    case KeyDistribution::kUniform:
+      return "uniform";
+    case KeyDistribution::kGaussian:
+      return "gaussian";
+    case KeyDistribution::kSorted:
+      return "sorted";
+    case KeyDistribution::kReverse:
+      return "reverse";
+    case KeyDistribution::kSawtooth:
+      return "sawtooth";
+    case KeyDistribution::kFewUnique:
+      return "few_unique";
+    case KeyDistribution::kAllEqual:
+      return "all_equal";
+    case KeyDistribution::kZipf:
+      return "zipf";
+  }
+  return "unknown";
+}
+
+std::vector<size_t> ppc::core::SortBenchSizes(size_t limit) {
+  constexpr size_t kMinSize = 1000;
+  constexpr size_t kMaxSize = 100000000;
+  size_t max_size = 1000000;
+  if (const char* env = std::getenv("PPC_SORT_BENCH_MAX_SIZE")) {
+    const auto requested = std::strtoull(env, nullptr, 10);
+    if (requested >= kMinSize) {
+      max_size = std::min<size_t>(requested, kMaxSize);
+    }
+  }
+  max_size = std::min(max_size, limit);
+  std::vector<size_t> sizes;
+  for (size_t size = kMinSize; size <= max_size; size *= 10) {
+    sizes.push_back(size);
+  }
+  return sizes;
+}
+
+void ppc::core::PrintSortBenchResult(const SortBenchResult& result) {
+  std::stringstream keys_per_sec;
+  keys_per_sec << std::fixed << std::setprecision(0) << result.keys_per_sec;
+  std::cout << result.task_name << ":" << ToString(result.distribution) << ":" << result.size << ":"
+            << keys_per_sec.str() << (result.sorted ? "" : ":NOT_SORTED") << '\n';
+}
@@ -0,0 +1,45 @@
+#include "core/perf/include/spmv_bench.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+std::string ppc::core::ToString(SparsePattern pattern) {
+  switch (pattern) {
+    case SparsePattern::kUniform:
+      return "uniform";
+    case SparsePattern::kBanded:
+      return "banded";
+    case SparsePattern::kPowerLaw:
+      return "power_law";
+  }
+  return "unknown";
+}
+
+std::vector<int> ppc::core::SpmvBenchSizes() {
+  constexpr int kMinSize = 1 << 10;
+  constexpr int kMaxSize = 1 << 22;
+  int max_size = 1 << 13;
+  if (const char* env = std::getenv("PPC_SPMV_BENCH_MAX_SIZE")) {
+    const auto requested = std::strtol(env, nullptr, 10);
+    if (requested >= kMinSize) {
+      max_size = requested > kMaxSize ? kMaxSize : static_cast<int>(requested);
+    }
+  }
+  std::vector<int> sizes;
+  for (int size = kMinSize; size <= max_size; size *= 8) {
+    sizes.push_back(size);
+  }
+  return sizes;
+}
+
+void ppc::core::PrintSpmvBenchResult(const SpmvBenchResult& result) {
+  std::stringstream gflops;
+  gflops << std::fixed << std::setprecision(3) << result.gflops;
+  std::cout << result.task_name << ":" << result.kernel << ":" << ToString(result.pattern) << ":" << result.size << ":"
+            << result.columns << ":" << gflops.str() << (result.matches ? "" : ":MISMATCH") << '\n';
+}
@@ -0,0 +1,154 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "core/sort/include/external.hpp"
+
+namespace {
+
+struct Record {
+  int key;
+  int id;
+};
+
+class ExternalSortTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    dir_ = std::filesystem::temp_directory_path() /
+           ("ppc_external_sort_" + std::string(::testing::UnitTest::GetInstance()->current_test_info()->name()));
+    std::filesystem::remove_all(dir_);
+    std::filesystem::create_directories(dir_ / "runs");
+    options_.temp_dir = dir_ / "runs";
+  }
+  void TearDown() override { std::filesystem::remove_all(dir_); }
+
+  template <typename T>
+  std::filesystem::path WriteInput(const std::vector<T>& data) const {
+    auto path = dir_ / "input.bin";
+    std::ofstream out(path, std::ios::binary);
+    out.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size() * sizeof(T)));
+    return path;
+  }
+
+  template <typename T>
+  std::vector<T> ReadOutput() const {
+    const auto path = dir_ / "output.bin";
+    std::vector<T> data(std::filesystem::file_size(path) / sizeof(T));
+    std::ifstream in(path, std::ios::binary);
+    in.read(reinterpret_cast<char*>(data.data()), static_cast<std::streamsize>(data.size() * sizeof(T)));
+    return data;
+  }
+
+  [[nodiscard]] std::filesystem::path Output() const { return dir_ / "output.bin"; }
+
+  std::filesystem::path dir_;
+  ppc::sort::ExternalSortOptions options_;
+};
+
+std::vector<int> RandomInts(size_t size, int max) {
+  std::mt19937 gen(11);
+  std::uniform_int_distribution<int> dist(-max, max);
+  std::vector<int> data(size);
+  std::ranges::generate(data, [&] { return dist(gen); });
+  return data;
+}
+
+void SortInts(std::span<int> chunk) { std::ranges::sort(chunk); }
+
+}  // namespace
+
+TEST_F(ExternalSortTest, sorts_input_larger_than_chunk) {
+  std::vector<int> data = RandomInts(100003, 1000000);
+  options_.chunk_elements = 8192;
+  options_.block_elements = 1000;
+
+  const auto stats = ppc::sort::ExternalSort<int>(WriteInput(data), Output(), SortInts, options_);
+  std::ranges::sort(data);
+  EXPECT_EQ(stats.elements, data.size());
+  EXPECT_EQ(stats.runs, 13U);
+  EXPECT_EQ(ReadOutput<int>(), data);
+  EXPECT_TRUE(std::filesystem::is_empty(options_.temp_dir));
+}
+
+TEST_F(ExternalSortTest, single_chunk_is_written_directly) {
+  std::vector<int> data = RandomInts(4096, 100);
+  options_.chunk_elements = 4096;
+
+  const auto stats = ppc::sort::ExternalSort<int>(WriteInput(data), Output(), SortInts, options_);
+  std::ranges::sort(data);
+  EXPECT_EQ(stats.runs, 1U);
+  EXPECT_EQ(ReadOutput<int>(), data);
+  EXPECT_TRUE(std::filesystem::is_empty(options_.temp_dir));
+}
+
+TEST_F(ExternalSortTest, merge_is_stable_across_runs) {
+  std::vector<int> keys = RandomInts(30000, 50);
+  std::vector<Record> data(keys.size());
+  for (size_t i = 0; i < keys.size(); ++i) {
+    data[i] = {keys[i], static_cast<int>(i)};
+  }
+  auto by_key = [](const Record& a, const Record& b) { return a.key < b.key; };
+  options_.chunk_elements = 1000;
+  options_.block_elements = 64;
+
+  ppc::sort::ExternalSort<Record>(
+      WriteInput(data), Output(), [&](std::span<Record> chunk) { std::ranges::stable_sort(chunk, by_key); },
+      options_, by_key);
+  std::ranges::stable_sort(data, by_key);
+  const auto result = ReadOutput<Record>();
+  ASSERT_EQ(result.size(), data.size());
+  for (size_t i = 0; i < data.size(); ++i) {
+    EXPECT_EQ(result[i].key, data[i].key);
+    EXPECT_EQ(result[i].id, data[i].id);
+  }
+}
+
+TEST_F(ExternalSortTest, sorts_descending_with_comparator) {
+  std::vector<int> data = RandomInts(20000, 1000);
+  options_.chunk_elements = 3000;
+  options_.block_elements = 128;
+
+  ppc::sort::ExternalSort<int>(
+      WriteInput(data), Output(), [](std::span<int> chunk) { std::ranges::sort(chunk, std::greater<>()); },
+      options_, std::greater<>());
+  std::ranges::sort(data, std::greater<>());
+  EXPECT_EQ(ReadOutput<int>(), data);
+}
+
+TEST_F(ExternalSortTest, empty_input_gives_empty_output) {
+  const auto stats = ppc::sort::ExternalSort<int>(WriteInput(std::vector<int>{}), Output(), SortInts, options_);
+  EXPECT_EQ(stats.elements, 0U);
+  EXPECT_EQ(stats.runs, 0U);
+  EXPECT_TRUE(ReadOutput<int>().empty());
+}
+
+TEST_F(ExternalSortTest, missing_input_throws) {
+  EXPECT_THROW(ppc::sort::ExternalSort<int>(dir_ / "missing.bin", Output(), SortInts, options_), std::runtime_error);
+}
+
+TEST_F(ExternalSortTest, trailing_partial_element_throws) {
+  const auto input = WriteInput(RandomInts(10000, 1000));
+  {
+    std::ofstream out(input, std::ios::binary | std::ios::app);
+    out.write("\x01\x02", 2);
+  }
+  options_.chunk_elements = 3000;
+
+  EXPECT_THROW(ppc::sort::ExternalSort<int>(input, Output(), SortInts, options_), std::runtime_error);
+  EXPECT_TRUE(std::filesystem::is_empty(options_.temp_dir));
+}
+
+TEST_F(ExternalSortTest, single_chunk_with_partial_element_throws) {
+  const auto input = WriteInput(std::vector<char>{1, 2, 3, 4, 5, 6});
+
+  EXPECT_THROW(ppc::sort::ExternalSort<int>(input, Output(), SortInts, options_), std::runtime_error);
+}
@@ -0,0 +1,109 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <random>
+#include <span>
+#include <vector>
+
+#include "core/sort/include/presort.hpp"
+
+namespace {
+
+std::vector<int> MakeRuns(size_t size, size_t run_length) {
+  std::mt19937 gen(42);
+  std::uniform_int_distribution<int> dist(-100000, 100000);
+  std::vector<int> data(size);
+  std::ranges::generate(data, [&] { return dist(gen); });
+  for (size_t begin = 0; begin < size; begin += run_length) {
+    std::sort(data.begin() + static_cast<std::ptrdiff_t>(begin),
+              data.begin() + static_cast<std::ptrdiff_t>(std::min(size, begin + run_length)));
+  }
+  return data;
+}
+
+}  // namespace
+
+TEST(presort_tests, detects_sorted_input) {
+  std::vector<int> data(100000);
+  for (size_t i = 0; i < data.size(); ++i) {
+    data[i] = static_cast<int>(i / 3);
+  }
+  const auto info = ppc::sort::AnalyzePresortedness(std::span<const int>(data), 4);
+  EXPECT_EQ(info.kind, ppc::sort::Presortedness::kSorted);
+  EXPECT_EQ(info.runs, 1U);
+  EXPECT_EQ(info.inversion_ratio, 0.0);
+}
+
+TEST(presort_tests, reverses_non_increasing_input) {
+  std::vector<double> data(100000);
+  for (size_t i = 0; i < data.size(); ++i) {
+    data[i] = -static_cast<double>(i / 2);
+  }
+  std::vector<double> expected = data;
+  std::ranges::sort(expected);
+
+  const auto info = ppc::sort::AnalyzePresortedness(std::span<const double>(data), 4);
+  EXPECT_EQ(info.kind, ppc::sort::Presortedness::kReversed);
+  EXPECT_GT(info.inversion_ratio, 0.9);
+  ASSERT_TRUE(ppc::sort::SortIfPresorted(std::span<double>(data), 4));
+  EXPECT_EQ(data, expected);
+}
+
+TEST(presort_tests, merges_long_runs) {
+  std::vector<int> data = MakeRuns(200003, 1000);
+  std::vector<int> expected = data;
+  std::ranges::sort(expected);
+
+  const auto info = ppc::sort::AnalyzePresortedness(std::span<const int>(data), 3);
+  EXPECT_EQ(info.kind, ppc::sort::Presortedness::kLongRuns);
+  ASSERT_TRUE(ppc::sort::SortIfPresorted(std::span<int>(data), 3));
+  EXPECT_EQ(data, expected);
+}
+
+TEST(presort_tests, merges_odd_number_of_runs_sequentially) {
+  std::vector<int> data = MakeRuns(7 * 500, 500);
+  std::vector<int> expected = data;
+  std::ranges::sort(expected);
+
+  ppc::sort::MergeNaturalRuns(std::span<int>(data));
+  EXPECT_EQ(data, expected);
+}
+
+TEST(presort_tests, merges_with_custom_comparator) {
+  std::vector<int> data = MakeRuns(100000, 5000);
+  for (size_t begin = 0; begin < data.size(); begin += 5000) {
+    std::reverse(data.begin() + static_cast<std::ptrdiff_t>(begin),
+                 data.begin() + static_cast<std::ptrdiff_t>(begin + 5000));
+  }
+  std::vector<int> expected = data;
+  std::ranges::sort(expected, std::greater<>());
+
+  ASSERT_TRUE(ppc::sort::SortIfPresorted(std::span<int>(data), 8, std::greater<>()));
+  EXPECT_EQ(data, expected);
+}
+
+TEST(presort_tests, leaves_random_input_untouched) {
+  std::mt19937 gen(7);
+  std::uniform_int_distribution<int> dist(-1000, 1000);
+  std::vector<int> data(50000);
+  std::ranges::generate(data, [&] { return dist(gen); });
+  const std::vector<int> original = data;
+
+  const auto info = ppc::sort::AnalyzePresortedness(std::span<const int>(data), 2);
+  EXPECT_EQ(info.kind, ppc::sort::Presortedness::kUnsorted);
+  EXPECT_NEAR(info.inversion_ratio, 0.5, 0.1);
+  EXPECT_FALSE(ppc::sort::SortIfPresorted(std::span<int>(data), 2));
+  EXPECT_EQ(data, original);
+}
+
+TEST(presort_tests, handles_tiny_inputs) {
+  std::vector<int> empty;
+  EXPECT_TRUE(ppc::sort::SortIfPresorted(std::span<int>(empty)));
+  std::vector<int> single{5};
+  EXPECT_TRUE(ppc::sort::SortIfPresorted(std::span<int>(single)));
+  std::vector<int> pair{5, 1};
+  EXPECT_TRUE(ppc::sort::SortIfPresorted(std::span<int>(pair)));
+  EXPECT_EQ(pair, (std::vector<int>{1, 5}));
+}
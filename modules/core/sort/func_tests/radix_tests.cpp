@@ -0,0 +1,192 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "core/sort/include/radix.hpp"
+
+namespace {
+
+template <typename Key, typename Payload>
+std::vector<std::pair<Key, Payload>> StableSortedPairs(const std::vector<Key>& keys,
+                                                       const std::vector<Payload>& payload) {
+  std::vector<std::pair<Key, Payload>> pairs(keys.size());
+  for (size_t i = 0; i < keys.size(); ++i) {
+    pairs[i] = {keys[i], payload[i]};
+  }
+  std::ranges::stable_sort(pairs, [](const auto& a, const auto& b) { return a.first < b.first; });
+  return pairs;
+}
+
+template <typename Key, typename Payload>
+std::vector<std::pair<Key, Payload>> Zip(const std::vector<Key>& keys, const std::vector<Payload>& payload) {
+  std::vector<std::pair<Key, Payload>> pairs(keys.size());
+  for (size_t i = 0; i < keys.size(); ++i) {
+    pairs[i] = {keys[i], payload[i]};
+  }
+  return pairs;
+}
+
+template <typename Key>
+std::vector<Key> RandomKeys(size_t size, uint64_t seed) {
+  std::mt19937_64 gen(seed);
+  std::vector<Key> keys(size);
+  if constexpr (std::is_floating_point_v<Key>) {
+    std::uniform_real_distribution<Key> dist(-1e9, 1e9);
+    std::ranges::generate(keys, [&] { return dist(gen); });
+  } else {
+    using Wide = std::conditional_t<std::is_signed_v<Key>, int64_t, uint64_t>;
+    std::uniform_int_distribution<Wide> dist(std::numeric_limits<Key>::min(), std::numeric_limits<Key>::max());
+    std::ranges::generate(keys, [&] { return static_cast<Key>(dist(gen)); });
+  }
+  return keys;
+}
+
+template <typename Key>
+void ExpectRadixSortMatchesStdSort(size_t size, size_t num_threads) {
+  std::vector<Key> keys = RandomKeys<Key>(size, size + num_threads);
+  std::vector<Key> expected = keys;
+  std::ranges::sort(expected);
+  ppc::sort::RadixSort(std::span<Key>(keys), num_threads);
+  EXPECT_EQ(keys, expected);
+}
+
+}  // namespace
+
+TEST(radix_tests, key_traits_preserve_order) {
+  const std::vector<double> doubles = {-std::numeric_limits<double>::infinity(), -1e300, -2.5, -0.0, 0.0, 1e-300,
+                                       3.0, std::numeric_limits<double>::infinity()};
+  for (size_t i = 0; i + 1 < doubles.size(); ++i) {
+    using Traits = ppc::sort::RadixKeyTraits<double>;
+    EXPECT_LT(Traits::ToBits(doubles[i]), Traits::ToBits(doubles[i + 1]));
+    EXPECT_EQ(Traits::FromBits(Traits::ToBits(doubles[i])), doubles[i]);
+  }
+  const std::vector<int32_t> ints = {std::numeric_limits<int32_t>::min(), -7, -1, 0, 1, 42,
+                                     std::numeric_limits<int32_t>::max()};
+  for (size_t i = 0; i + 1 < ints.size(); ++i) {
+    using Traits = ppc::sort::RadixKeyTraits<int32_t>;
+    EXPECT_LT(Traits::ToBits(ints[i]), Traits::ToBits(ints[i + 1]));
+    EXPECT_EQ(Traits::FromBits(Traits::ToBits(ints[i])), ints[i]);
+  }
+}
+
+TEST(radix_tests, sorts_int64_keys_with_payload_stably) {
+  std::mt19937_64 gen(1);
+  std::uniform_int_distribution<int64_t> dist(-1000, 1000);
+  std::vector<int64_t> keys(100000);
+  std::ranges::generate(keys, [&] { return dist(gen); });
+  std::vector<uint64_t> payload(keys.size());
+  std::iota(payload.begin(), payload.end(), 0);
+  const auto expected = StableSortedPairs(keys, payload);
+
+  ppc::sort::RadixSortPairs(std::span<int64_t>(keys), std::span<uint64_t>(payload), 4);
+  EXPECT_EQ(Zip(keys, payload), expected);
+}
+
+TEST(radix_tests, batcher_variant_sorts_double_keys_with_payload) {
+  std::mt19937 gen(2);
+  std::uniform_real_distribution<double> dist(-1e6, 1e6);
+  // Five chunks, the last one shorter, so the merge network is not a power of two wide
+  std::vector<double> keys(100003);
+  std::ranges::generate(keys, [&] { return dist(gen); });
+  std::vector<uint32_t> payload(keys.size());
+  std::iota(payload.begin(), payload.end(), 0U);
+  const auto expected = StableSortedPairs(keys, payload);
+
+  ppc::sort::RadixBatcherSortPairs(std::span<double>(keys), std::span<uint32_t>(payload), 5);
+  EXPECT_EQ(Zip(keys, payload), expected);
+}
+
+TEST(radix_tests, batcher_variant_keeps_pairs_with_duplicate_keys) {
+  std::mt19937 gen(4);
+  std::uniform_int_distribution<int> dist(0, 7);
+  std::vector<int> keys(70001);
+  std::ranges::generate(keys, [&] { return dist(gen); });
+  std::vector<uint32_t> payload(keys.size());
+  std::iota(payload.begin(), payload.end(), 0U);
+  auto expected = Zip(keys, payload);
+  std::ranges::sort(expected);
+
+  ppc::sort::RadixBatcherSortPairs(std::span<int>(keys), std::span<uint32_t>(payload), 4);
+  EXPECT_TRUE(std::ranges::is_sorted(keys));
+  auto pairs = Zip(keys, payload);
+  std::ranges::sort(pairs);
+  EXPECT_EQ(pairs, expected);
+}
+
+TEST(radix_tests, batcher_network_merges_any_number_of_blocks) {
+  constexpr size_t kBlock = 7;
+  std::mt19937 gen(5);
+  std::uniform_int_distribution<int> dist(-20, 20);
+  for (size_t blocks = 1; blocks <= 17; ++blocks) {
+    for (size_t size : {(blocks * kBlock) - 3, blocks * kBlock}) {
+      std::vector<int> data(size);
+      std::ranges::generate(data, [&] { return dist(gen); });
+      for (size_t b = 0; b * kBlock < size; ++b) {
+        std::sort(data.begin() + static_cast<std::ptrdiff_t>(b * kBlock),
+                  data.begin() + static_cast<std::ptrdiff_t>(std::min(size, (b + 1) * kBlock)));
+      }
+      auto expected = data;
+      std::ranges::sort(expected);
+
+      ppc::sort::detail::BatcherMergeBlocks(std::span<int>(data), kBlock, 3, std::less<>());
+      EXPECT_EQ(data, expected) << blocks << " blocks, " << size << " elements";
+    }
+  }
+}
+
+TEST(radix_tests, argsort_returns_stable_permutation) {
+  std::mt19937 gen(3);
+  std::uniform_int_distribution<int> dist(-50, 50);
+  std::vector<int> keys(50000);
+  std::ranges::generate(keys, [&] { return dist(gen); });
+  std::vector<uint32_t> expected(keys.size());
+  std::iota(expected.begin(), expected.end(), 0U);
+  std::ranges::stable_sort(expected, [&](uint32_t a, uint32_t b) { return keys[a] < keys[b]; });
+
+  EXPECT_EQ(ppc::sort::ArgSort(std::span<const int>(keys), 4), expected);
+}
+
+TEST(radix_tests, argsort_handles_float_and_tiny_inputs) {
+  const std::vector<float> keys = {3.5F, -1.0F, 0.0F, -7.25F};
+  EXPECT_EQ(ppc::sort::ArgSort<uint64_t>(std::span<const float>(keys)), (std::vector<uint64_t>{3, 1, 2, 0}));
+  const std::vector<float> empty;
+  EXPECT_TRUE(ppc::sort::ArgSort(std::span<const float>(empty)).empty());
+}
+
+TEST(radix_tests, digit_passes_cover_every_key_width) {
+  static_assert(ppc::sort::RadixDigits<1>::kPasses == 1);
+  static_assert(ppc::sort::RadixDigits<2>::kPasses == 2);
+  static_assert(ppc::sort::RadixDigits<4>::kPasses == 3);
+  static_assert(ppc::sort::RadixDigits<8>::kPasses == 6);
+  SUCCEED();
+}
+
+TEST(radix_tests, sorts_plain_keys_of_every_width) {
+  ExpectRadixSortMatchesStdSort<int8_t>(40000, 2);
+  ExpectRadixSortMatchesStdSort<uint16_t>(40000, 2);
+  ExpectRadixSortMatchesStdSort<int32_t>(100000, 4);
+  ExpectRadixSortMatchesStdSort<uint32_t>(100000, 4);
+  ExpectRadixSortMatchesStdSort<int64_t>(100000, 3);
+  ExpectRadixSortMatchesStdSort<uint64_t>(100000, 1);
+  ExpectRadixSortMatchesStdSort<float>(100000, 4);
+  ExpectRadixSortMatchesStdSort<double>(100001, 4);
+}
+
+TEST(radix_tests, sorts_special_double_values) {
+  std::vector<double> keys = {3.0, std::numeric_limits<double>::infinity(), -0.0, -1e-300, 0.0,
+                              -std::numeric_limits<double>::infinity(), 1e300, -2.5};
+  ppc::sort::RadixSort(std::span<double>(keys));
+  EXPECT_TRUE(std::ranges::is_sorted(keys));
+  EXPECT_EQ(keys.front(), -std::numeric_limits<double>::infinity());
+  EXPECT_EQ(keys.back(), std::numeric_limits<double>::infinity());
+}
@@ -0,0 +1,77 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <random>
+#include <span>
+#include <vector>
+
+#include "core/sort/include/select.hpp"
+
+namespace {
+
+std::vector<int> RandomInts(size_t size, int max) {
+  std::mt19937 gen(5);
+  std::uniform_int_distribution<int> dist(-max, max);
+  std::vector<int> data(size);
+  std::ranges::generate(data, [&] { return dist(gen); });
+  return data;
+}
+
+void ExpectNthElement(const std::vector<int>& data, const std::vector<int>& sorted, size_t nth) {
+  ASSERT_EQ(data[nth], sorted[nth]);
+  EXPECT_TRUE(std::all_of(data.begin(), data.begin() + static_cast<std::ptrdiff_t>(nth),
+                          [&](int value) { return value <= data[nth]; }));
+  EXPECT_TRUE(std::all_of(data.begin() + static_cast<std::ptrdiff_t>(nth), data.end(),
+                          [&](int value) { return value >= data[nth]; }));
+}
+
+}  // namespace
+
+TEST(select_tests, nth_element_matches_full_sort) {
+  const std::vector<int> original = RandomInts(500000, 1000000);
+  std::vector<int> sorted = original;
+  std::ranges::sort(sorted);
+  for (size_t nth : {size_t{0}, size_t{1}, size_t{12345}, original.size() / 2, original.size() - 1}) {
+    std::vector<int> data = original;
+    ppc::sort::NthElement(std::span<int>(data), nth, 4);
+    ExpectNthElement(data, sorted, nth);
+  }
+}
+
+TEST(select_tests, nth_element_handles_few_unique_keys) {
+  std::vector<int> data = RandomInts(300000, 3);
+  std::vector<int> sorted = data;
+  std::ranges::sort(sorted);
+  ppc::sort::NthElement(std::span<int>(data), 200000, 8);
+  ExpectNthElement(data, sorted, 200000);
+
+  std::vector<int> equal(100000, 7);
+  ppc::sort::NthElement(std::span<int>(equal), 500, 4);
+  EXPECT_EQ(equal[500], 7);
+}
+
+TEST(select_tests, partial_sort_orders_prefix) {
+  std::vector<int> data = RandomInts(400000, 1000000);
+  std::vector<int> sorted = data;
+  std::ranges::sort(sorted);
+  ppc::sort::PartialSort(std::span<int>(data), 1000, 4);
+  EXPECT_TRUE(std::equal(data.begin(), data.begin() + 1000, sorted.begin()));
+  std::ranges::sort(data);
+  EXPECT_EQ(data, sorted);
+}
+
+TEST(select_tests, top_k_with_comparator_leaves_input_untouched) {
+  const std::vector<int> data = RandomInts(250000, 100000);
+  std::vector<int> sorted = data;
+  std::ranges::sort(sorted, std::greater<>());
+  const auto top = ppc::sort::TopK(std::span<const int>(data), 100, 4, std::greater<>());
+  EXPECT_EQ(top, std::vector<int>(sorted.begin(), sorted.begin() + 100));
+}
+
+TEST(select_tests, top_k_clamps_k) {
+  const std::vector<int> data{3, 1, 2};
+  EXPECT_EQ(ppc::sort::TopK(std::span<const int>(data), 10), (std::vector<int>{1, 2, 3}));
+  EXPECT_TRUE(ppc::sort::TopK(std::span<const int>(data), 0).empty());
+}
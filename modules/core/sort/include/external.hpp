@@ -0,0 +1,283 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <future>
+#include <memory>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace ppc::sort {
+
+struct ExternalSortOptions {
+  // Elements sorted in memory at once. Two chunks are alive at a time: one is written out while the next is read.
+  size_t chunk_elements = size_t{1} << 24;
+  // Elements per read/write block of every run and of the output, each stream keeps two blocks
+  size_t block_elements = size_t{1} << 16;
+  std::filesystem::path temp_dir = std::filesystem::temp_directory_path();
+};
+
+struct ExternalSortStats {
+  size_t elements = 0;
+  // sorted runs written to temporary files (1 when the input fits into a single chunk)
+  size_t runs = 0;
+};
+
+namespace detail {
+
+template <typename T>
+void ReadBlock(std::ifstream& in, std::vector<T>& buffer, size_t max_elements) {
+  buffer.resize(max_elements);
+  in.read(reinterpret_cast<char*>(buffer.data()), static_cast<std::streamsize>(max_elements * sizeof(T)));
+  if (in.bad()) {
+    throw std::runtime_error("external sort: read failed");
+  }
+  const auto bytes = static_cast<size_t>(in.gcount());
+  if (bytes % sizeof(T) != 0) {
+    throw std::runtime_error("external sort: file ends with a partial element");
+  }
+  buffer.resize(bytes / sizeof(T));
+}
+
+template <typename T>
+void WriteBlock(std::ofstream& out, const std::vector<T>& buffer) {
+  out.write(reinterpret_cast<const char*>(buffer.data()), static_cast<std::streamsize>(buffer.size() * sizeof(T)));
+  if (!out) {
+    throw std::runtime_error("external sort: write failed");
+  }
+}
+
+// Temporary run files, removed when the sort finishes or fails
+class TempRuns {
+ public:
+  explicit TempRuns(std::filesystem::path dir) : dir_(std::move(dir)) {
+    std::random_device seed;
+    prefix_ = "ppc_sort_run_" + std::to_string(seed()) + "_";
+  }
+  TempRuns(const TempRuns&) = delete;
+  TempRuns& operator=(const TempRuns&) = delete;
+  ~TempRuns() {
+    std::error_code ignored;
+    for (const auto& path : paths_) {
+      std::filesystem::remove(path, ignored);
+    }
+  }
+
+  const std::filesystem::path& Add() {
+    return paths_.emplace_back(dir_ / (prefix_ + std::to_string(paths_.size()) + ".bin"));
+  }
+  [[nodiscard]] const std::vector<std::filesystem::path>& Paths() const { return paths_; }
+
+ private:
+  std::filesystem::path dir_;
+  std::string prefix_;
+  std::vector<std::filesystem::path> paths_;
+};
+
+// Sequential reader of one sorted run. The next block is read in the background while the current one is merged.
+template <typename T>
+class RunReader {
+ public:
+  RunReader(const std::filesystem::path& path, size_t block) : in_(path, std::ios::binary), block_(block) {
+    if (!in_) {
+      throw std::runtime_error("external sort: cannot open run " + path.string());
+    }
+    Prefetch();
+    NextBlock();
+  }
+  RunReader(const RunReader&) = delete;
+  RunReader& operator=(const RunReader&) = delete;
+  ~RunReader() = default;
+
+  [[nodiscard]] bool Empty() const { return position_ == current_.size(); }
+  [[nodiscard]] const T& Front() const { return current_[position_]; }
+  void Pop() {
+    if (++position_ == current_.size()) {
+      NextBlock();
+    }
+  }
+
+ private:
+  void Prefetch() {
+    ahead_ = std::async(std::launch::async, [this, buffer = std::move(spare_)]() mutable {
+      ReadBlock(in_, buffer, block_);
+      return std::move(buffer);
+    });
+  }
+  void NextBlock() {
+    spare_ = std::move(current_);
+    current_ = ahead_.get();
+    position_ = 0;
+    if (!current_.empty()) {
+      Prefetch();
+    }
+  }
+
+  std::ifstream in_;
+  size_t block_;
+  std::vector<T> current_;
+  std::vector<T> spare_;
+  size_t position_ = 0;
+  std::future<std::vector<T>> ahead_;
+};
+
+// Block-buffered output; a full block is written in the background while the next one is being filled
+template <typename T>
+class BlockWriter {
+ public:
+  BlockWriter(const std::filesystem::path& path, size_t block) : out_(path, std::ios::binary), block_(block) {
+    if (!out_) {
+      throw std::runtime_error("external sort: cannot open " + path.string());
+    }
+    current_.reserve(block_);
+  }
+  BlockWriter(const BlockWriter&) = delete;
+  BlockWriter& operator=(const BlockWriter&) = delete;
+  ~BlockWriter() = default;
+
+  void Push(const T& value) {
+    current_.push_back(value);
+    if (current_.size() == block_) {
+      Flush();
+    }
+  }
+
+  void Finish() {
+    Flush();
+    if (pending_.valid()) {
+      pending_.get();
+    }
+  }
+
+ private:
+  void Flush() {
+    std::vector<T> spare;
+    if (pending_.valid()) {
+      spare = pending_.get();
+    }
+    pending_ = std::async(std::launch::async, [this, buffer = std::move(current_)]() mutable {
+      WriteBlock(out_, buffer);
+      return std::move(buffer);
+    });
+    current_ = std::move(spare);
+    current_.clear();
+    current_.reserve(block_);
+  }
+
+  std::ofstream out_;
+  size_t block_;
+  std::vector<T> current_;
+  std::future<std::vector<T>> pending_;
+};
+
+template <typename T, typename Compare>
+void MergeRuns(const std::vector<std::filesystem::path>& runs, const std::filesystem::path& output, size_t block,
+               Compare& comp) {
+  std::vector<std::unique_ptr<RunReader<T>>> readers;
+  readers.reserve(runs.size());
+  for (const auto& path : runs) {
+    readers.push_back(std::make_unique<RunReader<T>>(path, block));
+  }
+
+  // Min-heap of run indices by their front element; equal fronts are taken from the earlier run, which keeps
+  // the merge stable because runs follow the input order
+  auto later = [&](size_t a, size_t b) {
+    const T& x = readers[a]->Front();
+    const T& y = readers[b]->Front();
+    return comp(y, x) || (!comp(x, y) && a > b);
+  };
+  std::vector<size_t> heap;
+  for (size_t r = 0; r < readers.size(); ++r) {
+    if (!readers[r]->Empty()) {
+      heap.push_back(r);
+    }
+  }
+  std::ranges::make_heap(heap, later);
+
+  BlockWriter<T> writer(output, block);
+  while (!heap.empty()) {
+    std::ranges::pop_heap(heap, later);
+    RunReader<T>& reader = *readers[heap.back()];
+    writer.Push(reader.Front());
+    reader.Pop();
+    if (reader.Empty()) {
+      heap.pop_back();
+    } else {
+      std::ranges::push_heap(heap, later);
+    }
+  }
+  writer.Finish();
+}
+
+}  // namespace detail
+
+// Sorts a binary file of trivially copyable elements that may not fit into memory. The input is streamed in
+// chunks of options.chunk_elements, every chunk is sorted in place by chunk_sort(std::span<T>) - any of the
+// in-memory parallel kernels - and written to a temporary run while the next chunk is read. The runs are then
+// combined by a k-way merge that reads every run ahead by one block. chunk_sort must order by comp. A file whose size
+// is not a multiple of sizeof(T) is rejected with std::runtime_error.
+template <typename T, typename ChunkSort, typename Compare = std::less<>>
+ExternalSortStats ExternalSort(const std::filesystem::path& input, const std::filesystem::path& output,
+                               ChunkSort&& chunk_sort, const ExternalSortOptions& options = {}, Compare comp = {}) {
+  static_assert(std::is_trivially_copyable_v<T>, "elements are stored as raw bytes");
+  if (options.chunk_elements == 0 || options.block_elements == 0) {
+    throw std::invalid_argument("external sort: chunk and block sizes must be positive");
+  }
+  std::ifstream in(input, std::ios::binary);
+  if (!in) {
+    throw std::runtime_error("external sort: cannot open " + input.string());
+  }
+
+  ExternalSortStats stats;
+  detail::TempRuns runs(options.temp_dir);
+  std::vector<T> chunk;
+  std::vector<T> spare;
+  std::future<std::vector<T>> pending;
+  while (true) {
+    detail::ReadBlock(in, chunk, options.chunk_elements);
+    if (chunk.empty()) {
+      break;
+    }
+    stats.elements += chunk.size();
+    chunk_sort(std::span<T>(chunk));
+
+    // Input that fits into one chunk goes straight to the output
+    if (runs.Paths().empty() && in.peek() == std::ifstream::traits_type::eof()) {
+      std::ofstream out(output, std::ios::binary);
+      detail::WriteBlock(out, chunk);
+      stats.runs = 1;
+      return stats;
+    }
+
+    if (pending.valid()) {
+      spare = pending.get();
+    }
+    pending = std::async(std::launch::async, [path = runs.Add(), run = std::move(chunk)]() mutable {
+      std::ofstream out(path, std::ios::binary);
+      detail::WriteBlock(out, run);
+      return std::move(run);
+    });
+    chunk = std::move(spare);
+  }
+  if (pending.valid()) {
+    pending.get();
+  }
+
+  stats.runs = runs.Paths().size();
+  if (stats.runs == 0) {
+    std::ofstream out(output, std::ios::binary);
+    return stats;
+  }
+  detail::MergeRuns<T>(runs.Paths(), output, options.block_elements, comp);
+  return stats;
+}
+
+}  // namespace ppc::sort
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+namespace ppc::sort {
+
+// Smallest piece of work handed to a separate thread
+constexpr size_t kMinElementsPerThread = 1 << 14;
+
+namespace detail {
+
+inline size_t UsefulThreads(size_t n, size_t num_threads) {
+  return std::clamp<size_t>(n / kMinElementsPerThread, 1, std::max<size_t>(num_threads, 1));
+}
+
+// Calls func(t) for t in [0, count) on up to num_threads threads, the calling thread included
+template <typename Func>
+void ParallelFor(size_t count, size_t num_threads, Func&& func) {
+  const size_t threads = std::clamp<size_t>(num_threads, 1, std::max<size_t>(count, 1));
+  auto worker = [&](size_t first) {
+    for (size_t t = first; t < count; t += threads) {
+      func(t);
+    }
+  };
+  std::vector<std::thread> workers;
+  workers.reserve(threads - 1);
+  for (size_t w = 1; w < threads; ++w) {
+    workers.emplace_back(worker, w);
+  }
+  worker(0);
+  for (auto& thread : workers) {
+    thread.join();
+  }
+}
+
+}  // namespace detail
+
+}  // namespace ppc::sort
@@ -0,0 +1,198 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "core/sort/include/parallel.hpp"
+
+namespace ppc::sort {
+
+enum class Presortedness : uint8_t { kSorted, kReversed, kLongRuns, kUnsorted };
+
+struct PresortInfo {
+  Presortedness kind = Presortedness::kUnsorted;
+  // number of maximal non-decreasing runs
+  size_t runs = 1;
+  // share of inverted pairs among randomly sampled pairs (0 - sorted, ~0.5 - random, 1 - reversed)
+  double inversion_ratio = 0.0;
+};
+
+// Average run length from which merging the natural runs is cheaper than a full sort
+constexpr size_t kMinAverageRunLength = 64;
+// Pairs sampled for the inversion estimate
+constexpr size_t kInversionSamples = 1024;
+
+namespace detail {
+
+// Number of elements taken from a among the first k outputs of a stable merge of a and b (merge path)
+template <typename T, typename Compare>
+size_t CoRank(size_t k, std::span<const T> a, std::span<const T> b, Compare& comp) {
+  size_t lo = k > b.size() ? k - b.size() : 0;
+  size_t hi = std::min(k, a.size());
+  while (lo < hi) {
+    const size_t mid = lo + ((hi - lo) / 2);
+    if (comp(b[k - mid - 1], a[mid])) {
+      hi = mid;
+    } else {
+      lo = mid + 1;
+    }
+  }
+  return lo;
+}
+
+}  // namespace detail
+
+template <typename T, typename Compare = std::less<>>
+PresortInfo AnalyzePresortedness(std::span<const T> data, size_t num_threads = 1, Compare comp = {}) {
+  PresortInfo info;
+  const size_t n = data.size();
+  if (n < 2) {
+    info.kind = Presortedness::kSorted;
+    return info;
+  }
+
+  // Descents and ascents between neighbours; each block also checks the pair across its right border
+  const size_t threads = detail::UsefulThreads(n, num_threads);
+  const size_t block = (n + threads - 1) / threads;
+  std::vector<size_t> descents(threads, 0);
+  std::vector<size_t> ascents(threads, 0);
+  detail::ParallelFor(threads, threads, [&](size_t t) {
+    const size_t begin = t * block;
+    const size_t end = std::min(n - 1, begin + block);
+    size_t down = 0;
+    size_t up = 0;
+    for (size_t i = begin; i < end; ++i) {
+      down += static_cast<size_t>(comp(data[i + 1], data[i]));
+      up += static_cast<size_t>(comp(data[i], data[i + 1]));
+    }
+    descents[t] = down;
+    ascents[t] = up;
+  });
+  size_t total_descents = 0;
+  size_t total_ascents = 0;
+  for (size_t t = 0; t < threads; ++t) {
+    total_descents += descents[t];
+    total_ascents += ascents[t];
+  }
+  info.runs = total_descents + 1;
+
+  // Fixed seed keeps the estimate reproducible for the same input
+  std::minstd_rand gen(static_cast<std::minstd_rand::result_type>(n));
+  std::uniform_int_distribution<size_t> index(0, n - 1);
+  size_t inversions = 0;
+  size_t pairs = 0;
+  for (size_t s = 0; s < kInversionSamples; ++s) {
+    size_t i = index(gen);
+    size_t j = index(gen);
+    if (i == j) {
+      continue;
+    }
+    if (i > j) {
+      std::swap(i, j);
+    }
+    inversions += static_cast<size_t>(comp(data[j], data[i]));
+    ++pairs;
+  }
+  info.inversion_ratio = pairs == 0 ? 0.0 : static_cast<double>(inversions) / static_cast<double>(pairs);
+
+  if (total_descents == 0) {
+    info.kind = Presortedness::kSorted;
+  } else if (total_ascents == 0) {
+    info.kind = Presortedness::kReversed;
+  } else if (n / info.runs >= kMinAverageRunLength) {
+    info.kind = Presortedness::kLongRuns;
+  } else {
+    info.kind = Presortedness::kUnsorted;
+  }
+  return info;
+}
+
+// Natural merge sort: bottom-up merging of the existing non-decreasing runs, O(n log runs). Large merges are
+// split along the merge path so that every level keeps all threads busy.
+template <typename T, typename Compare = std::less<>>
+void MergeNaturalRuns(std::span<T> data, size_t num_threads = 1, Compare comp = {}) {
+  const size_t n = data.size();
+  std::vector<size_t> bounds{0};
+  for (size_t i = 1; i < n; ++i) {
+    if (comp(data[i], data[i - 1])) {
+      bounds.push_back(i);
+    }
+  }
+  bounds.push_back(n);
+  if (bounds.size() <= 2) {
+    return;
+  }
+
+  std::vector<T> buffer(n);
+  std::span<T> src = data;
+  std::span<T> dst(buffer);
+  const size_t threads = detail::UsefulThreads(n, num_threads);
+  while (bounds.size() > 2) {
+    struct Piece {
+      size_t first, mid, last;  // runs [first, mid) and [mid, last) of src
+      size_t out_begin, out_end;  // output positions relative to first
+    };
+    std::vector<Piece> pieces;
+    std::vector<size_t> next_bounds{0};
+    const size_t merges = (bounds.size() - 1) / 2;
+    const size_t pieces_per_merge = (threads + merges - 1) / merges;
+    for (size_t r = 0; r + 1 < bounds.size(); r += 2) {
+      const size_t first = bounds[r];
+      const size_t mid = bounds[r + 1];
+      const size_t last = r + 2 < bounds.size() ? bounds[r + 2] : mid;
+      const size_t length = last - first;
+      for (size_t p = 0; p < pieces_per_merge; ++p) {
+        pieces.push_back({first, mid, last, length * p / pieces_per_merge, length * (p + 1) / pieces_per_merge});
+      }
+      next_bounds.push_back(last);
+    }
+
+    detail::ParallelFor(pieces.size(), threads, [&](size_t p) {
+      const Piece& piece = pieces[p];
+      const std::span<const T> left(src.data() + piece.first, piece.mid - piece.first);
+      const std::span<const T> right(src.data() + piece.mid, piece.last - piece.mid);
+      const size_t left_begin = detail::CoRank(piece.out_begin, left, right, comp);
+      const size_t left_end = detail::CoRank(piece.out_end, left, right, comp);
+      std::merge(left.begin() + static_cast<std::ptrdiff_t>(left_begin),
+                 left.begin() + static_cast<std::ptrdiff_t>(left_end),
+                 right.begin() + static_cast<std::ptrdiff_t>(piece.out_begin - left_begin),
+                 right.begin() + static_cast<std::ptrdiff_t>(piece.out_end - left_end),
+                 dst.begin() + static_cast<std::ptrdiff_t>(piece.first + piece.out_begin), comp);
+    });
+
+    bounds = std::move(next_bounds);
+    std::swap(src, dst);
+  }
+  if (src.data() != data.data()) {
+    std::ranges::copy(src, data.begin());
+  }
+}
+
+// Pre-pass for sorting tasks. Sorted input is left as is, non-increasing input is reversed and input made of
+// long runs is finished by MergeNaturalRuns. Returns false, without touching data, when none of these apply
+// and the task should run its own kernel.
+template <typename T, typename Compare = std::less<>>
+bool SortIfPresorted(std::span<T> data, size_t num_threads = 1, Compare comp = {}) {
+  const PresortInfo info = AnalyzePresortedness(std::span<const T>(data), num_threads, comp);
+  switch (info.kind) {
+    case Presortedness::kSorted:
+      return true;
+    case Presortedness::kReversed:
+      std::ranges::reverse(data);
+      return true;
+    case Presortedness::kLongRuns:
+      MergeNaturalRuns(data, num_threads, comp);
+      return true;
+    case Presortedness::kUnsorted:
+      return false;
+  }
+  return false;
+}
+
+}  // namespace ppc::sort
@@ -0,0 +1,333 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "core/sort/include/parallel.hpp"
+
+namespace ppc::sort {
+
+template <size_t kBytes>
+struct UnsignedOfSize;
+template <>
+struct UnsignedOfSize<1> {
+  using Type = uint8_t;
+};
+template <>
+struct UnsignedOfSize<2> {
+  using Type = uint16_t;
+};
+template <>
+struct UnsignedOfSize<4> {
+  using Type = uint32_t;
+};
+template <>
+struct UnsignedOfSize<8> {
+  using Type = uint64_t;
+};
+
+// Order-preserving map of a key onto an unsigned integer of the same width: the sign bit of signed integers
+// is flipped, negative floating point numbers are inverted and positive ones get the sign bit set
+template <typename Key>
+struct RadixKeyTraits {
+  static_assert(std::is_arithmetic_v<Key> && !std::is_same_v<Key, bool>, "radix keys must be numbers");
+
+  using Bits = typename UnsignedOfSize<sizeof(Key)>::Type;
+  static constexpr Bits kSignBit = static_cast<Bits>(Bits{1} << ((sizeof(Key) * 8) - 1));
+
+  static constexpr Bits ToBits(Key key) {
+    const auto bits = std::bit_cast<Bits>(key);
+    if constexpr (std::is_floating_point_v<Key>) {
+      return (bits & kSignBit) != 0 ? static_cast<Bits>(~bits) : static_cast<Bits>(bits | kSignBit);
+    } else if constexpr (std::is_signed_v<Key>) {
+      return static_cast<Bits>(bits ^ kSignBit);
+    } else {
+      return bits;
+    }
+  }
+
+  static constexpr Key FromBits(Bits bits) {
+    if constexpr (std::is_floating_point_v<Key>) {
+      const auto restored = (bits & kSignBit) != 0 ? static_cast<Bits>(bits ^ kSignBit) : static_cast<Bits>(~bits);
+      return std::bit_cast<Key>(restored);
+    } else if constexpr (std::is_signed_v<Key>) {
+      return std::bit_cast<Key>(static_cast<Bits>(bits ^ kSignBit));
+    } else {
+      return bits;
+    }
+  }
+};
+
+// Key bits and payload stored side by side, so every radix pass moves a pair with a single write
+template <typename Bits, typename Payload>
+struct RadixRecord {
+  Bits key;
+  Payload payload;
+};
+
+template <typename Key, typename Payload>
+using PairRecord = RadixRecord<typename RadixKeyTraits<Key>::Bits, Payload>;
+
+// Digit width and pass count per key width, fixed at compile time. One- and two-byte keys use byte digits;
+// four- and eight-byte keys use 11-bit digits, so 3 passes replace 4 and 6 replace 8 while the per-thread
+// histogram (2048 counters) still fits in L1.
+template <size_t kBytes>
+struct RadixDigits;
+template <>
+struct RadixDigits<1> {
+  static constexpr unsigned kBits = 8;
+  static constexpr unsigned kPasses = 1;
+};
+template <>
+struct RadixDigits<2> {
+  static constexpr unsigned kBits = 8;
+  static constexpr unsigned kPasses = 2;
+};
+template <>
+struct RadixDigits<4> {
+  static constexpr unsigned kBits = 11;
+  static constexpr unsigned kPasses = 3;
+};
+template <>
+struct RadixDigits<8> {
+  static constexpr unsigned kBits = 11;
+  static constexpr unsigned kPasses = 6;
+};
+
+namespace detail {
+
+// Stable LSD radix sort of items by the unsigned key bits key_of(item), one digit per pass. Every thread
+// histograms and scatters its own block; passes where one digit value holds every item are skipped.
+template <typename Item, typename KeyOf>
+void RadixSortBy(std::span<Item> items, size_t num_threads, KeyOf key_of) {
+  using Bits = std::remove_cvref_t<decltype(key_of(items[0]))>;
+  using Digits = RadixDigits<sizeof(Bits)>;
+  static_assert(std::is_unsigned_v<Bits>, "radix keys are sorted by their unsigned bits");
+  static_assert(Digits::kBits * Digits::kPasses >= sizeof(Bits) * 8, "passes must cover every key bit");
+  constexpr size_t kBuckets = size_t{1} << Digits::kBits;
+  constexpr Bits kMask = static_cast<Bits>(kBuckets - 1);
+
+  const size_t n = items.size();
+  if (n < 2) {
+    return;
+  }
+  const size_t threads = UsefulThreads(n, num_threads);
+  const size_t block = (n + threads - 1) / threads;
+  std::vector<Item> buffer(n);
+  Item* src = items.data();
+  Item* dst = buffer.data();
+  std::vector<std::array<size_t, kBuckets>> offsets(threads);
+
+  for (unsigned pass = 0; pass < Digits::kPasses; ++pass) {
+    const unsigned shift = pass * Digits::kBits;
+    ParallelFor(threads, threads, [&](size_t t) {
+      offsets[t].fill(0);
+      for (size_t i = t * block; i < std::min(n, (t + 1) * block); ++i) {
+        ++offsets[t][(key_of(src[i]) >> shift) & kMask];
+      }
+    });
+
+    size_t position = 0;
+    bool trivial_pass = false;
+    for (size_t digit = 0; digit < kBuckets; ++digit) {
+      size_t digit_count = 0;
+      for (size_t t = 0; t < threads; ++t) {
+        const size_t count = offsets[t][digit];
+        offsets[t][digit] = position;
+        position += count;
+        digit_count += count;
+      }
+      trivial_pass = trivial_pass || digit_count == n;
+    }
+    if (trivial_pass) {
+      continue;
+    }
+
+    ParallelFor(threads, threads, [&](size_t t) {
+      for (size_t i = t * block; i < std::min(n, (t + 1) * block); ++i) {
+        dst[offsets[t][(key_of(src[i]) >> shift) & kMask]++] = src[i];
+      }
+    });
+    std::swap(src, dst);
+  }
+  if (src != items.data()) {
+    std::copy(src, src + n, items.data());
+  }
+}
+
+template <typename Record>
+void RadixSortRecords(std::span<Record> records, size_t num_threads) {
+  RadixSortBy(records, num_threads, [](const Record& record) { return record.key; });
+}
+
+template <typename Key, typename Payload>
+std::vector<PairRecord<Key, Payload>> PackPairs(std::span<const Key> keys, std::span<const Payload> payload,
+                                                size_t threads) {
+  std::vector<PairRecord<Key, Payload>> records(keys.size());
+  const size_t block = (keys.size() + threads - 1) / threads;
+  ParallelFor(threads, threads, [&](size_t t) {
+    for (size_t i = t * block; i < std::min(keys.size(), (t + 1) * block); ++i) {
+      records[i] = {RadixKeyTraits<Key>::ToBits(keys[i]), payload[i]};
+    }
+  });
+  return records;
+}
+
+template <typename Key, typename Payload, typename Record>
+void UnpackPairs(const std::vector<Record>& records, std::span<Key> keys, std::span<Payload> payload,
+                 size_t threads) {
+  const size_t block = (records.size() + threads - 1) / threads;
+  ParallelFor(threads, threads, [&](size_t t) {
+    for (size_t i = t * block; i < std::min(records.size(), (t + 1) * block); ++i) {
+      keys[i] = RadixKeyTraits<Key>::FromBits(records[i].key);
+      payload[i] = records[i].payload;
+    }
+  });
+}
+
+// Merge-split of two sorted blocks: lo receives the lo.size() smallest elements of both and hi the rest, each sorted.
+// The two halves are merged from opposite ends into out_lo and out_hi (the same sizes) and copied back.
+template <typename T, typename Compare>
+void MergeSplit(std::span<T> lo, std::span<T> hi, std::span<T> out_lo, std::span<T> out_hi, Compare comp) {
+  if (lo.empty() || hi.empty() || !comp(hi.front(), lo.back())) {
+    return;
+  }
+  for (size_t k = 0, i = 0, j = 0; k < lo.size(); ++k) {
+    out_lo[k] = j < hi.size() && comp(hi[j], lo[i]) ? hi[j++] : lo[i++];
+  }
+  for (size_t k = hi.size(), i = lo.size(), j = hi.size(); k-- > 0;) {
+    out_hi[k] = i > 0 && (j == 0 || comp(hi[j - 1], lo[i - 1])) ? lo[--i] : hi[--j];
+  }
+  std::ranges::copy(out_lo, lo.begin());
+  std::ranges::copy(out_hi, hi.begin());
+}
+
+// Batcher's odd-even merge exchange (Knuth's Algorithm 5.2.2M) over the sorted blocks [b * block, (b + 1) * block)
+// of data, only the last of which may be shorter. Every comparator of the network is a MergeSplit() of two blocks,
+// so the blocks come out sorted as a whole after O(log^2 blocks) rounds. The comparators of a round touch disjoint
+// blocks and run in parallel. Not stable: equal elements may change their relative order.
+template <typename T, typename Compare>
+void BatcherMergeBlocks(std::span<T> data, size_t block, size_t num_threads, Compare comp) {
+  const size_t blocks = block == 0 ? 0 : (data.size() + block - 1) / block;
+  if (blocks < 2) {
+    return;
+  }
+  std::vector<T> buffer(data.size());
+  auto block_of = [&](std::span<T> span, size_t b) {
+    return span.subspan(b * block, std::min(block, data.size() - (b * block)));
+  };
+  std::vector<size_t> comparators;
+  const size_t top = std::bit_floor(blocks - 1);
+  for (size_t p = top; p > 0; p /= 2) {
+    for (size_t q = top, r = 0, d = p;; d = q - p, q /= 2, r = p) {
+      comparators.clear();
+      for (size_t i = 0; i + d < blocks; ++i) {
+        if ((i & p) == r) {
+          comparators.push_back(i);
+        }
+      }
+      ParallelFor(comparators.size(), num_threads, [&](size_t c) {
+        const size_t i = comparators[c];
+        MergeSplit(block_of(data, i), block_of(data, i + d), block_of(std::span<T>(buffer), i),
+                   block_of(std::span<T>(buffer), i + d), comp);
+      });
+      if (q == p) {
+        break;
+      }
+    }
+  }
+}
+
+}  // namespace detail
+
+// Radix sort of plain keys of any arithmetic type (int32/int64/unsigned/float/double/...). Unsigned keys are
+// sorted in place, other keys go through their order-preserving bits and back.
+template <typename Key>
+void RadixSort(std::span<Key> keys, size_t num_threads = 1) {
+  using Traits = RadixKeyTraits<Key>;
+  using Bits = typename Traits::Bits;
+  auto identity = [](Bits bits) { return bits; };
+  if constexpr (std::is_same_v<Key, Bits>) {
+    detail::RadixSortBy(keys, num_threads, identity);
+  } else {
+    const size_t n = keys.size();
+    const size_t threads = detail::UsefulThreads(n, num_threads);
+    const size_t block = (n + threads - 1) / threads;
+    std::vector<Bits> bits(n);
+    detail::ParallelFor(threads, threads, [&](size_t t) {
+      for (size_t i = t * block; i < std::min(n, (t + 1) * block); ++i) {
+        bits[i] = Traits::ToBits(keys[i]);
+      }
+    });
+    detail::RadixSortBy(std::span<Bits>(bits), threads, identity);
+    detail::ParallelFor(threads, threads, [&](size_t t) {
+      for (size_t i = t * block; i < std::min(n, (t + 1) * block); ++i) {
+        keys[i] = Traits::FromBits(bits[i]);
+      }
+    });
+  }
+}
+
+// Stable radix sort of keys that carries a trivially copyable payload (record id, 32/64-bit value) along
+template <typename Key, typename Payload>
+void RadixSortPairs(std::span<Key> keys, std::span<Payload> payload, size_t num_threads = 1) {
+  static_assert(std::is_trivially_copyable_v<Payload>, "payload is moved by plain copies");
+  const size_t threads = detail::UsefulThreads(keys.size(), num_threads);
+  auto records = detail::PackPairs(std::span<const Key>(keys), std::span<const Payload>(payload), threads);
+  detail::RadixSortRecords(std::span(records), threads);
+  detail::UnpackPairs(records, keys, payload, threads);
+}
+
+// Same pairs, sorted the way the radix + Batcher merge tasks do it: every thread radix-sorts its own chunk and the
+// chunks are combined by Batcher's odd-even merge network, with one merge-split of two chunks per comparator (see
+// detail::BatcherMergeBlocks). Unlike RadixSortPairs() it is not stable: pairs with equal keys may be reordered.
+template <typename Key, typename Payload>
+void RadixBatcherSortPairs(std::span<Key> keys, std::span<Payload> payload, size_t num_threads = 1) {
+  static_assert(std::is_trivially_copyable_v<Payload>, "payload is moved by plain copies");
+  const size_t threads = detail::UsefulThreads(keys.size(), num_threads);
+  auto records = detail::PackPairs(std::span<const Key>(keys), std::span<const Payload>(payload), threads);
+  const size_t chunk = (records.size() + threads - 1) / threads;
+  detail::ParallelFor(threads, threads, [&](size_t t) {
+    const size_t begin = std::min(records.size(), t * chunk);
+    const size_t end = std::min(records.size(), begin + chunk);
+    detail::RadixSortRecords(std::span(records).subspan(begin, end - begin), 1);
+  });
+  using Record = PairRecord<Key, Payload>;
+  detail::BatcherMergeBlocks(std::span(records), chunk, threads,
+                             [](const Record& a, const Record& b) { return a.key < b.key; });
+  detail::UnpackPairs(records, keys, payload, threads);
+}
+
+// Index-only fast path: returns the stable sorting permutation (keys[result[0]] is the smallest key) and never
+// writes keys back. Index can be uint32_t for arrays below 2^32 elements to keep records small.
+template <typename Index = uint32_t, typename Key>
+std::vector<Index> ArgSort(std::span<const Key> keys, size_t num_threads = 1) {
+  static_assert(std::is_unsigned_v<Index>, "permutation indices are unsigned");
+  using Record = PairRecord<Key, Index>;
+  const size_t n = keys.size();
+  const size_t threads = detail::UsefulThreads(n, num_threads);
+  const size_t block = (n + threads - 1) / threads;
+  std::vector<Record> records(n);
+  detail::ParallelFor(threads, threads, [&](size_t t) {
+    for (size_t i = t * block; i < std::min(n, (t + 1) * block); ++i) {
+      records[i] = {RadixKeyTraits<Key>::ToBits(keys[i]), static_cast<Index>(i)};
+    }
+  });
+  detail::RadixSortRecords(std::span(records), threads);
+  std::vector<Index> permutation(n);
+  detail::ParallelFor(threads, threads, [&](size_t t) {
+    for (size_t i = t * block; i < std::min(n, (t + 1) * block); ++i) {
+      permutation[i] = records[i].payload;
+    }
+  });
+  return permutation;
+}
+
+}  // namespace ppc::sort
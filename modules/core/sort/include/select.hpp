@@ -0,0 +1,170 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <random>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "core/sort/include/parallel.hpp"
+
+namespace ppc::sort {
+
+// Elements sampled to pick the two pivots bracketing the wanted rank
+constexpr size_t kSelectSamples = 1024;
+// Pivot distance from the wanted rank, in samples (about sqrt of the sample size)
+constexpr size_t kSelectMargin = 32;
+// Parallel rounds before the rest is left to the sequential introselect
+constexpr size_t kMaxSelectRounds = 16;
+
+namespace detail {
+
+// Stable three-way split of data into [< low), [low..high], (> high) through buffer; returns the region sizes
+template <typename T, typename Compare>
+std::array<size_t, 3> SplitByPivots(std::span<T> data, std::span<T> buffer, const T& low, const T& high,
+                                    size_t threads, Compare& comp) {
+  const size_t n = data.size();
+  const size_t block = (n + threads - 1) / threads;
+  auto region = [&](const T& value) -> size_t {
+    if (comp(value, low)) {
+      return 0;
+    }
+    return comp(high, value) ? 2 : 1;
+  };
+
+  std::vector<std::array<size_t, 3>> offsets(threads);
+  ParallelFor(threads, threads, [&](size_t t) {
+    offsets[t] = {0, 0, 0};
+    for (size_t i = t * block; i < std::min(n, (t + 1) * block); ++i) {
+      ++offsets[t][region(data[i])];
+    }
+  });
+  std::array<size_t, 3> sizes{0, 0, 0};
+  size_t position = 0;
+  for (size_t r = 0; r < 3; ++r) {
+    for (size_t t = 0; t < threads; ++t) {
+      const size_t count = offsets[t][r];
+      offsets[t][r] = position;
+      position += count;
+      sizes[r] += count;
+    }
+  }
+
+  ParallelFor(threads, threads, [&](size_t t) {
+    for (size_t i = t * block; i < std::min(n, (t + 1) * block); ++i) {
+      buffer[offsets[t][region(data[i])]++] = data[i];
+    }
+  });
+  ParallelFor(threads, threads, [&](size_t t) {
+    const size_t begin = std::min(n, t * block);
+    const size_t end = std::min(n, begin + block);
+    std::copy(buffer.begin() + static_cast<std::ptrdiff_t>(begin), buffer.begin() + static_cast<std::ptrdiff_t>(end),
+              data.begin() + static_cast<std::ptrdiff_t>(begin));
+  });
+  return sizes;
+}
+
+}  // namespace detail
+
+// Parallel introselect with the std::nth_element contract: data[nth] ends up holding the element a full sort
+// would put there, nothing before it is greater and nothing after it is smaller. While the range is large,
+// every round samples two pivots around the wanted rank (Floyd-Rivest) and keeps only the region between
+// them, so the range shrinks by an order of magnitude per parallel pass; the rest is a sequential introselect.
+template <typename T, typename Compare = std::less<>>
+void NthElement(std::span<T> data, size_t nth, size_t num_threads = 1, Compare comp = {}) {
+  if (nth >= data.size()) {
+    return;
+  }
+  std::span<T> range = data;
+  size_t target = nth;
+  std::vector<T> buffer;
+  std::minstd_rand gen(static_cast<std::minstd_rand::result_type>(data.size()));
+  for (size_t round = 0; round < kMaxSelectRounds; ++round) {
+    const size_t n = range.size();
+    const size_t threads = detail::UsefulThreads(n, num_threads);
+    if (threads == 1) {
+      break;
+    }
+
+    std::uniform_int_distribution<size_t> index(0, n - 1);
+    std::vector<T> samples(kSelectSamples);
+    std::ranges::generate(samples, [&] { return range[index(gen)]; });
+    std::ranges::sort(samples, comp);
+    const size_t rank = target * kSelectSamples / n;
+    const T low = samples[rank > kSelectMargin ? rank - kSelectMargin : 0];
+    const T high = samples[std::min(kSelectSamples - 1, rank + kSelectMargin)];
+
+    buffer.resize(n);
+    const auto sizes = detail::SplitByPivots(range, std::span<T>(buffer), low, high, threads, comp);
+    if (target < sizes[0]) {
+      range = range.first(sizes[0]);
+    } else if (target < sizes[0] + sizes[1]) {
+      if (!comp(low, high)) {
+        // every element of the middle region equals the pivots
+        return;
+      }
+      if (sizes[1] == n) {
+        break;
+      }
+      range = range.subspan(sizes[0], sizes[1]);
+      target -= sizes[0];
+    } else {
+      target -= sizes[0] + sizes[1];
+      range = range.subspan(sizes[0] + sizes[1]);
+    }
+  }
+  std::nth_element(range.begin(), range.begin() + static_cast<std::ptrdiff_t>(target), range.end(), comp);
+}
+
+// Moves the k smallest elements to the front of data in sorted order, O(n + k log k); the order of the rest is
+// unspecified
+template <typename T, typename Compare = std::less<>>
+void PartialSort(std::span<T> data, size_t k, size_t num_threads = 1, Compare comp = {}) {
+  k = std::min(k, data.size());
+  if (k == 0) {
+    return;
+  }
+  NthElement(data, k - 1, num_threads, comp);
+  std::sort(data.begin(), data.begin() + static_cast<std::ptrdiff_t>(k), comp);
+}
+
+// The k smallest elements of read-only data, sorted. Every thread keeps a bounded max-heap of its best k
+// candidates, so the input is neither copied nor reordered; the heaps are merged at the end.
+template <typename T, typename Compare = std::less<>>
+std::vector<T> TopK(std::span<const T> data, size_t k, size_t num_threads = 1, Compare comp = {}) {
+  const size_t n = data.size();
+  k = std::min(k, n);
+  if (k == 0) {
+    return {};
+  }
+  const size_t threads = detail::UsefulThreads(n, num_threads);
+  const size_t block = (n + threads - 1) / threads;
+  std::vector<std::vector<T>> heaps(threads);
+  detail::ParallelFor(threads, threads, [&](size_t t) {
+    std::vector<T>& heap = heaps[t];
+    heap.reserve(k);
+    for (size_t i = t * block; i < std::min(n, (t + 1) * block); ++i) {
+      if (heap.size() < k) {
+        heap.push_back(data[i]);
+        std::ranges::push_heap(heap, comp);
+      } else if (comp(data[i], heap.front())) {
+        std::ranges::pop_heap(heap, comp);
+        heap.back() = data[i];
+        std::ranges::push_heap(heap, comp);
+      }
+    }
+  });
+
+  std::vector<T> candidates = std::move(heaps[0]);
+  for (size_t t = 1; t < threads; ++t) {
+    candidates.insert(candidates.end(), heaps[t].begin(), heaps[t].end());
+  }
+  PartialSort(std::span<T>(candidates), k, 1, comp);
+  candidates.resize(k);
+  return candidates;
+}
+
+}  // namespace ppc::sort
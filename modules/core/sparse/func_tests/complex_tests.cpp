@@ -0,0 +1,43 @@
+#include <gtest/gtest.h>
+
+#include <complex>
+#include <cstddef>
+#include <vector>
+
+#include "core/sparse/include/complex.hpp"
+
+TEST(sparse_complex, product_matches_std_complex_on_finite_values) {
+  using Complex = std::complex<double>;
+  const std::vector<Complex> values{{1.5, -2.0}, {0.0, 1.0}, {-3.0, 0.0}, {0.25, 0.75}, {0.0, 0.0}};
+  for (const auto& a : values) {
+    for (const auto& b : values) {
+      EXPECT_EQ(ppc::sparse::Product(a, b), a * b);
+    }
+  }
+  EXPECT_EQ(ppc::sparse::Product(3.0, -2.0), -6.0);
+}
+
+TEST(sparse_complex, split_values_keep_their_order) {
+  const std::vector<std::complex<float>> values{{1.0F, 2.0F}, {-3.0F, 0.0F}, {0.0F, -4.0F}};
+  const auto split = ppc::sparse::SplitComplex<float>::FromInterleaved(values);
+  EXPECT_EQ(split.re, (std::vector<float>{1.0F, -3.0F, 0.0F}));
+  EXPECT_EQ(split.im, (std::vector<float>{2.0F, 0.0F, -4.0F}));
+  for (size_t i = 0; i < values.size(); ++i) {
+    EXPECT_EQ(split[i], values[i]);
+  }
+}
+
+TEST(sparse_complex, split_run_sums_match_products) {
+  using Complex = std::complex<double>;
+  using Operand = ppc::sparse::detail::Operand<Complex>;
+  const std::vector<Complex> values{{9.0, 9.0}, {1.5, -2.0}, {0.0, 1.0}, {-3.0, 0.5}, {0.25, 0.75}};
+  const auto split = Operand::Prepare(values);
+  const Complex scale{2.0, -0.5};
+  Operand::Sums sums;
+  Operand::Clear(sums, 4);
+  Operand::AddRun(sums, scale, split, 1, 4);
+  Operand::AddRun(sums, scale, split, 1, 4);
+  for (size_t j = 0; j < 4; ++j) {
+    EXPECT_EQ(Operand::Load(sums, j), 2.0 * ppc::sparse::Product(scale, values[j + 1])) << j;
+  }
+}
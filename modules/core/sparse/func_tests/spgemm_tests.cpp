@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <tuple>
+#include <vector>
+
+#include "core/sparse/include/compressed.hpp"
+#include "core/sparse/include/spgemm.hpp"
+#include "core/util/include/fork_join.hpp"
+
+namespace {
+
+// rows x cols matrix with about density * rows * cols nonzeros, dense and row-major
+std::vector<double> RandomSparse(int rows, int cols, double density, uint64_t seed) {
+  std::mt19937_64 gen(seed);
+  std::uniform_real_distribution<double> value(-1.0, 1.0);
+  std::bernoulli_distribution nonzero(density);
+  std::vector<double> dense(static_cast<size_t>(rows) * cols, 0.0);
+  for (auto& x : dense) {
+    if (nonzero(gen)) {
+      x = value(gen);
+    }
+  }
+  return dense;
+}
+
+// Compresses a row-major dense matrix by rows (CRS) or by columns (CCS)
+template <typename T>
+ppc::sparse::CompressedMatrix<T> Compress(const std::vector<T>& dense, int rows, int cols, bool by_rows) {
+  ppc::sparse::CompressedMatrix<T> matrix;
+  matrix.outer = by_rows ? rows : cols;
+  matrix.inner = by_rows ? cols : rows;
+  matrix.ptr.push_back(0);
+  for (int s = 0; s < matrix.outer; ++s) {
+    for (int i = 0; i < matrix.inner; ++i) {
+      const T& x = by_rows ? dense[(s * cols) + i] : dense[(i * cols) + s];
+      if (x != T{}) {
+        matrix.index.push_back(i);
+        matrix.values.push_back(x);
+      }
+    }
+    matrix.ptr.push_back(static_cast<int>(matrix.index.size()));
+  }
+  return matrix;
+}
+
+template <typename T>
+std::vector<T> DenseProduct(const std::vector<T>& a, const std::vector<T>& b, int m, int n, int k) {
+  std::vector<T> c(static_cast<size_t>(m) * n, T{});
+  for (int i = 0; i < m; ++i) {
+    for (int p = 0; p < k; ++p) {
+      for (int j = 0; j < n; ++j) {
+        c[(i * n) + j] += a[(i * k) + p] * b[(p * n) + j];
+      }
+    }
+  }
+  return c;
+}
+
+// Checks the structure (sorted, in range) and that every stored value matches the dense product
+template <typename T>
+void ExpectMatches(const ppc::sparse::CompressedMatrix<T>& c, const std::vector<T>& dense, int n, bool by_rows) {
+  ASSERT_EQ(c.ptr.size(), static_cast<size_t>(c.outer) + 1);
+  ASSERT_EQ(c.ptr.back(), static_cast<int>(c.index.size()));
+  std::vector<T> unpacked(dense.size(), T{});
+  for (int s = 0; s < c.outer; ++s) {
+    for (int e = c.ptr[s]; e < c.ptr[s + 1]; ++e) {
+      ASSERT_LT(c.index[e], c.inner);
+      if (e > c.ptr[s]) {
+        ASSERT_LT(c.index[e - 1], c.index[e]);
+      }
+      unpacked[by_rows ? (s * n) + c.index[e] : (c.index[e] * n) + s] = c.values[e];
+    }
+  }
+  for (size_t i = 0; i < dense.size(); ++i) {
+    EXPECT_NEAR(std::abs(unpacked[i] - dense[i]), 0.0, 1e-12) << "at " << i;
+  }
+}
+
+void ExpectProductsMatchDense(int m, int n, int k, double density, size_t parts) {
+  const auto a = RandomSparse(m, k, density, (m * 31) + k);
+  const auto b = RandomSparse(k, n, density, (n * 17) + k);
+  const auto expected = DenseProduct(a, b, m, n, k);
+  auto fork_join = [](size_t count, const auto& func) { ppc::util::ThreadForkJoin(count, func); };
+
+  const auto a_crs = Compress(a, m, k, true);
+  const auto b_crs = Compress(b, k, n, true);
+  ExpectMatches(ppc::sparse::MultiplyCrs(a_crs.View(), b_crs.View(), parts, fork_join), expected, n, true);
+
+  const auto a_ccs = Compress(a, m, k, false);
+  const auto b_ccs = Compress(b, k, n, false);
+  ExpectMatches(ppc::sparse::MultiplyCcs(a_ccs.View(), b_ccs.View(), parts, fork_join), expected, n, false);
+}
+
+}  // namespace
+
+TEST(spgemm_tests, matches_dense_product_with_dense_accumulator) {
+  ExpectProductsMatchDense(40, 30, 50, 0.3, 1);
+  ExpectProductsMatchDense(1, 1, 1, 1.0, 1);
+}
+
+TEST(spgemm_tests, matches_dense_product_with_hash_accumulator) {
+  // Few products per slice compared to the slice length
+  ExpectProductsMatchDense(60, 500, 400, 0.005, 1);
+}
+
+TEST(spgemm_tests, hash_accumulator_spreads_power_of_two_strides) {
+  // Every output index is a multiple of the stride, so a hash that keeps the low bits of the product would send all of
+  // them to a few slots; the slices are short next to their length and stay in hash mode
+  for (const int stride : {64, 1024}) {
+    const int k = 256;
+    const int columns = 512;
+    ppc::sparse::CompressedMatrix<double> b;
+    b.outer = k;
+    b.inner = columns * stride;
+    b.ptr.push_back(0);
+    for (int p = 0; p < k; ++p) {
+      for (int j = 0; j < 4; ++j) {
+        b.index.push_back((((p * 4) + (j * 131)) % columns) * stride);
+        b.values.push_back(1.0 + p + j);
+      }
+      std::sort(b.index.end() - 4, b.index.end());
+      b.ptr.push_back(static_cast<int>(b.index.size()));
+    }
+    ppc::sparse::CompressedMatrix<double> a;
+    a.outer = 8;
+    a.inner = k;
+    a.ptr.push_back(0);
+    for (int i = 0; i < a.outer; ++i) {
+      for (int p = i; p < k; p += 8) {
+        a.index.push_back(p);
+        a.values.push_back(0.5 * (i + 1));
+      }
+      a.ptr.push_back(static_cast<int>(a.index.size()));
+    }
+
+    std::vector<double> expected(static_cast<size_t>(a.outer) * columns, 0.0);
+    for (int i = 0; i < a.outer; ++i) {
+      for (int e = a.ptr[i]; e < a.ptr[i + 1]; ++e) {
+        const int p = a.index[e];
+        for (int f = b.ptr[p]; f < b.ptr[p + 1]; ++f) {
+          expected[(i * columns) + (b.index[f] / stride)] += a.values[e] * b.values[f];
+        }
+      }
+    }
+    const auto c = ppc::sparse::MultiplyCrs(a.View(), b.View());
+    std::vector<double> actual(expected.size(), 0.0);
+    for (int i = 0; i < c.outer; ++i) {
+      for (int e = c.ptr[i]; e < c.ptr[i + 1]; ++e) {
+        ASSERT_EQ(c.index[e] % stride, 0);
+        if (e > c.ptr[i]) {
+          ASSERT_LT(c.index[e - 1], c.index[e]);
+        }
+        actual[(i * columns) + (c.index[e] / stride)] = c.values[e];
+      }
+    }
+    EXPECT_EQ(actual, expected) << "stride " << stride;
+  }
+}
+
+TEST(spgemm_tests, parts_split_the_slices) {
+  ExpectProductsMatchDense(97, 61, 80, 0.1, 4);
+  ExpectProductsMatchDense(3, 50, 20, 0.5, 8);
+}
+
+TEST(spgemm_tests, sums_full_slices_in_place) {
+  ExpectProductsMatchDense(20, 30, 25, 1.0, 2);
+  // Mixes full output slices with partial ones
+  ExpectProductsMatchDense(30, 12, 40, 0.2, 2);
+}
+
+TEST(spgemm_tests, split_by_work_balances_skewed_slices) {
+  // Slice 2 holds most of the work
+  const std::vector<size_t> work{0, 1, 2, 92, 93, 94, 95, 96, 97, 98, 99, 100};
+  const auto bounds = ppc::sparse::SplitByWork(work, 4);
+  ASSERT_EQ(bounds.size(), 5U);
+  EXPECT_EQ(bounds.front(), 0);
+  EXPECT_EQ(bounds.back(), 11);
+  // The heavy slice gets a range of its own; the light ones are not spread over the remaining parts one by one
+  EXPECT_EQ(bounds[1], 2);
+  EXPECT_EQ(bounds[2], 3);
+  EXPECT_EQ(bounds[3], 3);
+  EXPECT_TRUE(std::ranges::is_sorted(bounds));
+}
+
+TEST(spgemm_tests, work_prefix_counts_products_per_slice) {
+  // Row 0 of A hits rows 0 and 1 of B (3 products), row 1 hits nothing
+  const std::vector<double> a{1, 1, 0, 0};
+  const std::vector<double> b{1, 1, 0, 1};
+  const auto work = ppc::sparse::WorkPrefix(Compress(a, 2, 2, true).View(), Compress(b, 2, 2, true).View());
+  EXPECT_EQ(work, (std::vector<size_t>{0, 4, 5}));
+}
+
+TEST(spgemm_tests, matches_dense_product_on_power_law_rows) {
+  // A few full rows and columns, everything else nearly empty
+  constexpr int kN = 120;
+  auto a = RandomSparse(kN, kN, 0.02, 7);
+  auto b = RandomSparse(kN, kN, 0.02, 8);
+  for (int j = 0; j < kN; ++j) {
+    a[j] = 1.0 + j;
+    b[(j * kN) + 1] = 0.5;
+  }
+  const auto expected = DenseProduct(a, b, kN, kN, kN);
+  auto fork_join = [](size_t count, const auto& func) { ppc::util::ThreadForkJoin(count, func); };
+  const auto c =
+      ppc::sparse::MultiplyCrs(Compress(a, kN, kN, true).View(), Compress(b, kN, kN, true).View(), 3, fork_join);
+  ExpectMatches(c, expected, kN, true);
+}
+
+TEST(spgemm_tests, handles_empty_operands) {
+  const auto empty = Compress(std::vector<double>(20, 0.0), 4, 5, true);
+  const auto other = Compress(RandomSparse(5, 3, 0.5, 1), 5, 3, true);
+  const auto c = ppc::sparse::MultiplyCrs(empty.View(), other.View());
+  EXPECT_EQ(c.outer, 4);
+  EXPECT_EQ(c.inner, 3);
+  EXPECT_EQ(c.ptr, std::vector<int>(5, 0));
+  EXPECT_TRUE(c.index.empty());
+}
+
+TEST(spgemm_tests, multiplies_complex_values) {
+  using Complex = std::complex<double>;
+  const std::vector<Complex> a{{1, 2}, {0, 0}, {0, 1}, {3, 0}};
+  const std::vector<Complex> b{{2, 0}, {1, 1}, {0, 0}, {0, -1}};
+  const auto c = ppc::sparse::MultiplyCcs(Compress(a, 2, 2, false).View(), Compress(b, 2, 2, false).View());
+  ExpectMatches(c, DenseProduct(a, b, 2, 2, 2), 2, false);
+}
+
+TEST(spgemm_tests, multiplies_complex_values_on_every_accumulator_path) {
+  using Complex = std::complex<double>;
+  auto random_complex = [](int rows, int cols, double density, uint64_t seed) {
+    const auto re = RandomSparse(rows, cols, density, seed);
+    const auto im = RandomSparse(rows, cols, density, seed + 1);
+    std::vector<Complex> dense(re.size());
+    for (size_t i = 0; i < dense.size(); ++i) {
+      dense[i] = {re[i], im[i]};
+    }
+    return dense;
+  };
+  auto fork_join = [](size_t count, const auto& func) { ppc::util::ThreadForkJoin(count, func); };
+  // Full gathered slices added as runs, dense accumulators and hash accumulators
+  for (const auto& [m, n, k, density] : {std::tuple{20, 30, 25, 1.0}, {40, 30, 50, 0.2}, {60, 500, 400, 0.003}}) {
+    const auto a = random_complex(m, k, density, 1);
+    const auto b = random_complex(k, n, density, 3);
+    const auto c =
+        ppc::sparse::MultiplyCrs(Compress(a, m, k, true).View(), Compress(b, k, n, true).View(), 2, fork_join);
+    ExpectMatches(c, DenseProduct(a, b, m, n, k), n, true);
+  }
+}
+
+TEST(spgemm_tests, drops_cancelled_entries) {
+  // Row 0 of the product is (1 - 1, 2) and row 1 is (0, 0)
+  const std::vector<double> a{1, 1, 0, 0};
+  const std::vector<double> b{1, 1, -1, 1};
+  auto c = ppc::sparse::MultiplyCrs(Compress(a, 2, 2, true).View(), Compress(b, 2, 2, true).View());
+  EXPECT_EQ(c.index.size(), 2U);
+  ppc::sparse::DropEntries(c, [](double x) { return x == 0.0; });
+  EXPECT_EQ(c.ptr, (std::vector<int>{0, 1, 1}));
+  EXPECT_EQ(c.index, std::vector<int>{1});
+  EXPECT_EQ(c.values, std::vector<double>{2.0});
+}
+
+TEST(spgemm_tests, views_cover_slice_ranges) {
+  const auto a = RandomSparse(20, 10, 0.3, 5);
+  const auto b = RandomSparse(10, 12, 0.3, 6);
+  const auto a_crs = Compress(a, 20, 10, true);
+  const auto b_crs = Compress(b, 10, 12, true);
+  const auto full = ppc::sparse::MultiplyCrs(a_crs.View(), b_crs.View());
+  const auto part = ppc::sparse::MultiplyCrs(a_crs.View().Slices(5, 15), b_crs.View());
+  ASSERT_EQ(part.outer, 10);
+  for (int s = 0; s < part.outer; ++s) {
+    EXPECT_EQ(part.ptr[s + 1] - part.ptr[s], full.ptr[s + 6] - full.ptr[s + 5]);
+  }
+  EXPECT_EQ(part.index, std::vector<int>(full.index.begin() + full.ptr[5], full.index.begin() + full.ptr[15]));
+}
@@ -0,0 +1,171 @@
+#include <gtest/gtest.h>
+
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "core/sparse/include/compressed.hpp"
+#include "core/sparse/include/spmv.hpp"
+#include "core/util/include/fork_join.hpp"
+
+namespace {
+
+// rows x cols, row-major, about density * cols nonzeros per row; rows listed in full_rows are dense
+template <typename T>
+std::vector<T> RandomDense(int rows, int cols, double density, uint64_t seed, const std::vector<int>& full_rows = {}) {
+  std::mt19937_64 gen(seed);
+  std::uniform_real_distribution<double> value(-1.0, 1.0);
+  std::bernoulli_distribution nonzero(density);
+  std::vector<T> dense(static_cast<size_t>(rows) * cols, T{});
+  for (auto& x : dense) {
+    if (nonzero(gen)) {
+      x = static_cast<T>(value(gen));
+    }
+  }
+  for (int row : full_rows) {
+    for (int j = 0; j < cols; ++j) {
+      dense[(static_cast<size_t>(row) * cols) + j] = static_cast<T>(value(gen));
+    }
+  }
+  return dense;
+}
+
+template <typename T>
+std::vector<T> DenseProduct(const std::vector<T>& a, const std::vector<T>& b, int m, int k, int n) {
+  std::vector<T> c(static_cast<size_t>(m) * n, T{});
+  for (int i = 0; i < m; ++i) {
+    for (int p = 0; p < k; ++p) {
+      for (int j = 0; j < n; ++j) {
+        c[(i * n) + j] += a[(i * k) + p] * b[(p * n) + j];
+      }
+    }
+  }
+  return c;
+}
+
+template <typename T>
+void ExpectNear(const std::vector<T>& actual, const std::vector<T>& expected) {
+  ASSERT_EQ(actual.size(), expected.size());
+  for (size_t i = 0; i < actual.size(); ++i) {
+    EXPECT_NEAR(std::abs(actual[i] - expected[i]), 0.0, 1e-12) << "at " << i;
+  }
+}
+
+// Runs every SpMV and SpMM kernel on the matrix and compares with the dense products
+template <typename T>
+void ExpectKernelsMatchDense(const std::vector<T>& dense, int m, int k, size_t parts) {
+  auto fork_join = [](size_t count, const auto& func) { ppc::util::ThreadForkJoin(count, func); };
+  const auto crs = ppc::sparse::CrsMatrix<T>::FromDense(dense.data(), m, k);
+  const auto ccs = ppc::sparse::CcsMatrix<T>::FromDense(dense.data(), m, k);
+  const auto x = RandomDense<T>(k, 1, 1.0, 3);
+  const auto expected_y = DenseProduct(dense, x, m, k, 1);
+
+  std::vector<T> y(m, T{1});
+  ppc::sparse::SpmvRowSplit<T>(crs.View(), x, y, parts, fork_join);
+  ExpectNear(y, expected_y);
+  y.assign(m, T{1});
+  ppc::sparse::SpmvMergePath<T>(crs.View(), x, y, parts, fork_join);
+  ExpectNear(y, expected_y);
+  y.assign(m, T{1});
+  ppc::sparse::SpmvCrs<T>(crs.View(), x, y, parts, fork_join);
+  ExpectNear(y, expected_y);
+  y.assign(m, T{1});
+  ppc::sparse::SpmvCcs<T>(ccs.View(), x, y, parts, fork_join);
+  ExpectNear(y, expected_y);
+  y.assign(m, T{1});
+  const auto sell = ppc::sparse::SellMatrix<T>::FromCrs(crs.View(), 16);
+  ppc::sparse::SpmvSell<T>(sell, x, y, parts, fork_join);
+  ExpectNear(y, expected_y);
+
+  constexpr int kBlock = 5;
+  const auto b = RandomDense<T>(k, kBlock, 1.0, 4);
+  const auto expected_c = DenseProduct(dense, b, m, k, kBlock);
+  std::vector<T> c(static_cast<size_t>(m) * kBlock, T{1});
+  ppc::sparse::SpmmCrs<T>(crs.View(), b, kBlock, c, parts, fork_join);
+  ExpectNear(c, expected_c);
+  c.assign(c.size(), T{1});
+  ppc::sparse::SpmmCcs<T>(ccs.View(), b, kBlock, c, parts, fork_join);
+  ExpectNear(c, expected_c);
+}
+
+}  // namespace
+
+TEST(spmv_tests, kernels_match_dense_products) {
+  ExpectKernelsMatchDense(RandomDense<double>(70, 50, 0.1, 1), 70, 50, 1);
+  ExpectKernelsMatchDense(RandomDense<double>(70, 50, 0.1, 2), 70, 50, 4);
+  ExpectKernelsMatchDense(RandomDense<double>(3, 40, 0.5, 5), 3, 40, 8);
+}
+
+TEST(spmv_tests, kernels_balance_skewed_rows) {
+  // Two full rows hold most of the entries, so row split alone cannot balance four parts
+  ExpectKernelsMatchDense(RandomDense<double>(200, 150, 0.01, 6, {0, 137}), 200, 150, 4);
+  ExpectKernelsMatchDense(RandomDense<double>(9, 300, 0.0, 7, {4}), 9, 300, 3);
+}
+
+TEST(spmv_tests, kernels_handle_empty_rows_and_matrices) {
+  ExpectKernelsMatchDense(RandomDense<double>(30, 20, 0.0, 8), 30, 20, 3);
+  ExpectKernelsMatchDense(RandomDense<double>(0, 20, 0.1, 9), 0, 20, 2);
+  ExpectKernelsMatchDense(RandomDense<double>(20, 0, 0.1, 10), 20, 0, 2);
+}
+
+TEST(spmv_tests, kernels_multiply_complex_values) {
+  auto dense = RandomDense<std::complex<double>>(40, 30, 0.2, 11);
+  for (size_t i = 0; i < dense.size(); i += 3) {
+    dense[i] *= std::complex<double>(0.5, -2.0);
+  }
+  ExpectKernelsMatchDense(dense, 40, 30, 3);
+}
+
+TEST(spmv_tests, merge_path_splits_one_row_across_parts) {
+  // A single row of 1000 entries shared by seven parts
+  const std::vector<int> ptr = {0, 0, 1000, 1000};
+  std::vector<int> index(1000);
+  std::vector<double> values(1000);
+  for (int e = 0; e < 1000; ++e) {
+    index[e] = e;
+    values[e] = 1.0 + (e % 7);
+  }
+  const ppc::sparse::CompressedView<double> a{.outer = 3, .inner = 1000, .ptr = ptr, .index = index, .values = values};
+  const std::vector<double> x(1000, 2.0);
+  std::vector<double> y(3, -1.0);
+  ppc::sparse::SpmvMergePath<double>(a, x, y, 7,
+                                     [](size_t count, const auto& func) { ppc::util::ThreadForkJoin(count, func); });
+  double expected = 0.0;
+  for (double value : values) {
+    expected += 2.0 * value;
+  }
+  EXPECT_EQ(y, (std::vector<double>{0.0, expected, 0.0}));
+}
+
+TEST(spmv_tests, kernels_take_unsigned_indices) {
+  const std::vector<uint32_t> ptr = {0, 2, 2, 3};
+  const std::vector<uint32_t> index = {1, 2, 0};
+  const std::vector<double> values = {1.0, 2.0, 3.0};
+  const ppc::sparse::CompressedView<double, uint32_t> a{
+      .outer = 3, .inner = 3, .ptr = ptr, .index = index, .values = values};
+  const std::vector<double> x = {1.0, 10.0, 100.0};
+  std::vector<double> y(3);
+  auto fork_join = [](size_t count, const auto& func) { ppc::util::ThreadForkJoin(count, func); };
+  ppc::sparse::SpmvCrs<double>(a, x, y, 2, fork_join);
+  EXPECT_EQ(y, (std::vector<double>{210.0, 0.0, 3.0}));
+  std::fill(y.begin(), y.end(), 0.0);
+  ppc::sparse::SpmvSell<double>(ppc::sparse::SellMatrix<double>::FromCrs(a), x, y, 2, fork_join);
+  EXPECT_EQ(y, (std::vector<double>{210.0, 0.0, 3.0}));
+}
+
+TEST(spmv_tests, sell_pads_chunks_to_their_longest_row) {
+  // Row lengths 1, 3, 0, 2 with chunks of 2 rows and no sorting: chunk widths 3 and 2
+  const auto dense = std::vector<double>{0, 1, 0, 0,  //
+                                         1, 1, 1, 0,  //
+                                         0, 0, 0, 0,  //
+                                         0, 0, 1, 1};
+  const auto crs = ppc::sparse::CrsMatrix<double>::FromDense(dense.data(), 4, 4);
+  const auto unsorted = ppc::sparse::SellMatrix<double, 2>::FromCrs(crs.View(), 1);
+  EXPECT_EQ(unsorted.chunk_ptr, (std::vector<int>{0, 6, 10}));
+  // Sorting the whole matrix puts the rows of length 3 and 2 together: widths 3 and 1
+  const auto sorted = ppc::sparse::SellMatrix<double, 2>::FromCrs(crs.View(), 4);
+  EXPECT_EQ(sorted.chunk_ptr, (std::vector<int>{0, 6, 8}));
+  EXPECT_EQ(sorted.row_of, (std::vector<int>{1, 3, 0, 2}));
+}
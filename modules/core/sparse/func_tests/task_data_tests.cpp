@@ -0,0 +1,105 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "core/sparse/include/compressed.hpp"
+#include "core/sparse/include/spgemm.hpp"
+#include "core/sparse/include/task_data.hpp"
+#include "core/task/include/task.hpp"
+
+namespace {
+
+// 3 x 4, row-major
+const std::vector<double> kDense = {1.0, 0.0, 0.0, 2.0,  //
+                                    0.0, 0.0, 3.0, 0.0,  //
+                                    0.0, 4.0, 0.0, 5.0};
+
+}  // namespace
+
+TEST(sparse_task_data, dense_round_trip_by_rows_and_columns) {
+  const auto crs = ppc::sparse::CrsMatrix<double>::FromDense(kDense.data(), 3, 4);
+  EXPECT_EQ(crs.ptr, (std::vector<int>{0, 2, 3, 5}));
+  EXPECT_EQ(crs.index, (std::vector<int>{0, 3, 2, 1, 3}));
+  const auto ccs = ppc::sparse::CcsMatrix<double>::FromDense(kDense.data(), 3, 4);
+  EXPECT_EQ(ccs.ptr, (std::vector<int>{0, 1, 2, 3, 5}));
+  EXPECT_EQ(ccs.index, (std::vector<int>{0, 2, 1, 0, 2}));
+  EXPECT_EQ(ccs.values, (std::vector<double>{1.0, 4.0, 3.0, 2.0, 5.0}));
+
+  std::vector<double> dense(kDense.size(), -1.0);
+  crs.ToDense(dense.data());
+  EXPECT_EQ(dense, kDense);
+  ccs.ToDense(dense.data());
+  EXPECT_EQ(dense, kDense);
+}
+
+TEST(sparse_task_data, sparse_input_views_the_caller_arrays) {
+  const auto ccs = ppc::sparse::CcsMatrix<double>::FromDense(kDense.data(), 3, 4);
+  const ppc::sparse::CcsMatrix<double> empty;
+  ppc::core::TaskData task_data;
+  ppc::sparse::AddSparseInput(task_data, empty);
+  ppc::sparse::AddSparseInput(task_data, ccs);
+  ASSERT_TRUE(ppc::sparse::IsSparseInput(task_data, 0, ppc::sparse::Layout::kCcs));
+  ASSERT_EQ(task_data.inputs.size(), 2 * ppc::sparse::kSparseInputs);
+  ASSERT_TRUE(ppc::sparse::IsSparseInput(task_data, ppc::sparse::kSparseInputs, ppc::sparse::Layout::kCcs));
+  EXPECT_FALSE(ppc::sparse::IsSparseInput(task_data, ppc::sparse::kSparseInputs, ppc::sparse::Layout::kCrs));
+
+  const auto view = ppc::sparse::SparseInput<double>(task_data, ppc::sparse::kSparseInputs);
+  EXPECT_EQ(view.outer, 4);
+  EXPECT_EQ(view.inner, 3);
+  EXPECT_EQ(view.values.data(), ccs.values.data());
+  EXPECT_EQ(view.index.data(), ccs.index.data());
+  EXPECT_EQ(view.ptr.data(), ccs.ptr.data());
+  EXPECT_EQ(view.ptr.size(), ccs.ptr.size());
+}
+
+TEST(sparse_task_data, validation_rejects_malformed_operands) {
+  auto check = [](const ppc::sparse::CrsMatrix<double>& matrix) {
+    ppc::core::TaskData task_data;
+    ppc::sparse::AddSparseInput(task_data, matrix);
+    return ppc::sparse::IsSparseInput(task_data, 0, ppc::sparse::Layout::kCrs);
+  };
+  const auto good = ppc::sparse::CrsMatrix<double>::FromDense(kDense.data(), 3, 4);
+  EXPECT_TRUE(check(good));
+  EXPECT_TRUE(check({}));
+
+  auto bad = good;
+  bad.index[1] = 4;
+  EXPECT_FALSE(check(bad));
+  bad = good;
+  bad.ptr[1] = 4;
+  EXPECT_FALSE(check(bad));
+  bad = good;
+  bad.ptr.pop_back();
+  EXPECT_FALSE(check(bad));
+  bad = good;
+  bad.values.pop_back();
+  EXPECT_FALSE(check(bad));
+
+  ppc::core::TaskData too_short;
+  too_short.inputs.resize(ppc::sparse::kSparseInputs - 1);
+  too_short.inputs_count.resize(ppc::sparse::kSparseInputs - 1);
+  EXPECT_FALSE(ppc::sparse::IsSparseInput(too_short, 0, ppc::sparse::Layout::kCrs));
+}
+
+TEST(sparse_task_data, sparse_output_receives_the_engine_result) {
+  const auto a = ppc::sparse::CrsMatrix<double>::FromDense(kDense.data(), 3, 4);
+  const std::vector<double> identity = {1.0, 0.0, 0.0, 0.0,  //
+                                        0.0, 1.0, 0.0, 0.0,  //
+                                        0.0, 0.0, 1.0, 0.0,  //
+                                        0.0, 0.0, 0.0, 1.0};
+  const auto b = ppc::sparse::CrsMatrix<double>::FromDense(identity.data(), 4, 4);
+
+  ppc::sparse::CrsMatrix<double> c;
+  ppc::core::TaskData task_data;
+  ppc::sparse::AddSparseOutput(task_data, c);
+  ASSERT_TRUE(ppc::sparse::IsSparseOutput(task_data, 0));
+  EXPECT_FALSE(ppc::sparse::IsSparseOutput(task_data, 1));
+
+  auto& output = ppc::sparse::SparseOutput<double, ppc::sparse::Layout::kCrs>(task_data, 0);
+  output = ppc::sparse::CrsMatrix<double>::FromCompressed(ppc::sparse::MultiplyCrs(a.View(), b.View()));
+  EXPECT_EQ(c.shape.rows, 3);
+  EXPECT_EQ(c.shape.cols, 4);
+  std::vector<double> dense(kDense.size());
+  c.ToDense(dense.data());
+  EXPECT_EQ(dense, kDense);
+}
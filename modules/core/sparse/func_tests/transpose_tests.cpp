@@ -0,0 +1,84 @@
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "core/sparse/include/compressed.hpp"
+#include "core/sparse/include/transpose.hpp"
+#include "core/util/include/fork_join.hpp"
+
+namespace {
+
+// rows x cols, row-major, about density * rows * cols nonzeros; rows listed in full_rows are dense
+std::vector<double> RandomDense(int rows, int cols, double density, uint64_t seed,
+                                const std::vector<int>& full_rows = {}) {
+  std::mt19937_64 gen(seed);
+  std::uniform_real_distribution<double> value(-1.0, 1.0);
+  std::bernoulli_distribution nonzero(density);
+  std::vector<double> dense(static_cast<size_t>(rows) * cols, 0.0);
+  for (auto& x : dense) {
+    if (nonzero(gen)) {
+      x = value(gen);
+    }
+  }
+  for (int row : full_rows) {
+    for (int j = 0; j < cols; ++j) {
+      dense[(static_cast<size_t>(row) * cols) + j] = 1.0 + j;
+    }
+  }
+  return dense;
+}
+
+// The transpose of a CRS matrix holds the arrays of its CCS form
+void ExpectTransposeIsOtherLayout(const std::vector<double>& dense, int rows, int cols, size_t parts) {
+  const auto crs = ppc::sparse::CrsMatrix<double>::FromDense(dense.data(), rows, cols);
+  const auto ccs = ppc::sparse::CcsMatrix<double>::FromDense(dense.data(), rows, cols);
+  const auto transposed = ppc::sparse::Transpose(crs.View(), parts, [](size_t count, const auto& func) {
+    ppc::util::ThreadForkJoin(count, func);
+  });
+  EXPECT_EQ(transposed.outer, cols);
+  EXPECT_EQ(transposed.inner, rows);
+  EXPECT_EQ(transposed.ptr, ccs.ptr);
+  EXPECT_EQ(transposed.index, ccs.index);
+  EXPECT_EQ(transposed.values, ccs.values);
+}
+
+}  // namespace
+
+TEST(sparse_transpose, converts_between_layouts) {
+  ExpectTransposeIsOtherLayout(RandomDense(40, 70, 0.1, 1), 40, 70, 1);
+  ExpectTransposeIsOtherLayout(RandomDense(40, 70, 0.1, 2), 40, 70, 4);
+  ExpectTransposeIsOtherLayout(RandomDense(3, 5, 1.0, 3), 3, 5, 8);
+}
+
+TEST(sparse_transpose, parts_keep_indices_sorted_on_skewed_rows) {
+  ExpectTransposeIsOtherLayout(RandomDense(200, 90, 0.01, 4, {0, 150}), 200, 90, 3);
+}
+
+TEST(sparse_transpose, handles_empty_matrices) {
+  ExpectTransposeIsOtherLayout(RandomDense(30, 20, 0.0, 5), 30, 20, 3);
+  ExpectTransposeIsOtherLayout({}, 0, 20, 2);
+  ExpectTransposeIsOtherLayout({}, 20, 0, 2);
+}
+
+TEST(sparse_transpose, twice_gives_back_the_matrix) {
+  const auto dense = RandomDense(25, 35, 0.2, 6);
+  const auto crs = ppc::sparse::CrsMatrix<double>::FromDense(dense.data(), 25, 35);
+  const auto back = ppc::sparse::Transpose(ppc::sparse::Transpose(crs.View()).View());
+  EXPECT_EQ(back.ptr, crs.ptr);
+  EXPECT_EQ(back.index, crs.index);
+  EXPECT_EQ(back.values, crs.values);
+}
+
+TEST(sparse_transpose, views_cover_slice_ranges) {
+  // Rows 2..5 of the matrix: the transpose has 4 columns numbered from the first row of the window
+  const auto dense = RandomDense(8, 6, 0.5, 7);
+  const auto crs = ppc::sparse::CrsMatrix<double>::FromDense(dense.data(), 8, 6);
+  const auto window = ppc::sparse::Transpose(crs.View().Slices(2, 6));
+  const auto expected = ppc::sparse::CcsMatrix<double>::FromDense(dense.data() + (2 * 6), 4, 6);
+  EXPECT_EQ(window.ptr, expected.ptr);
+  EXPECT_EQ(window.index, expected.index);
+  EXPECT_EQ(window.values, expected.values);
+}
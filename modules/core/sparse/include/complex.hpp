@@ -0,0 +1,110 @@
+#pragma once
+
+#include <complex>
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace ppc::sparse {
+
+// a * b. For complex values this skips the NaN recovery that std::complex's operator* does for C99 Annex G (a
+// branch and a call to __muldc3 per product, which also keeps the loop from vectorizing), i.e. it has
+// -fcx-limited-range semantics but only here rather than for the whole build: infinite operands may give NaN where
+// the checked product would give infinity. The sparse kernels form every product through this.
+template <typename T>
+constexpr T Product(const T& a, const T& b) {
+  return a * b;
+}
+
+template <typename R>
+constexpr std::complex<R> Product(const std::complex<R>& a, const std::complex<R>& b) {
+  return {(a.real() * b.real()) - (a.imag() * b.imag()), (a.real() * b.imag()) + (a.imag() * b.real())};
+}
+
+// Complex values stored as separate real and imaginary arrays (SoA), so a loop over consecutive values loads whole
+// vectors of real parts and of imaginary parts instead of shuffling interleaved pairs
+template <typename R>
+struct SplitComplex {
+  std::vector<R> re;
+  std::vector<R> im;
+
+  static SplitComplex FromInterleaved(std::span<const std::complex<R>> values) {
+    SplitComplex split;
+    split.re.resize(values.size());
+    split.im.resize(values.size());
+    for (size_t i = 0; i < values.size(); ++i) {
+      split.re[i] = values[i].real();
+      split.im[i] = values[i].imag();
+    }
+    return split;
+  }
+
+  [[nodiscard]] std::complex<R> operator[](size_t i) const { return {re[i], im[i]}; }
+};
+
+namespace detail {
+
+// How the sparse kernels read the values of an operand they stream through: real values as they are, complex values
+// split once into a SplitComplex. Add() accumulates one scaled value into an interleaved sum; AddRun() accumulates a
+// run of them into Sums, which for complex values are split too, so the run is plain multiply-adds on whole vectors of
+// real and imaginary parts. Both have Product() semantics.
+template <typename T>
+struct Operand {
+  using Values = std::span<const T>;
+  using Sums = std::vector<T>;
+
+  static Values Prepare(std::span<const T> values) { return values; }
+
+  // Sets count sums to zero
+  static void Clear(Sums& sums, size_t count) { sums.assign(count, T{}); }
+
+  static T Load(const Sums& sums, size_t i) { return sums[i]; }
+
+  // sum += scale * values[g]
+  static void Add(T& sum, const T& scale, const Values& values, size_t g) { sum += Product(scale, values[g]); }
+
+  // sums[j] += scale * values[first + j] for j in [0, count)
+  static void AddRun(Sums& sums, const T& scale, const Values& values, size_t first, size_t count) {
+    T* out = sums.data();
+    const T* run = values.data() + first;
+    for (size_t j = 0; j < count; ++j) {
+      out[j] += Product(scale, run[j]);
+    }
+  }
+};
+
+template <typename R>
+struct Operand<std::complex<R>> {
+  using Values = SplitComplex<R>;
+  using Sums = SplitComplex<R>;
+
+  static Values Prepare(std::span<const std::complex<R>> values) { return Values::FromInterleaved(values); }
+
+  static void Clear(Sums& sums, size_t count) {
+    sums.re.assign(count, R{});
+    sums.im.assign(count, R{});
+  }
+
+  static std::complex<R> Load(const Sums& sums, size_t i) { return sums[i]; }
+
+  static void Add(std::complex<R>& sum, const std::complex<R>& scale, const Values& values, size_t g) {
+    sum += Product(scale, values[g]);
+  }
+
+  static void AddRun(Sums& sums, const std::complex<R>& scale, const Values& values, size_t first, size_t count) {
+    const R scale_re = scale.real();
+    const R scale_im = scale.imag();
+    R* sum_re = sums.re.data();
+    R* sum_im = sums.im.data();
+    const R* re = values.re.data() + first;
+    const R* im = values.im.data() + first;
+    for (size_t j = 0; j < count; ++j) {
+      sum_re[j] += (scale_re * re[j]) - (scale_im * im[j]);
+      sum_im[j] += (scale_re * im[j]) + (scale_im * re[j]);
+    }
+  }
+};
+
+}  // namespace detail
+
+}  // namespace ppc::sparse
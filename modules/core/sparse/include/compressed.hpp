@@ -0,0 +1,123 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace ppc::sparse {
+
+// Read-only view of a compressed sparse matrix: CRS when the slices are rows, CCS when they are columns.
+// Slice s holds the inner indices index[ptr[s]..ptr[s + 1]) and their values; outer is the number of slices and
+// inner the length of each. ptr may be a window of a larger matrix's offsets, so a view can cover a slice range.
+// Index is the integer type of the offsets and indices; the SpGEMM engine takes int, the SpMV/SpMM kernels any.
+template <typename T, typename Index = int>
+struct CompressedView {
+  int outer = 0;
+  int inner = 0;
+  std::span<const Index> ptr;
+  std::span<const Index> index;
+  std::span<const T> values;
+
+  // Slices [first, last) of this matrix
+  [[nodiscard]] CompressedView Slices(int first, int last) const {
+    return {.outer = last - first, .inner = inner, .ptr = ptr.subspan(first, last - first + 1), .index = index,
+            .values = values};
+  }
+};
+
+// Compressed sparse matrix that owns its arrays, laid out as in CompressedView
+template <typename T>
+struct CompressedMatrix {
+  int outer = 0;
+  int inner = 0;
+  std::vector<int> ptr;
+  std::vector<int> index;
+  std::vector<T> values;
+
+  [[nodiscard]] CompressedView<T> View() const {
+    return {.outer = outer, .inner = inner, .ptr = ptr, .index = index, .values = values};
+  }
+};
+
+// Whether the slices of a sparse matrix are its rows (CRS) or its columns (CCS)
+enum class Layout : uint8_t { kCrs, kCcs };
+
+// Dimensions and layout of a sparse matrix
+struct SparseShape {
+  int rows = 0;
+  int cols = 0;
+  Layout layout = Layout::kCrs;
+
+  // Number of slices and length of each
+  [[nodiscard]] int Outer() const { return layout == Layout::kCrs ? rows : cols; }
+  [[nodiscard]] int Inner() const { return layout == Layout::kCrs ? cols : rows; }
+};
+
+// Sparse matrix that knows its shape, compressed by rows (CrsMatrix) or by columns (CcsMatrix). The arrays are laid
+// out as in CompressedView with shape.Outer() slices; a default-constructed matrix is 0 x 0.
+template <typename T, Layout L>
+struct SparseMatrix {
+  SparseShape shape{.rows = 0, .cols = 0, .layout = L};
+  std::vector<int> ptr{0};
+  std::vector<int> index;
+  std::vector<T> values;
+
+  [[nodiscard]] CompressedView<T> View() const {
+    return {.outer = shape.Outer(), .inner = shape.Inner(), .ptr = ptr, .index = index, .values = values};
+  }
+
+  // Takes over the arrays of an engine result whose slices are rows for kCrs and columns for kCcs
+  static SparseMatrix FromCompressed(CompressedMatrix<T>&& compressed) {
+    SparseMatrix matrix;
+    matrix.shape.rows = L == Layout::kCrs ? compressed.outer : compressed.inner;
+    matrix.shape.cols = L == Layout::kCrs ? compressed.inner : compressed.outer;
+    matrix.ptr = std::move(compressed.ptr);
+    matrix.index = std::move(compressed.index);
+    matrix.values = std::move(compressed.values);
+    return matrix;
+  }
+
+  // Compresses a row-major rows x cols matrix, leaving out its zeros
+  static SparseMatrix FromDense(const T* data, int rows, int cols) {
+    SparseMatrix matrix;
+    matrix.shape.rows = rows;
+    matrix.shape.cols = cols;
+    const int outer = matrix.shape.Outer();
+    const int inner = matrix.shape.Inner();
+    matrix.ptr.reserve(static_cast<size_t>(outer) + 1);
+    for (int s = 0; s < outer; ++s) {
+      for (int i = 0; i < inner; ++i) {
+        const T& x = L == Layout::kCrs ? data[(static_cast<size_t>(s) * cols) + i]
+                                       : data[(static_cast<size_t>(i) * cols) + s];
+        if (x != T{}) {
+          matrix.index.push_back(i);
+          matrix.values.push_back(x);
+        }
+      }
+      matrix.ptr.push_back(static_cast<int>(matrix.index.size()));
+    }
+    return matrix;
+  }
+
+  // Writes the matrix to a row-major array of shape.rows * shape.cols elements
+  void ToDense(T* data) const {
+    std::fill(data, data + (static_cast<size_t>(shape.rows) * shape.cols), T{});
+    for (int s = 0; s < shape.Outer(); ++s) {
+      for (int e = ptr[s]; e < ptr[s + 1]; ++e) {
+        const auto row = static_cast<size_t>(L == Layout::kCrs ? s : index[e]);
+        const auto col = static_cast<size_t>(L == Layout::kCrs ? index[e] : s);
+        data[(row * shape.cols) + col] = values[e];
+      }
+    }
+  }
+};
+
+template <typename T>
+using CrsMatrix = SparseMatrix<T, Layout::kCrs>;
+template <typename T>
+using CcsMatrix = SparseMatrix<T, Layout::kCcs>;
+
+}  // namespace ppc::sparse
@@ -0,0 +1,276 @@
+#pragma once
+
+#include <mpi.h>
+
+#include <algorithm>
+#include <boost/mpi/communicator.hpp>
+#include <cstddef>
+#include <numeric>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "core/sparse/include/compressed.hpp"
+#include "core/sparse/include/spgemm.hpp"
+
+namespace ppc::sparse {
+
+// Compressed matrix spread over the ranks of a communicator by consecutive slice ranges: rank r holds slices
+// [bounds[r], bounds[r + 1]) as local, which has bounds[r + 1] - bounds[r] slices of the full inner length.
+// bounds has one entry per rank plus one and is the same on every rank.
+template <typename T>
+struct DistributedMatrix {
+  std::vector<int> bounds;
+  CompressedMatrix<T> local;
+
+  [[nodiscard]] int Outer() const { return bounds.back(); }
+};
+
+// Bounds that give each of parts ranks slice ranges of nearly equal entry count, for SplitByWork()
+template <typename T>
+std::vector<int> SplitByEntries(const CompressedView<T>& matrix, size_t parts) {
+  return SplitByWork(detail::EntryPrefix(matrix), parts);
+}
+
+namespace detail {
+
+// MPI datatype of one T sent as its bytes. Values are only copied, never reduced, so this covers std::complex too,
+// which Boost.MPI has no datatype for.
+template <typename T>
+class BytesType {
+  static_assert(std::is_trivially_copyable_v<T>);
+
+ public:
+  BytesType() {
+    MPI_Type_contiguous(static_cast<int>(sizeof(T)), MPI_BYTE, &type_);
+    MPI_Type_commit(&type_);
+  }
+  ~BytesType() { MPI_Type_free(&type_); }
+  BytesType(const BytesType&) = delete;
+  BytesType& operator=(const BytesType&) = delete;
+  BytesType(BytesType&&) = delete;
+  BytesType& operator=(BytesType&&) = delete;
+
+  [[nodiscard]] MPI_Datatype Get() const { return type_; }
+
+ private:
+  MPI_Datatype type_{};
+};
+
+// Exclusive prefix sum of per-rank counts, i.e. the displacements of a v-collective
+inline std::vector<int> Displacements(const std::vector<int>& counts) {
+  std::vector<int> displacements(counts.size(), 0);
+  if (!counts.empty()) {
+    std::partial_sum(counts.begin(), counts.end() - 1, displacements.begin() + 1);
+  }
+  return displacements;
+}
+
+}  // namespace detail
+
+// Spreads a matrix held by root over world, rank r receiving slices [bounds[r], bounds[r + 1]). matrix and bounds
+// (world.size() + 1 entries, e.g. from SplitByWork()) are only read on root.
+template <typename T>
+DistributedMatrix<T> Scatter(const boost::mpi::communicator& world, const CompressedView<T>& matrix,
+                             std::vector<int> bounds, int root = 0) {
+  const auto comm = static_cast<MPI_Comm>(world);
+  const int size = world.size();
+  const int rank = world.rank();
+  const detail::BytesType<T> value_type;
+  bounds.resize(size + 1);
+  MPI_Bcast(bounds.data(), size + 1, MPI_INT, root, comm);
+  int inner = matrix.inner;
+  MPI_Bcast(&inner, 1, MPI_INT, root, comm);
+
+  std::vector<int> lengths;
+  std::vector<int> slice_counts(size);
+  std::vector<int> entry_counts(size);
+  std::vector<int> entry_displacements(size);
+  const int* index = nullptr;
+  const T* values = nullptr;
+  if (rank == root) {
+    lengths.resize(bounds[size]);
+    for (int s = 0; s < bounds[size]; ++s) {
+      lengths[s] = matrix.ptr[s + 1] - matrix.ptr[s];
+    }
+    for (int r = 0; r < size; ++r) {
+      slice_counts[r] = bounds[r + 1] - bounds[r];
+      entry_counts[r] = matrix.ptr[bounds[r + 1]] - matrix.ptr[bounds[r]];
+      entry_displacements[r] = matrix.ptr[bounds[r]] - matrix.ptr[0];
+    }
+    index = matrix.index.data() + matrix.ptr[0];
+    values = matrix.values.data() + matrix.ptr[0];
+  }
+
+  DistributedMatrix<T> result;
+  auto& local = result.local;
+  local.outer = bounds[rank + 1] - bounds[rank];
+  local.inner = inner;
+  local.ptr.assign(local.outer + 1, 0);
+  MPI_Scatterv(lengths.data(), slice_counts.data(), bounds.data(), MPI_INT, local.ptr.data() + 1, local.outer,
+               MPI_INT, root, comm);
+  std::partial_sum(local.ptr.begin(), local.ptr.end(), local.ptr.begin());
+  const int entries = local.ptr.back();
+  local.index.resize(entries);
+  local.values.resize(entries);
+  MPI_Scatterv(index, entry_counts.data(), entry_displacements.data(), MPI_INT, local.index.data(), entries, MPI_INT,
+               root, comm);
+  MPI_Scatterv(values, entry_counts.data(), entry_displacements.data(), value_type.Get(), local.values.data(),
+               entries, value_type.Get(), root, comm);
+  result.bounds = std::move(bounds);
+  return result;
+}
+
+// Collects a DistributedMatrix on root, in the order of its slices. Other ranks get an empty matrix.
+template <typename T>
+CompressedMatrix<T> Gather(const boost::mpi::communicator& world, const DistributedMatrix<T>& matrix, int root = 0) {
+  const auto comm = static_cast<MPI_Comm>(world);
+  const int size = world.size();
+  const int rank = world.rank();
+  const detail::BytesType<T> value_type;
+  const auto& local = matrix.local;
+
+  std::vector<int> lengths(local.outer);
+  for (int s = 0; s < local.outer; ++s) {
+    lengths[s] = local.ptr[s + 1] - local.ptr[s];
+  }
+  int entries = local.ptr.back();
+  std::vector<int> slice_counts(size);
+  std::vector<int> entry_counts(size);
+  for (int r = 0; r < size; ++r) {
+    slice_counts[r] = matrix.bounds[r + 1] - matrix.bounds[r];
+  }
+  MPI_Gather(&entries, 1, MPI_INT, entry_counts.data(), 1, MPI_INT, root, comm);
+  const auto entry_displacements = detail::Displacements(entry_counts);
+
+  CompressedMatrix<T> result;
+  if (rank == root) {
+    result.outer = matrix.Outer();
+    result.inner = local.inner;
+    result.ptr.assign(result.outer + 1, 0);
+    result.index.resize(entry_displacements.back() + entry_counts.back());
+    result.values.resize(result.index.size());
+  }
+  MPI_Gatherv(lengths.data(), local.outer, MPI_INT, result.ptr.data() + (rank == root ? 1 : 0), slice_counts.data(),
+              matrix.bounds.data(), MPI_INT, root, comm);
+  MPI_Gatherv(local.index.data(), entries, MPI_INT, result.index.data(), entry_counts.data(),
+              entry_displacements.data(), MPI_INT, root, comm);
+  MPI_Gatherv(local.values.data(), entries, value_type.Get(), result.values.data(), entry_counts.data(),
+              entry_displacements.data(), value_type.Get(), root, comm);
+  std::partial_sum(result.ptr.begin(), result.ptr.end(), result.ptr.begin());
+  return result;
+}
+
+// Gustavson() on slice-distributed operands. Result slice s is the sum of the gathered slices selected by driver
+// slice s and stays on the rank that holds driver slice s, so the result has the bounds of driver.
+// Each rank lists the distinct gathered slices its driver slices select and fetches exactly those from the ranks
+// holding them with two all-to-alls (slice lengths, then entries); nothing is broadcast or replicated. Besides its
+// own slices of both operands and of the result, a rank holds the slices it fetched and two arrays of
+// gathered.Outer() + 1 entries, so memory per rank follows the nonzeros its slices touch rather than the total.
+// parts and fork_join run the local product as in Gustavson().
+template <typename T, typename ForkJoin>
+DistributedMatrix<T> DistributedGustavson(const boost::mpi::communicator& world, const DistributedMatrix<T>& driver,
+                                          const DistributedMatrix<T>& gathered, size_t parts, ForkJoin&& fork_join) {
+  const auto comm = static_cast<MPI_Comm>(world);
+  const int size = world.size();
+  const int rank = world.rank();
+  const detail::BytesType<T> value_type;
+  const int slices = gathered.Outer();
+  const auto& own = gathered.local;
+  const int own_first = gathered.bounds[rank];
+
+  // Ascending, hence grouped by the rank that holds them
+  std::vector<unsigned char> selected(slices, 0);
+  for (const int k : driver.local.index) {
+    selected[k] = 1;
+  }
+  std::vector<int> wanted;
+  for (int k = 0; k < slices; ++k) {
+    if (selected[k] != 0) {
+      wanted.push_back(k);
+    }
+  }
+  std::vector<int> want_counts(size);
+  for (int r = 0; r < size; ++r) {
+    want_counts[r] = static_cast<int>(std::lower_bound(wanted.begin(), wanted.end(), gathered.bounds[r + 1]) -
+                                      std::lower_bound(wanted.begin(), wanted.end(), gathered.bounds[r]));
+  }
+  const auto want_displacements = detail::Displacements(want_counts);
+  std::vector<int> asked_counts(size);
+  MPI_Alltoall(want_counts.data(), 1, MPI_INT, asked_counts.data(), 1, MPI_INT, comm);
+  const auto asked_displacements = detail::Displacements(asked_counts);
+  std::vector<int> asked(asked_displacements.back() + asked_counts.back());
+  MPI_Alltoallv(wanted.data(), want_counts.data(), want_displacements.data(), MPI_INT, asked.data(),
+                asked_counts.data(), asked_displacements.data(), MPI_INT, comm);
+
+  // The asked slices, packed per asking rank in the order they were asked for
+  std::vector<int> asked_lengths(asked.size());
+  std::vector<int> send_counts(size, 0);
+  for (int r = 0; r < size; ++r) {
+    for (int i = asked_displacements[r]; i < asked_displacements[r] + asked_counts[r]; ++i) {
+      const int k = asked[i] - own_first;
+      asked_lengths[i] = own.ptr[k + 1] - own.ptr[k];
+      send_counts[r] += asked_lengths[i];
+    }
+  }
+  const auto send_displacements = detail::Displacements(send_counts);
+  std::vector<int> send_index(send_displacements.back() + send_counts.back());
+  std::vector<T> send_values(send_index.size());
+  int packed = 0;
+  for (const int slice : asked) {
+    const int k = slice - own_first;
+    std::copy(own.index.begin() + own.ptr[k], own.index.begin() + own.ptr[k + 1], send_index.begin() + packed);
+    std::copy(own.values.begin() + own.ptr[k], own.values.begin() + own.ptr[k + 1], send_values.begin() + packed);
+    packed += own.ptr[k + 1] - own.ptr[k];
+  }
+
+  std::vector<int> wanted_lengths(wanted.size());
+  MPI_Alltoallv(asked_lengths.data(), asked_counts.data(), asked_displacements.data(), MPI_INT,
+                wanted_lengths.data(), want_counts.data(), want_displacements.data(), MPI_INT, comm);
+  std::vector<int> receive_counts(size, 0);
+  for (int r = 0; r < size; ++r) {
+    for (int i = want_displacements[r]; i < want_displacements[r] + want_counts[r]; ++i) {
+      receive_counts[r] += wanted_lengths[i];
+    }
+  }
+  const auto receive_displacements = detail::Displacements(receive_counts);
+
+  // Slices that were not fetched are left empty; the driver never selects them
+  CompressedMatrix<T> fetched;
+  fetched.outer = slices;
+  fetched.inner = own.inner;
+  fetched.ptr.assign(slices + 1, 0);
+  for (size_t i = 0; i < wanted.size(); ++i) {
+    fetched.ptr[wanted[i] + 1] = wanted_lengths[i];
+  }
+  std::partial_sum(fetched.ptr.begin(), fetched.ptr.end(), fetched.ptr.begin());
+  fetched.index.resize(fetched.ptr.back());
+  fetched.values.resize(fetched.ptr.back());
+  MPI_Alltoallv(send_index.data(), send_counts.data(), send_displacements.data(), MPI_INT, fetched.index.data(),
+                receive_counts.data(), receive_displacements.data(), MPI_INT, comm);
+  MPI_Alltoallv(send_values.data(), send_counts.data(), send_displacements.data(), value_type.Get(),
+                fetched.values.data(), receive_counts.data(), receive_displacements.data(), value_type.Get(), comm);
+
+  DistributedMatrix<T> result;
+  result.bounds = driver.bounds;
+  result.local = Gustavson(driver.local.View(), fetched.View(), parts, fork_join);
+  return result;
+}
+
+// C = A * B for CRS matrices spread by rows: each rank computes the rows of C for its rows of A from the rows of B
+// they select
+template <typename T, typename ForkJoin>
+DistributedMatrix<T> MultiplyCrs(const boost::mpi::communicator& world, const DistributedMatrix<T>& a,
+                                 const DistributedMatrix<T>& b, size_t parts, ForkJoin&& fork_join) {
+  return DistributedGustavson(world, a, b, parts, fork_join);
+}
+
+// C = A * B for CCS matrices spread by columns: each rank computes the columns of C for its columns of B from the
+// columns of A they select
+template <typename T, typename ForkJoin>
+DistributedMatrix<T> MultiplyCcs(const boost::mpi::communicator& world, const DistributedMatrix<T>& a,
+                                 const DistributedMatrix<T>& b, size_t parts, ForkJoin&& fork_join) {
+  return DistributedGustavson(world, b, a, parts, fork_join);
+}
+
+}  // namespace ppc::sparse
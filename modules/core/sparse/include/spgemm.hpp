@@ -0,0 +1,348 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+#include "core/sparse/include/complex.hpp"
+#include "core/sparse/include/compressed.hpp"
+#include "core/util/include/fork_join.hpp"
+
+namespace ppc::sparse {
+
+// An output slice whose product count times this is below the slice length is summed in a hash table instead of a
+// dense array of the slice length
+constexpr size_t kHashAccumulatorRatio = 16;
+
+namespace detail {
+
+// Sums the products of one output slice at a time. Sums live in a dense array of the slice length or, for slices with
+// few products compared to their length, in a small open-addressing table that stays in L1. Either way the touched
+// indices are listed, so starting the next slice costs nothing beyond its own products. A slice known to be full is
+// summed in the dense array without tracking indices, and full gathered slices add into a separate Operand<T>::Sums
+// array as contiguous runs. For complex values that array keeps real and imaginary sums apart so runs vectorize, while
+// scattered sums stay interleaved, where one complex add touches one cache line instead of two.
+template <typename T>
+class Accumulator {
+ public:
+  using Operand = detail::Operand<T>;
+
+  explicit Accumulator(int inner) : inner_(static_cast<size_t>(inner)) {}
+
+  // Starts a slice that will receive at most products additions
+  void Begin(size_t products) {
+    touched_.clear();
+    full_ = false;
+    hashed_ = products * kHashAccumulatorRatio < inner_;
+    if (hashed_) {
+      const size_t capacity = std::bit_ceil(std::max<size_t>(2 * products, 8));
+      keys_.assign(capacity, kEmpty);
+      hashed_sums_.resize(capacity);
+      mask_ = capacity - 1;
+      shift_ = 32 - std::countr_zero(capacity);
+      return;
+    }
+    AllocateDense();
+    ++slice_;
+  }
+
+  // Starts a slice that touches every index
+  void BeginFull() {
+    full_ = true;
+    hashed_ = false;
+    runs_ = false;
+    AllocateDense();
+    std::ranges::fill(dense_sums_, T{});
+  }
+
+  // Marks index as touched without adding to it
+  void Touch(int index) { Sum(index); }
+
+  // Sum at index += scale * values[g]
+  void Add(int index, const T& scale, const typename Operand::Values& values, size_t g) {
+    Operand::Add(full_ ? dense_sums_[index] : Sum(index), scale, values, g);
+  }
+
+  // Sums at every index += scale * values[first + index]; only for full slices
+  void AddRun(const T& scale, const typename Operand::Values& values, size_t first) {
+    if (!runs_) {
+      Operand::Clear(run_sums_, inner_);
+      runs_ = true;
+    }
+    Operand::AddRun(run_sums_, scale, values, first, inner_);
+  }
+
+  // Distinct indices touched by the slice so far
+  [[nodiscard]] size_t Size() const { return full_ ? inner_ : touched_.size(); }
+
+  // Writes the touched indices in ascending order and their sums
+  void Flush(int* index, T* values) {
+    if (full_) {
+      for (size_t i = 0; i < inner_; ++i) {
+        index[i] = static_cast<int>(i);
+        values[i] = runs_ ? dense_sums_[i] + Operand::Load(run_sums_, i) : dense_sums_[i];
+      }
+      return;
+    }
+    std::ranges::sort(touched_);
+    for (size_t i = 0; i < touched_.size(); ++i) {
+      index[i] = touched_[i];
+      values[i] = Sum(touched_[i]);
+    }
+  }
+
+ private:
+  static constexpr int kEmpty = -1;
+
+  void AllocateDense() {
+    if (dense_sums_.empty()) {
+      dense_sums_.resize(inner_);
+      marks_.assign(inner_, 0);
+    }
+  }
+
+  // Sum at index, zero-initialized the first time the slice touches index
+  T& Sum(int index) {
+    if (!hashed_) {
+      if (marks_[index] != slice_) {
+        marks_[index] = slice_;
+        dense_sums_[index] = T{};
+        touched_.push_back(index);
+      }
+      return dense_sums_[index];
+    }
+    // Multiplicative (Fibonacci) hash: the high bits of the product depend on every bit of index, the low bits only on
+    // its low bits, so indices with a common power-of-two stride would share a handful of low-bit slots
+    size_t slot = (static_cast<uint32_t>(index) * 2654435761U) >> shift_;
+    while (keys_[slot] != index) {
+      if (keys_[slot] == kEmpty) {
+        keys_[slot] = index;
+        hashed_sums_[slot] = T{};
+        touched_.push_back(index);
+        break;
+      }
+      slot = (slot + 1) & mask_;
+    }
+    return hashed_sums_[slot];
+  }
+
+  size_t inner_;
+  std::vector<int> touched_;
+  bool hashed_ = false;
+  // Dense mode: marks_[i] == slice_ when index i was touched by the current slice
+  std::vector<T> dense_sums_;
+  std::vector<size_t> marks_;
+  size_t slice_ = 0;
+  // Full mode: the sums are dense_sums_ plus, once a run was added, run_sums_
+  bool full_ = false;
+  bool runs_ = false;
+  typename Operand::Sums run_sums_;
+  // Hash mode
+  std::vector<int> keys_;
+  std::vector<T> hashed_sums_;
+  size_t mask_ = 0;
+  int shift_ = 32;
+};
+
+}  // namespace detail
+
+// Running total of the work of each output slice of Gustavson(driver, gathered): slice s takes
+// work[s + 1] - work[s] units, one per product plus one for the slice itself. The products are the flops of the
+// slice, and on power-law inputs a few slices take most of them.
+template <typename T>
+std::vector<size_t> WorkPrefix(const CompressedView<T>& driver, const CompressedView<T>& gathered) {
+  std::vector<size_t> work(static_cast<size_t>(driver.outer) + 1, 0);
+  for (int s = 0; s < driver.outer; ++s) {
+    size_t products = 1;
+    for (int e = driver.ptr[s]; e < driver.ptr[s + 1]; ++e) {
+      const int k = driver.index[e];
+      products += static_cast<size_t>(gathered.ptr[k + 1] - gathered.ptr[k]);
+    }
+    work[s + 1] = work[s] + products;
+  }
+  return work;
+}
+
+namespace detail {
+
+// WorkPrefix() of a single matrix: one unit per entry plus one per slice
+template <typename T, typename Index>
+std::vector<size_t> EntryPrefix(const CompressedView<T, Index>& a) {
+  std::vector<size_t> work(static_cast<size_t>(a.outer) + 1, 0);
+  for (int s = 0; s < a.outer; ++s) {
+    work[s + 1] = work[s] + static_cast<size_t>(a.ptr[s + 1] - a.ptr[s]) + 1;
+  }
+  return work;
+}
+
+}  // namespace detail
+
+// Cuts the slices into parts consecutive ranges of nearly equal work, given their WorkPrefix(). Returns parts + 1
+// boundaries; range p is [bounds[p], bounds[p + 1]) and may be empty when one slice outweighs a whole share.
+inline std::vector<int> SplitByWork(const std::vector<size_t>& work, size_t parts) {
+  std::vector<int> bounds(parts + 1, 0);
+  const size_t total = work.back();
+  for (size_t p = 1; p < parts; ++p) {
+    // The boundary whose running total is closest to the ideal share
+    const size_t target = total * p / parts;
+    auto bound = std::lower_bound(work.begin(), work.end(), target);
+    if (bound != work.begin() && target - *(bound - 1) < *bound - target) {
+      --bound;
+    }
+    bounds[p] = std::max(static_cast<int>(bound - work.begin()), bounds[p - 1]);
+  }
+  bounds[parts] = static_cast<int>(work.size() - 1);
+  return bounds;
+}
+
+// Ranges of equal work each worker of Gustavson() is split into. Workers take the next free range when they finish
+// one, so a range that turns out slower than its product count suggests (cache misses, long output slices) does not
+// hold the others up.
+constexpr size_t kSpgemmRangesPerPart = 8;
+
+namespace detail {
+
+// Runs body(s) for every slice, on parts workers that claim work-balanced ranges of slices from a shared counter.
+// body gets the worker index too, so per-worker state needs no locking.
+template <typename ForkJoin, typename Body>
+void ForEachSlice(const std::vector<int>& ranges, size_t parts, ForkJoin&& fork_join, const Body& body) {
+  std::atomic<size_t> next{0};
+  fork_join(parts, [&](size_t p) {
+    for (size_t r = next.fetch_add(1); r + 1 < ranges.size(); r = next.fetch_add(1)) {
+      for (int s = ranges[r]; s < ranges[r + 1]; ++s) {
+        body(p, s);
+      }
+    }
+  });
+}
+
+}  // namespace detail
+
+// Row-by-row (Gustavson) sparse product: output slice s is the sum of gathered slices k scaled by the entries (s, k)
+// of driver, so driver.inner must equal gathered.outer and the result has driver.outer slices of length
+// gathered.inner. A symbolic pass counts every output slice exactly, a numeric pass fills the preallocated arrays,
+// and the work is proportional to the number of products rather than to the matrix dimensions. Slices that turn out
+// full stop counting early and are summed in place. Output indices are sorted; entries that sum to zero are kept
+// (see DropEntries). T must commute under multiplication (real or complex numbers); complex products are formed as
+// in Product() from a split copy of the gathered values.
+// parts workers with one accumulator each share the slices, cut by SplitByWork() into kSpgemmRangesPerPart ranges
+// per worker and claimed dynamically. fork_join(count, func) must call func(i) for every i in [0, count), possibly
+// concurrently, and return once all calls are done.
+template <typename T, typename ForkJoin>
+CompressedMatrix<T> Gustavson(const CompressedView<T>& driver, const CompressedView<T>& gathered, size_t parts,
+                              ForkJoin&& fork_join) {
+  CompressedMatrix<T> result;
+  result.outer = driver.outer;
+  result.inner = gathered.inner;
+  result.ptr.assign(static_cast<size_t>(driver.outer) + 1, 0);
+  if (driver.outer == 0) {
+    return result;
+  }
+  parts = std::clamp<size_t>(parts, 1, static_cast<size_t>(driver.outer));
+  const auto work = WorkPrefix(driver, gathered);
+  const auto ranges = SplitByWork(work, parts * kSpgemmRangesPerPart);
+  std::vector<detail::Accumulator<T>> accumulators(parts, detail::Accumulator<T>(gathered.inner));
+
+  detail::ForEachSlice(ranges, parts, fork_join, [&](size_t p, int s) {
+    auto& accumulator = accumulators[p];
+    accumulator.Begin(work[s + 1] - work[s] - 1);
+    for (int e = driver.ptr[s]; e < driver.ptr[s + 1]; ++e) {
+      const int k = driver.index[e];
+      for (int g = gathered.ptr[k]; g < gathered.ptr[k + 1]; ++g) {
+        accumulator.Touch(gathered.index[g]);
+      }
+      if (accumulator.Size() == static_cast<size_t>(gathered.inner)) {
+        break;
+      }
+    }
+    result.ptr[s + 1] = static_cast<int>(accumulator.Size());
+  });
+  std::partial_sum(result.ptr.begin(), result.ptr.end(), result.ptr.begin());
+  result.index.resize(result.ptr.back());
+  result.values.resize(result.ptr.back());
+
+  const auto gathered_values = detail::Operand<T>::Prepare(gathered.values);
+  detail::ForEachSlice(ranges, parts, fork_join, [&](size_t p, int s) {
+    auto& accumulator = accumulators[p];
+    if (result.ptr[s + 1] - result.ptr[s] == gathered.inner) {
+      // The slice is full, so it needs no index tracking, and full gathered slices add in as contiguous runs
+      accumulator.BeginFull();
+      for (int e = driver.ptr[s]; e < driver.ptr[s + 1]; ++e) {
+        const int k = driver.index[e];
+        const T scale = driver.values[e];
+        if (gathered.ptr[k + 1] - gathered.ptr[k] == gathered.inner) {
+          accumulator.AddRun(scale, gathered_values, gathered.ptr[k]);
+          continue;
+        }
+        for (int g = gathered.ptr[k]; g < gathered.ptr[k + 1]; ++g) {
+          accumulator.Add(gathered.index[g], scale, gathered_values, g);
+        }
+      }
+    } else {
+      accumulator.Begin(work[s + 1] - work[s] - 1);
+      for (int e = driver.ptr[s]; e < driver.ptr[s + 1]; ++e) {
+        const int k = driver.index[e];
+        const T scale = driver.values[e];
+        for (int g = gathered.ptr[k]; g < gathered.ptr[k + 1]; ++g) {
+          accumulator.Add(gathered.index[g], scale, gathered_values, g);
+        }
+      }
+    }
+    accumulator.Flush(result.index.data() + result.ptr[s], result.values.data() + result.ptr[s]);
+  });
+  return result;
+}
+
+// C = A * B for CRS matrices: row i of C combines the rows of B selected by row i of A
+template <typename T, typename ForkJoin>
+CompressedMatrix<T> MultiplyCrs(const CompressedView<T>& a, const CompressedView<T>& b, size_t parts,
+                                ForkJoin&& fork_join) {
+  return Gustavson(a, b, parts, fork_join);
+}
+
+// C = A * B for CCS matrices: column j of C combines the columns of A selected by column j of B, so neither operand is
+// transposed (see Transpose() for when a transpose is needed anyway)
+template <typename T, typename ForkJoin>
+CompressedMatrix<T> MultiplyCcs(const CompressedView<T>& a, const CompressedView<T>& b, size_t parts,
+                                ForkJoin&& fork_join) {
+  return Gustavson(b, a, parts, fork_join);
+}
+
+// Single-threaded MultiplyCrs()
+template <typename T>
+CompressedMatrix<T> MultiplyCrs(const CompressedView<T>& a, const CompressedView<T>& b) {
+  return Gustavson(a, b, 1, [](size_t count, const auto& func) { ppc::util::SequentialForkJoin(count, func); });
+}
+
+// Single-threaded MultiplyCcs()
+template <typename T>
+CompressedMatrix<T> MultiplyCcs(const CompressedView<T>& a, const CompressedView<T>& b) {
+  return Gustavson(b, a, 1, [](size_t count, const auto& func) { ppc::util::SequentialForkJoin(count, func); });
+}
+
+// Removes the entries for which drop(value) holds, e.g. products that cancelled out
+template <typename T, typename Predicate>
+void DropEntries(CompressedMatrix<T>& matrix, Predicate&& drop) {
+  int kept = 0;
+  int first = 0;
+  for (int s = 0; s < matrix.outer; ++s) {
+    const int last = matrix.ptr[s + 1];
+    for (int e = first; e < last; ++e) {
+      if (!drop(matrix.values[e])) {
+        matrix.index[kept] = matrix.index[e];
+        matrix.values[kept] = matrix.values[e];
+        ++kept;
+      }
+    }
+    first = last;
+    matrix.ptr[s + 1] = kept;
+  }
+  matrix.index.resize(kept);
+  matrix.values.resize(kept);
+}
+
+}  // namespace ppc::sparse
@@ -0,0 +1,283 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <numeric>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "core/sparse/include/complex.hpp"
+#include "core/sparse/include/compressed.hpp"
+#include "core/sparse/include/spgemm.hpp"
+
+// Products of a sparse matrix with dense vectors (SpMV) and with dense row-major blocks of a few columns (SpMM).
+// fork_join(count, func) follows the SpGEMM engine: it calls func(i) for every i in [0, count), possibly
+// concurrently, and returns once all calls are done. Products are formed with Product(), so complex loops vectorize.
+namespace ppc::sparse {
+
+namespace detail {
+
+// c (a.inner x n) = a * b for a CCS matrix a and b (a.outer x n), both dense row-major. Each part scatters a range of
+// columns of equal entry count into its own copy of c, and the copies are then summed by row blocks, so this takes
+// (parts - 1) * a.inner * n extra elements.
+template <typename T, typename Index, typename ForkJoin>
+void ScatterMultiply(const CompressedView<T, Index>& a, std::span<const T> b, size_t n, std::span<T> c,
+                     size_t parts, ForkJoin&& fork_join) {
+  const size_t size = static_cast<size_t>(a.inner) * n;
+  parts = std::clamp<size_t>(parts, 1, std::max(a.outer, 1));
+  const auto bounds = SplitByWork(EntryPrefix(a), parts);
+  std::vector<T> copies((parts - 1) * size);
+  fork_join(parts, [&](size_t p) {
+    T* out = p == 0 ? c.data() : copies.data() + ((p - 1) * size);
+    std::fill(out, out + size, T{});
+    for (int col = bounds[p]; col < bounds[p + 1]; ++col) {
+      const T* b_row = b.data() + (static_cast<size_t>(col) * n);
+      for (auto e = a.ptr[col]; e < a.ptr[col + 1]; ++e) {
+        const T value = a.values[e];
+        T* out_row = out + (static_cast<size_t>(a.index[e]) * n);
+        for (size_t j = 0; j < n; ++j) {
+          out_row[j] += Product(value, b_row[j]);
+        }
+      }
+    }
+  });
+  if (parts == 1) {
+    return;
+  }
+  fork_join(parts, [&](size_t p) {
+    const size_t first = size * p / parts;
+    const size_t last = size * (p + 1) / parts;
+    for (size_t q = 0; q + 1 < parts; ++q) {
+      const T* copy = copies.data() + (q * size);
+      for (size_t i = first; i < last; ++i) {
+        c[i] += copy[i];
+      }
+    }
+  });
+}
+
+}  // namespace detail
+
+// y = a * x for a CRS matrix a: rows are cut into parts ranges of equal entry count and each row is one dot product.
+// Balanced unless a single row holds more than a part's share of the entries (see SpmvMergePath()).
+template <typename T, typename Index, typename ForkJoin>
+void SpmvRowSplit(const CompressedView<T, Index>& a, std::span<const T> x, std::span<T> y, size_t parts,
+                  ForkJoin&& fork_join) {
+  if (a.outer == 0) {
+    return;
+  }
+  parts = std::clamp<size_t>(parts, 1, static_cast<size_t>(a.outer));
+  const auto bounds = SplitByWork(detail::EntryPrefix(a), parts);
+  fork_join(parts, [&](size_t p) {
+    for (int row = bounds[p]; row < bounds[p + 1]; ++row) {
+      T sum{};
+      for (auto e = a.ptr[row]; e < a.ptr[row + 1]; ++e) {
+        sum += Product(a.values[e], x[a.index[e]]);
+      }
+      y[row] = sum;
+    }
+  });
+}
+
+// y = a * x for a CRS matrix a, split along the merge path of the row ends and the entries (Merrill and Garland):
+// every part gets the same number of rows plus entries, even when one row holds most of the entries. A row that
+// crosses a part boundary is summed in pieces, and the pieces carried out of each part are added in afterwards.
+template <typename T, typename Index, typename ForkJoin>
+void SpmvMergePath(const CompressedView<T, Index>& a, std::span<const T> x, std::span<T> y, size_t parts,
+                   ForkJoin&& fork_join) {
+  const auto rows = static_cast<size_t>(a.outer);
+  if (rows == 0) {
+    return;
+  }
+  const auto base = static_cast<size_t>(a.ptr[0]);
+  const size_t entries = static_cast<size_t>(a.ptr[rows]) - base;
+  const size_t total = rows + entries;
+  parts = std::clamp<size_t>(parts, 1, total);
+  auto row_end = [&](size_t row) { return static_cast<size_t>(a.ptr[row + 1]) - base; };
+  // Merge path coordinate (row, entry) on the given diagonal, row + entry = diagonal
+  auto search = [&](size_t diagonal) {
+    size_t low = diagonal > entries ? diagonal - entries : 0;
+    size_t high = std::min(diagonal, rows);
+    while (low < high) {
+      const size_t middle = (low + high) / 2;
+      if (row_end(middle) <= diagonal - middle - 1) {
+        low = middle + 1;
+      } else {
+        high = middle;
+      }
+    }
+    return std::pair{low, diagonal - low};
+  };
+
+  std::vector<size_t> carry_rows(parts);
+  std::vector<T> carry_sums(parts);
+  fork_join(parts, [&](size_t p) {
+    auto [row, entry] = search(total * p / parts);
+    const auto [last_row, last_entry] = search(total * (p + 1) / parts);
+    T sum{};
+    for (; row < last_row; ++row) {
+      for (; entry < row_end(row); ++entry) {
+        sum += Product(a.values[base + entry], x[a.index[base + entry]]);
+      }
+      y[row] = sum;
+      sum = T{};
+    }
+    for (; entry < last_entry; ++entry) {
+      sum += Product(a.values[base + entry], x[a.index[base + entry]]);
+    }
+    carry_rows[p] = last_row;
+    carry_sums[p] = sum;
+  });
+  for (size_t p = 0; p < parts; ++p) {
+    if (carry_rows[p] < rows) {
+      y[carry_rows[p]] += carry_sums[p];
+    }
+  }
+}
+
+// y = a * x for a CRS matrix a: SpmvRowSplit() when every row fits into a part's share of the entries, SpmvMergePath()
+// when some row is too long for that
+template <typename T, typename Index, typename ForkJoin>
+void SpmvCrs(const CompressedView<T, Index>& a, std::span<const T> x, std::span<T> y, size_t parts,
+             ForkJoin&& fork_join) {
+  const auto entries = static_cast<size_t>(a.ptr.empty() ? 0 : a.ptr[a.outer] - a.ptr[0]);
+  size_t longest = 0;
+  for (int row = 0; row < a.outer; ++row) {
+    longest = std::max(longest, static_cast<size_t>(a.ptr[row + 1] - a.ptr[row]));
+  }
+  if (parts > 1 && longest * parts > entries) {
+    SpmvMergePath(a, x, y, parts, fork_join);
+  } else {
+    SpmvRowSplit(a, x, y, parts, fork_join);
+  }
+}
+
+// y = a * x for a CCS matrix a (see detail::ScatterMultiply())
+template <typename T, typename Index, typename ForkJoin>
+void SpmvCcs(const CompressedView<T, Index>& a, std::span<const T> x, std::span<T> y, size_t parts,
+             ForkJoin&& fork_join) {
+  detail::ScatterMultiply(a, x, 1, y, parts, fork_join);
+}
+
+// c = a * b for a CRS matrix a and dense row-major blocks b (a.inner x n) and c (a.outer x n). Meant for tall and
+// skinny blocks: every entry of a scales one contiguous row of b, so the inner loop runs over n and vectorizes.
+template <typename T, typename Index, typename ForkJoin>
+void SpmmCrs(const CompressedView<T, Index>& a, std::span<const T> b, size_t n, std::span<T> c, size_t parts,
+             ForkJoin&& fork_join) {
+  if (a.outer == 0) {
+    return;
+  }
+  parts = std::clamp<size_t>(parts, 1, static_cast<size_t>(a.outer));
+  const auto bounds = SplitByWork(detail::EntryPrefix(a), parts);
+  fork_join(parts, [&](size_t p) {
+    for (int row = bounds[p]; row < bounds[p + 1]; ++row) {
+      T* c_row = c.data() + (static_cast<size_t>(row) * n);
+      std::fill(c_row, c_row + n, T{});
+      for (auto e = a.ptr[row]; e < a.ptr[row + 1]; ++e) {
+        const T value = a.values[e];
+        const T* b_row = b.data() + (static_cast<size_t>(a.index[e]) * n);
+        for (size_t j = 0; j < n; ++j) {
+          c_row[j] += Product(value, b_row[j]);
+        }
+      }
+    }
+  });
+}
+
+// c = a * b for a CCS matrix a and dense row-major blocks b (a.outer x n) and c (a.inner x n)
+template <typename T, typename Index, typename ForkJoin>
+void SpmmCcs(const CompressedView<T, Index>& a, std::span<const T> b, size_t n, std::span<T> c, size_t parts,
+             ForkJoin&& fork_join) {
+  detail::ScatterMultiply(a, b, n, c, parts, fork_join);
+}
+
+// Rows per chunk of SellMatrix: one vector lane per row
+constexpr int kSellChunk = 8;
+// Rows are sorted by length within windows of this many rows
+constexpr int kSellSortWindow = 256;
+
+// Sliced ELLPACK (SELL-C-sigma) copy of a CRS matrix for SpMV with SIMD. Rows are sorted by length within windows of
+// sigma rows, then every C consecutive sorted rows form a chunk that is padded to its longest row and stored column
+// by column: element j of lane l lives at chunk_ptr[c] + (j * C) + l, so one step of a chunk touches C rows at once.
+// Sorting keeps the padding small; the window keeps x accesses of neighbouring rows close together.
+template <typename T, int C = kSellChunk>
+struct SellMatrix {
+  int rows = 0;
+  int cols = 0;
+  // Offset of the first element of each chunk, plus the total
+  std::vector<int> chunk_ptr{0};
+  // Padding entries have index 0 and value 0
+  std::vector<int> index;
+  std::vector<T> values;
+  // Row of the original matrix held by each sorted position
+  std::vector<int> row_of;
+
+  template <typename Index>
+  static SellMatrix FromCrs(const CompressedView<T, Index>& a, int sigma = kSellSortWindow) {
+    SellMatrix matrix;
+    matrix.rows = a.outer;
+    matrix.cols = a.inner;
+    auto length = [&](int row) { return static_cast<int>(a.ptr[row + 1] - a.ptr[row]); };
+    matrix.row_of.resize(static_cast<size_t>(a.outer));
+    std::iota(matrix.row_of.begin(), matrix.row_of.end(), 0);
+    sigma = std::max(sigma, 1);
+    for (int first = 0; first < a.outer; first += sigma) {
+      const int last = std::min(first + sigma, a.outer);
+      std::stable_sort(matrix.row_of.begin() + first, matrix.row_of.begin() + last,
+                       [&](int lhs, int rhs) { return length(lhs) > length(rhs); });
+    }
+
+    const int chunks = (a.outer + C - 1) / C;
+    matrix.chunk_ptr.resize(static_cast<size_t>(chunks) + 1);
+    for (int chunk = 0; chunk < chunks; ++chunk) {
+      int width = 0;
+      for (int r = chunk * C; r < std::min((chunk + 1) * C, a.outer); ++r) {
+        width = std::max(width, length(matrix.row_of[r]));
+      }
+      matrix.chunk_ptr[chunk + 1] = matrix.chunk_ptr[chunk] + (width * C);
+    }
+    matrix.index.assign(static_cast<size_t>(matrix.chunk_ptr.back()), 0);
+    matrix.values.assign(static_cast<size_t>(matrix.chunk_ptr.back()), T{});
+    for (int r = 0; r < a.outer; ++r) {
+      const int row = matrix.row_of[r];
+      const int start = matrix.chunk_ptr[r / C] + (r % C);
+      for (int j = 0; j < length(row); ++j) {
+        matrix.index[start + (j * C)] = static_cast<int>(a.index[a.ptr[row] + j]);
+        matrix.values[start + (j * C)] = a.values[a.ptr[row] + j];
+      }
+    }
+    return matrix;
+  }
+};
+
+// y = a * x for a SellMatrix, chunks cut into parts ranges of equal size
+template <typename T, int C, typename ForkJoin>
+void SpmvSell(const SellMatrix<T, C>& a, std::span<const T> x, std::span<T> y, size_t parts, ForkJoin&& fork_join) {
+  const int chunks = static_cast<int>(a.chunk_ptr.size()) - 1;
+  if (chunks == 0) {
+    return;
+  }
+  parts = std::clamp<size_t>(parts, 1, static_cast<size_t>(chunks));
+  std::vector<size_t> work(a.chunk_ptr.size());
+  for (size_t chunk = 0; chunk < work.size(); ++chunk) {
+    work[chunk] = static_cast<size_t>(a.chunk_ptr[chunk]) + chunk;
+  }
+  const auto bounds = SplitByWork(work, parts);
+  fork_join(parts, [&](size_t p) {
+    for (int chunk = bounds[p]; chunk < bounds[p + 1]; ++chunk) {
+      std::array<T, C> sums{};
+      for (int e = a.chunk_ptr[chunk]; e < a.chunk_ptr[chunk + 1]; e += C) {
+        for (int lane = 0; lane < C; ++lane) {
+          sums[lane] += Product(a.values[e + lane], x[a.index[e + lane]]);
+        }
+      }
+      for (int lane = 0; lane < C && (chunk * C) + lane < a.rows; ++lane) {
+        y[a.row_of[(chunk * C) + lane]] = sums[lane];
+      }
+    }
+  });
+}
+
+}  // namespace ppc::sparse
@@ -0,0 +1,106 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include "core/sparse/include/compressed.hpp"
+#include "core/task/include/task.hpp"
+
+namespace ppc::sparse {
+
+// Standard TaskData layout of a sparse operand: kSparseInputs consecutive inputs holding
+//   the SparseShape (count 1), the values (count nnz), the inner indices (int, count nnz) and the slice offsets
+//   (int, count shape.Outer() + 1).
+// Tasks read the arrays in place through SparseInput(), so nothing dense is built on the way in. A sparse result is
+// returned through an output that points to a SparseMatrix (count 1), which the task fills by moving its arrays in.
+constexpr size_t kSparseInputs = 4;
+
+// Appends one sparse operand. The arrays are referenced, not copied, and must outlive the task.
+template <typename T>
+void AddSparseInput(core::TaskData& task_data, const SparseShape& shape, std::span<const T> values,
+                    std::span<const int> index, std::span<const int> ptr) {
+  auto add = [&](const void* data, size_t count) {
+    task_data.inputs.emplace_back(static_cast<uint8_t*>(const_cast<void*>(data)));
+    task_data.inputs_count.emplace_back(static_cast<uint32_t>(count));
+  };
+  add(&shape, 1);
+  add(values.data(), values.size());
+  add(index.data(), index.size());
+  add(ptr.data(), ptr.size());
+}
+
+template <typename T, Layout L>
+void AddSparseInput(core::TaskData& task_data, const SparseMatrix<T, L>& matrix) {
+  AddSparseInput<T>(task_data, matrix.shape, matrix.values, matrix.index, matrix.ptr);
+}
+
+// Shape of the sparse operand starting at input first
+inline SparseShape SparseInputShape(const core::TaskData& task_data, size_t first) {
+  return *reinterpret_cast<const SparseShape*>(task_data.inputs[first]);
+}
+
+// Whether the inputs starting at first hold a well-formed sparse operand of the given layout: the counts agree with
+// the shape, the offsets start at zero and never decrease, and every index lies within a slice. Takes O(nnz).
+inline bool IsSparseInput(const core::TaskData& task_data, size_t first, Layout layout) {
+  if (task_data.inputs.size() < first + kSparseInputs || task_data.inputs_count.size() < first + kSparseInputs ||
+      task_data.inputs_count[first] != 1 || task_data.inputs[first] == nullptr) {
+    return false;
+  }
+  const SparseShape shape = SparseInputShape(task_data, first);
+  if (shape.layout != layout || shape.rows < 0 || shape.cols < 0) {
+    return false;
+  }
+  const uint32_t nnz = task_data.inputs_count[first + 1];
+  const auto outer = static_cast<size_t>(shape.Outer());
+  if (task_data.inputs_count[first + 2] != nnz || task_data.inputs_count[first + 3] != outer + 1) {
+    return false;
+  }
+  const auto* index = reinterpret_cast<const int*>(task_data.inputs[first + 2]);
+  const auto* ptr = reinterpret_cast<const int*>(task_data.inputs[first + 3]);
+  if (ptr[0] != 0 || ptr[outer] != static_cast<int>(nnz)) {
+    return false;
+  }
+  for (size_t s = 0; s < outer; ++s) {
+    if (ptr[s] > ptr[s + 1]) {
+      return false;
+    }
+  }
+  for (uint32_t e = 0; e < nnz; ++e) {
+    if (index[e] < 0 || index[e] >= shape.Inner()) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Zero-copy view of the sparse operand starting at input first (see IsSparseInput())
+template <typename T>
+CompressedView<T> SparseInput(const core::TaskData& task_data, size_t first) {
+  const SparseShape shape = SparseInputShape(task_data, first);
+  const uint32_t nnz = task_data.inputs_count[first + 1];
+  return {.outer = shape.Outer(),
+          .inner = shape.Inner(),
+          .ptr = {reinterpret_cast<const int*>(task_data.inputs[first + 3]), static_cast<size_t>(shape.Outer()) + 1},
+          .index = {reinterpret_cast<const int*>(task_data.inputs[first + 2]), nnz},
+          .values = {reinterpret_cast<const T*>(task_data.inputs[first + 1]), nnz}};
+}
+
+// Appends an output the task fills with its sparse result
+template <typename T, Layout L>
+void AddSparseOutput(core::TaskData& task_data, SparseMatrix<T, L>& matrix) {
+  task_data.outputs.emplace_back(reinterpret_cast<uint8_t*>(&matrix));
+  task_data.outputs_count.emplace_back(1);
+}
+
+inline bool IsSparseOutput(const core::TaskData& task_data, size_t index) {
+  return index < task_data.outputs.size() && index < task_data.outputs_count.size() &&
+         task_data.outputs_count[index] == 1 && task_data.outputs[index] != nullptr;
+}
+
+template <typename T, Layout L>
+SparseMatrix<T, L>& SparseOutput(const core::TaskData& task_data, size_t index) {
+  return *reinterpret_cast<SparseMatrix<T, L>*>(task_data.outputs[index]);
+}
+
+}  // namespace ppc::sparse
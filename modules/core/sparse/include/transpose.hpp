@@ -0,0 +1,75 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include "core/sparse/include/compressed.hpp"
+#include "core/sparse/include/spgemm.hpp"
+#include "core/util/include/fork_join.hpp"
+
+namespace ppc::sparse {
+
+// Transpose of a compressed matrix by a counting sort of its entries: the result has a.inner slices of length
+// a.outer, with the indices of every slice in ascending order. Read in the same layout the arrays hold the transposed
+// matrix; read in the other layout (CRS as CCS and back) they hold the same matrix, so this also converts between
+// layouts. Takes O(nnz + parts * a.inner) time and parts * a.inner extra counters.
+// parts workers take ranges of slices of equal entry count. Each counts the indices of its range, the counts are
+// turned into a separate write position per (index, part), and the workers then scatter their entries without
+// sharing any position. fork_join follows Gustavson().
+template <typename T, typename ForkJoin>
+CompressedMatrix<T> Transpose(const CompressedView<T>& a, size_t parts, ForkJoin&& fork_join) {
+  CompressedMatrix<T> result;
+  result.outer = a.inner;
+  result.inner = a.outer;
+  result.ptr.assign(static_cast<size_t>(a.inner) + 1, 0);
+  if (a.outer == 0 || a.inner == 0) {
+    return result;
+  }
+  parts = std::clamp<size_t>(parts, 1, static_cast<size_t>(a.outer));
+  const auto bounds = SplitByWork(detail::EntryPrefix(a), parts);
+  const auto inner = static_cast<size_t>(a.inner);
+
+  // positions[(p * inner) + i] counts the entries of index i in the range of part p, then becomes the place of the
+  // first of them in the result
+  std::vector<int> positions(parts * inner, 0);
+  fork_join(parts, [&](size_t p) {
+    int* count = positions.data() + (p * inner);
+    for (int e = a.ptr[bounds[p]]; e < a.ptr[bounds[p + 1]]; ++e) {
+      ++count[a.index[e]];
+    }
+  });
+  // Index-major so every result slice is contiguous, part-minor so its indices stay in ascending order
+  int offset = 0;
+  for (size_t i = 0; i < inner; ++i) {
+    result.ptr[i] = offset;
+    for (size_t p = 0; p < parts; ++p) {
+      const int count = positions[(p * inner) + i];
+      positions[(p * inner) + i] = offset;
+      offset += count;
+    }
+  }
+  result.ptr[inner] = offset;
+  result.index.resize(offset);
+  result.values.resize(offset);
+
+  fork_join(parts, [&](size_t p) {
+    int* next = positions.data() + (p * inner);
+    for (int s = bounds[p]; s < bounds[p + 1]; ++s) {
+      for (int e = a.ptr[s]; e < a.ptr[s + 1]; ++e) {
+        const int position = next[a.index[e]]++;
+        result.index[position] = s;
+        result.values[position] = a.values[e];
+      }
+    }
+  });
+  return result;
+}
+
+// Single-threaded Transpose()
+template <typename T>
+CompressedMatrix<T> Transpose(const CompressedView<T>& a) {
+  return Transpose(a, 1, [](size_t count, const auto& func) { ppc::util::SequentialForkJoin(count, func); });
+}
+
+}  // namespace ppc::sparse
@@ -8,12 +8,17 @@
 
 namespace ppc::core {
 
+// Element type of the buffers in TaskData, for tasks that accept more than one. kFloat32Float64 has float inputs and
+// double outputs.
+enum class DataType : uint8_t { kFloat64, kFloat32, kFloat32Float64 };
+
 struct TaskData {
   std::vector<uint8_t *> inputs;
   std::vector<std::uint32_t> inputs_count;
   std::vector<uint8_t *> outputs;
   std::vector<std::uint32_t> outputs_count;
   enum StateOfTesting : uint8_t { kFunc, kPerf } state_of_testing;
+  DataType data_type = DataType::kFloat64;
 };
 
 using TaskDataPtr = std::shared_ptr<ppc::core::TaskData>;
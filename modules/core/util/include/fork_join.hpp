@@ -0,0 +1,52 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <thread>
+#include <vector>
+
+// Fork-join runners for the core engines. fork_join(count, func) calls func(i) for every i in [0, count), possibly
+// concurrently, and returns once all calls are done; a task passes one of these wrapped in a lambda.
+namespace ppc::util {
+
+// Runs every call on the calling thread
+void SequentialForkJoin(size_t count, const auto& func) {
+  for (size_t i = 0; i < count; ++i) {
+    func(i);
+  }
+}
+
+// Runs the calls on up to max_threads threads, the calling thread included: thread t makes the calls t,
+// t + threads, t + 2 * threads, ... With the default limit every call gets its own thread.
+void ThreadForkJoin(size_t count, const auto& func, size_t max_threads = std::numeric_limits<size_t>::max()) {
+  const size_t threads = std::min(count, std::max<size_t>(max_threads, 1));
+  auto worker = [&](size_t t) {
+    for (size_t i = t; i < count; i += threads) {
+      func(i);
+    }
+  };
+  std::vector<std::thread> workers;
+  workers.reserve(threads > 0 ? threads - 1 : 0);
+  for (size_t t = 1; t < threads; ++t) {
+    workers.emplace_back(worker, t);
+  }
+  if (threads > 0) {
+    worker(0);
+  }
+  for (auto& thread : workers) {
+    thread.join();
+  }
+}
+
+#ifdef _OPENMP
+// Runs the calls as the iterations of an OpenMP parallel loop on the current OpenMP thread team size
+void OmpForkJoin(size_t count, const auto& func) {
+#pragma omp parallel for
+  for (int i = 0; i < static_cast<int>(count); ++i) {
+    func(i);
+  }
+}
+#endif
+
+}  // namespace ppc::util
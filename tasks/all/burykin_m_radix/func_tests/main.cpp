@@ -1,7 +1,9 @@
 #include <gtest/gtest.h>
 
 #include <algorithm>
+#include <boost/mpi/collectives/gather.hpp>
 #include <boost/mpi/communicator.hpp>
+#include <boost/serialization/vector.hpp>  // NOLINT(misc-include-cleaner) - needed for MPI serialization
 #include <cstddef>
 #include <cstdint>
 #include <memory>
@@ -96,6 +98,28 @@ TEST(burykin_m_radix_all, RandomVector) {
   CompareResults(expected, output);
 }
 
+TEST(burykin_m_radix_all, LargeRandomVectorMergedInBlocks) {
+  constexpr size_t kSize = 300000;
+  std::vector<int> input = GenerateRandomVector(kSize, -1000000, 1000000);
+  std::vector<int> expected = input;
+  std::ranges::sort(expected);
+  std::vector<int> output(kSize, 0);
+
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.push_back(reinterpret_cast<uint8_t*>(input.data()));
+  task_data->inputs_count.push_back(static_cast<std::uint32_t>(input.size()));
+  task_data->outputs.push_back(reinterpret_cast<uint8_t*>(output.data()));
+  task_data->outputs_count.push_back(static_cast<std::uint32_t>(output.size()));
+
+  burykin_m_radix_all::RadixALL task(task_data);
+  ASSERT_TRUE(task.Validation());
+  task.PreProcessing();
+  task.Run();
+  task.PostProcessing();
+
+  CompareResults(expected, output);
+}
+
 TEST(burykin_m_radix_all, AllEqual) {
   constexpr size_t kSize = 100;
   std::vector<int> input(kSize, 42);
@@ -136,3 +160,127 @@ TEST(burykin_m_radix_all, EmptyVector) {
 
   CompareResults(expected, output);
 }
+
+TEST(burykin_m_radix_all, SampleSortLargeRandomVector) {
+  std::vector<int> input = GenerateRandomVector(300000, -1000000, 1000000);
+  std::vector<int> expected = input;
+  std::ranges::sort(expected);
+  std::vector<int> output(input.size(), 0);
+
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.push_back(reinterpret_cast<uint8_t*>(input.data()));
+  task_data->inputs_count.push_back(static_cast<std::uint32_t>(input.size()));
+  task_data->outputs.push_back(reinterpret_cast<uint8_t*>(output.data()));
+  task_data->outputs_count.push_back(static_cast<std::uint32_t>(output.size()));
+
+  burykin_m_radix_all::RadixSampleSortALL task(task_data);
+  ASSERT_TRUE(task.Validation());
+  task.PreProcessing();
+  task.Run();
+  task.PostProcessing();
+
+  CompareResults(expected, output);
+}
+
+TEST(burykin_m_radix_all, SampleSortFewUniqueValues) {
+  std::vector<int> input = GenerateRandomVector(100000, -3, 3);
+  std::vector<int> expected = input;
+  std::ranges::sort(expected);
+  std::vector<int> output(input.size(), 0);
+
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.push_back(reinterpret_cast<uint8_t*>(input.data()));
+  task_data->inputs_count.push_back(static_cast<std::uint32_t>(input.size()));
+  task_data->outputs.push_back(reinterpret_cast<uint8_t*>(output.data()));
+  task_data->outputs_count.push_back(static_cast<std::uint32_t>(output.size()));
+
+  burykin_m_radix_all::RadixSampleSortALL task(task_data);
+  ASSERT_TRUE(task.Validation());
+  task.PreProcessing();
+  task.Run();
+  task.PostProcessing();
+
+  CompareResults(expected, output);
+}
+
+TEST(burykin_m_radix_all, SampleSortFewerElementsThanRanks) {
+  std::vector<int> input = {7, -2, 5};
+  std::vector<int> expected = input;
+  std::ranges::sort(expected);
+  std::vector<int> output(input.size(), 0);
+
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.push_back(reinterpret_cast<uint8_t*>(input.data()));
+  task_data->inputs_count.push_back(static_cast<std::uint32_t>(input.size()));
+  task_data->outputs.push_back(reinterpret_cast<uint8_t*>(output.data()));
+  task_data->outputs_count.push_back(static_cast<std::uint32_t>(output.size()));
+
+  burykin_m_radix_all::RadixSampleSortALL task(task_data);
+  ASSERT_TRUE(task.Validation());
+  task.PreProcessing();
+  task.Run();
+  task.PostProcessing();
+
+  CompareResults(expected, output);
+}
+
+TEST(burykin_m_radix_all, SampleSortKeepsResultDistributed) {
+  std::vector<int> input = GenerateRandomVector(200000, -1000000, 1000000);
+  std::vector<int> expected = input;
+  std::ranges::sort(expected);
+
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.push_back(reinterpret_cast<uint8_t*>(input.data()));
+  task_data->inputs_count.push_back(static_cast<std::uint32_t>(input.size()));
+
+  burykin_m_radix_all::RadixSampleSortALL task(task_data, true);
+  ASSERT_TRUE(task.Validation());
+  task.PreProcessing();
+  task.Run();
+  task.PostProcessing();
+
+  boost::mpi::communicator world;
+  std::vector<std::vector<int>> parts;
+  boost::mpi::gather(world, task.LocalResult(), parts, 0);
+  std::vector<int> output;
+  for (const auto& part : parts) {
+    output.insert(output.end(), part.begin(), part.end());
+  }
+  CompareResults(expected, output);
+}
+
+TEST(burykin_m_radix_all, SampleSortSpreadsRepeatedKeyOverRanks) {
+  constexpr size_t kSize = 100000;
+  std::vector<int> input = GenerateRandomVector(kSize, -1000000, 1000000);
+  for (size_t i = 0; i < kSize; ++i) {
+    if (i % 10 != 0) {
+      input[i] = 42;
+    }
+  }
+  std::vector<int> expected = input;
+  std::ranges::sort(expected);
+
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.push_back(reinterpret_cast<uint8_t*>(input.data()));
+  task_data->inputs_count.push_back(static_cast<std::uint32_t>(input.size()));
+
+  burykin_m_radix_all::RadixSampleSortALL task(task_data, true);
+  ASSERT_TRUE(task.Validation());
+  task.PreProcessing();
+  task.Run();
+  task.PostProcessing();
+
+  boost::mpi::communicator world;
+  std::vector<std::vector<int>> parts;
+  boost::mpi::gather(world, task.LocalResult(), parts, 0);
+  std::vector<int> output;
+  for (const auto& part : parts) {
+    output.insert(output.end(), part.begin(), part.end());
+  }
+  CompareResults(expected, output);
+  if (world.rank() == 0) {
+    // 90% of the keys are equal, without splitting them between buckets one rank would hold nearly all of them
+    const auto largest = std::ranges::max(parts, {}, &std::vector<int>::size).size();
+    EXPECT_LE(largest, (kSize / static_cast<size_t>(world.size())) + (kSize / 4));
+  }
+}
@@ -17,13 +17,15 @@ class RadixALL : public ppc::core::Task {
   bool RunImpl() override;
   bool PostProcessingImpl() override;
 
+  // Local radix sort of signed integers
+  static void RadixSortLocal(std::vector<int>& arr);
+
  private:
   std::vector<int> input_, output_;
   std::vector<int> local_data_;
   boost::mpi::communicator world_;
 
   // Core radix sort functions
-  static void RadixSortLocal(std::vector<int>& arr);
   static void CountingSortByDigit(std::vector<int>& arr, int exp);
   static void RadixSortPositive(std::vector<int>& arr);
 
@@ -34,10 +36,12 @@ class RadixALL : public ppc::core::Task {
 
   // MPI distribution and merging functions
   std::vector<int> DistributeData(const std::vector<int>& data, int rank, int size);
-  std::vector<int> GatherAndMerge(const std::vector<int>& local_sorted, int rank, int size);
+  std::vector<int> GatherAndMerge(const std::vector<int>& local_sorted, int rank);
 
-  // Simple merge function
-  static std::vector<int> MergeTwoSorted(const std::vector<int>& left, const std::vector<int>& right);
+  // Streaming k-way merge: non-root ranks ship their run in blocks, the root merges all runs
+  // with a loser tree while the remaining blocks are still in flight
+  void SendRunInBlocks(const std::vector<int>& local_sorted);
+  std::vector<int> MergeRunsOnRoot(const std::vector<int>& local_sorted, const std::vector<int>& run_sizes);
 
   static void CalculateDistribution(const std::vector<int>& data, int size, std::vector<int>& send_counts,
                                     std::vector<int>& displs);
@@ -45,4 +49,32 @@ class RadixALL : public ppc::core::Task {
                            const std::vector<int>& displs, int size, std::vector<int>& local_data);
 };
 
+// Distributed sample sort: every rank radix-sorts its chunk, splitters are picked from samples gathered from
+// all ranks, buckets are exchanged with MPI_Alltoallv and the received runs are merged locally. No rank ever
+// merges the whole array. With keep_distributed the result stays spread over the ranks in rank order
+// (LocalResult) instead of being gathered into the root output.
+class RadixSampleSortALL : public ppc::core::Task {
+ public:
+  explicit RadixSampleSortALL(ppc::core::TaskDataPtr task_data, bool keep_distributed = false)
+      : Task(std::move(task_data)), keep_distributed_(keep_distributed) {}
+
+  bool ValidationImpl() override;
+  bool PreProcessingImpl() override;
+  bool RunImpl() override;
+  bool PostProcessingImpl() override;
+
+  [[nodiscard]] const std::vector<int>& LocalResult() const { return local_data_; }
+
+ private:
+  std::vector<int> input_, output_;
+  std::vector<int> local_data_;
+  bool keep_distributed_;
+  boost::mpi::communicator world_;
+
+  std::vector<int> ScatterInput(size_t array_size);
+  std::vector<int> ChooseSplitters(const std::vector<int>& local_sorted);
+  std::vector<int> ExchangeBuckets(const std::vector<int>& local_sorted, const std::vector<int>& splitters);
+  void GatherResult();
+};
+
 }  // namespace burykin_m_radix_all
\ No newline at end of file
@@ -1,19 +1,168 @@
 #include "all/burykin_m_radix/include/ops_all.hpp"
 
+#include <mpi.h>
 #include <omp.h>
 
 #include <algorithm>
+#include <array>
 #include <boost/mpi/collectives.hpp>
+#include <boost/mpi/collectives/all_gather.hpp>
+#include <boost/mpi/collectives/all_to_all.hpp>
 #include <boost/mpi/collectives/broadcast.hpp>
+#include <boost/mpi/collectives/gather.hpp>
+#include <boost/mpi/collectives/gatherv.hpp>
+#include <boost/mpi/collectives/scatterv.hpp>
 #include <boost/mpi/communicator.hpp>
+#include <boost/mpi/nonblocking.hpp>
+#include <boost/mpi/request.hpp>
 #include <boost/serialization/vector.hpp>  // NOLINT(misc-include-cleaner) - needed for MPI serialization
 #include <cmath>
 #include <cstddef>
 #include <cstring>
 #include <numeric>
+#include <span>
 #include <utility>
 #include <vector>
 
+#include "core/sort/include/presort.hpp"
+#include "core/util/include/util.hpp"
+
+namespace {
+
+// Elements per message when a rank streams its sorted run to the root
+constexpr int kMergeBlockSize = 1 << 15;
+// Regularly spaced samples every rank contributes to the splitter choice of the sample sort
+constexpr size_t kSamplesPerRank = 32;
+
+// Sorted run of one rank as seen by the root. Remote runs arrive in blocks into two
+// buffers, so the next block is already in flight while the current one is merged.
+class RunStream {
+ public:
+  void AttachLocal(const std::vector<int>& data) {
+    cur_ = data.data();
+    end_ = cur_ + data.size();
+  }
+
+  void AttachRemote(boost::mpi::communicator& world, int source, int size) {
+    world_ = &world;
+    source_ = source;
+    remaining_ = size;
+    for (auto& buffer : buffers_) {
+      buffer.resize(std::min(size, kMergeBlockSize));
+    }
+    PostReceive(0);
+    PostReceive(1);
+    active_ = 1;
+  }
+
+  // Waits for the first block of a remote run; no-op for local runs
+  void Start() {
+    if (world_ != nullptr) {
+      NextBlock();
+    }
+  }
+
+  [[nodiscard]] bool Empty() const { return cur_ == end_; }
+  [[nodiscard]] int Front() const { return *cur_; }
+
+  void Pop() {
+    if (++cur_ == end_ && world_ != nullptr) {
+      PostReceive(active_);
+      NextBlock();
+    }
+  }
+
+ private:
+  void PostReceive(int slot) {
+    pending_[slot] = remaining_ > 0;
+    if (!pending_[slot]) {
+      return;
+    }
+    lengths_[slot] = std::min(remaining_, kMergeBlockSize);
+    remaining_ -= lengths_[slot];
+    requests_[slot] = world_->irecv(source_, 0, buffers_[slot].data(), lengths_[slot]);
+  }
+
+  void NextBlock() {
+    active_ ^= 1;
+    if (!pending_[active_]) {
+      cur_ = end_;
+      return;
+    }
+    requests_[active_].wait();
+    pending_[active_] = false;
+    cur_ = buffers_[active_].data();
+    end_ = cur_ + lengths_[active_];
+  }
+
+  boost::mpi::communicator* world_ = nullptr;
+  int source_ = 0;
+  int remaining_ = 0;
+  int active_ = 0;
+  std::array<std::vector<int>, 2> buffers_;
+  std::array<boost::mpi::request, 2> requests_;
+  std::array<int, 2> lengths_{};
+  std::array<bool, 2> pending_{};
+  const int* cur_ = nullptr;
+  const int* end_ = nullptr;
+};
+
+// Tournament tree over k runs: every internal node keeps the loser of its match, so taking
+// the winner only replays the log k matches on the path from its leaf to the root
+class LoserTree {
+ public:
+  explicit LoserTree(std::vector<RunStream>& runs)
+      : runs_(runs), k_(static_cast<int>(runs.size())), losers_(runs.size()) {
+    winner_ = Build(1);
+  }
+
+  int Pop() {
+    const int value = runs_[winner_].Front();
+    runs_[winner_].Pop();
+    int candidate = winner_;
+    for (int node = (candidate + k_) / 2; node >= 1; node /= 2) {
+      if (Beats(losers_[node], candidate)) {
+        std::swap(losers_[node], candidate);
+      }
+    }
+    winner_ = candidate;
+    return value;
+  }
+
+ private:
+  // Exhausted runs lose every match; ties go to the lower rank
+  [[nodiscard]] bool Beats(int a, int b) const {
+    if (runs_[a].Empty()) {
+      return false;
+    }
+    if (runs_[b].Empty()) {
+      return true;
+    }
+    return runs_[a].Front() < runs_[b].Front() || (runs_[a].Front() == runs_[b].Front() && a < b);
+  }
+
+  int Build(int node) {
+    if (node >= k_) {
+      return node - k_;
+    }
+    const int left = Build(2 * node);
+    const int right = Build((2 * node) + 1);
+    if (Beats(right, left)) {
+      losers_[node] = left;
+      return right;
+    }
+    losers_[node] = right;
+    return left;
+  }
+
+  std::vector<RunStream>& runs_;
+  int k_;
+  std::vector<int> losers_;
+  int winner_ = 0;
+};
+
+}  // namespace
+
 bool burykin_m_radix_all::RadixALL::ValidationImpl() {
   if (world_.rank() == 0) {
     return task_data->inputs_count[0] == task_data->outputs_count[0];
@@ -56,11 +205,8 @@ bool burykin_m_radix_all::RadixALL::RunImpl() {
     RadixSortLocal(local_data_);
   }
 
-  // Synchronize before gathering to ensure all processes have completed sorting
-  world_.barrier();
-
-  // Gather and merge results using tree-based approach
-  output_ = GatherAndMerge(local_data_, rank, size);
+  // Gather and merge all sorted runs on the root in a single pass
+  output_ = GatherAndMerge(local_data_, rank);
 
   return true;
 }
@@ -269,61 +415,45 @@ std::vector<int> burykin_m_radix_all::RadixALL::DistributeData(const std::vector
   return local_data;
 }
 
-std::vector<int> burykin_m_radix_all::RadixALL::GatherAndMerge(const std::vector<int>& local_sorted, int rank,
-                                                               int size) {
-  std::vector<int> current_data = local_sorted;
-
-  // Tree-based reduction for better scalability
-  for (int step = 1; step < size; step *= 2) {
-    if (rank % (2 * step) == 0) {
-      // Receiver
-      int sender = rank + step;
-      if (sender < size) {
-        std::vector<int> received_data;
-        // Always receive - sender will always send (even empty data)
-        world_.recv(sender, 0, received_data);
-        current_data = MergeTwoSorted(current_data, received_data);
-      }
-    } else if (rank % step == 0) {
-      // Sender - always send current data (even if empty)
-      int receiver = rank - step;
-      world_.send(receiver, 0, current_data);
-      break;
-    }
-  }
+std::vector<int> burykin_m_radix_all::RadixALL::GatherAndMerge(const std::vector<int>& local_sorted, int rank) {
+  std::vector<int> run_sizes;
+  boost::mpi::gather(world_, static_cast<int>(local_sorted.size()), run_sizes, 0);
 
-  return current_data;
-}
-
-std::vector<int> burykin_m_radix_all::RadixALL::MergeTwoSorted(const std::vector<int>& left,
-                                                               const std::vector<int>& right) {
-  if (left.empty()) {
-    return right;
-  }
-  if (right.empty()) {
-    return left;
+  if (rank != 0) {
+    SendRunInBlocks(local_sorted);
+    return {};
   }
+  return MergeRunsOnRoot(local_sorted, run_sizes);
+}
 
-  std::vector<int> result;
-  result.reserve(left.size() + right.size());
-
-  size_t i = 0;
-  size_t j = 0;
-  while (i < left.size() && j < right.size()) {
-    if (left[i] <= right[j]) {
-      result.push_back(left[i++]);
-    } else {
-      result.push_back(right[j++]);
-    }
+void burykin_m_radix_all::RadixALL::SendRunInBlocks(const std::vector<int>& local_sorted) {
+  const int total = static_cast<int>(local_sorted.size());
+  std::vector<boost::mpi::request> requests;
+  requests.reserve((total / kMergeBlockSize) + 1);
+  for (int offset = 0; offset < total; offset += kMergeBlockSize) {
+    const int length = std::min(kMergeBlockSize, total - offset);
+    requests.push_back(world_.isend(0, 0, local_sorted.data() + offset, length));
   }
+  boost::mpi::wait_all(requests.begin(), requests.end());
+}
 
-  while (i < left.size()) {
-    result.push_back(left[i++]);
+std::vector<int> burykin_m_radix_all::RadixALL::MergeRunsOnRoot(const std::vector<int>& local_sorted,
+                                                                const std::vector<int>& run_sizes) {
+  std::vector<RunStream> runs(run_sizes.size());
+  runs[0].AttachLocal(local_sorted);
+  // Post the receives for every rank before blocking on any of them
+  for (int source = 1; source < static_cast<int>(runs.size()); ++source) {
+    runs[source].AttachRemote(world_, source, run_sizes[source]);
   }
-  while (j < right.size()) {
-    result.push_back(right[j++]);
+  for (auto& run : runs) {
+    run.Start();
   }
 
+  std::vector<int> result(std::accumulate(run_sizes.begin(), run_sizes.end(), size_t{0}));
+  LoserTree tree(runs);
+  for (int& value : result) {
+    value = tree.Pop();
+  }
   return result;
 }
 
@@ -347,4 +477,141 @@ void burykin_m_radix_all::RadixALL::MergeResults(std::vector<int>& result, const
   result.reserve(negatives.size() + positives.size());
   result.insert(result.end(), negatives.begin(), negatives.end());
   result.insert(result.end(), positives.begin(), positives.end());
-}
\ No newline at end of file
+}
+
+bool burykin_m_radix_all::RadixSampleSortALL::ValidationImpl() {
+  if (world_.rank() == 0) {
+    if (keep_distributed_) {
+      return !task_data->inputs.empty();
+    }
+    return task_data->inputs_count[0] == task_data->outputs_count[0];
+  }
+  return true;
+}
+
+bool burykin_m_radix_all::RadixSampleSortALL::PreProcessingImpl() {
+  if (world_.rank() == 0) {
+    input_ = std::vector<int>(reinterpret_cast<int*>(task_data->inputs[0]),
+                              reinterpret_cast<int*>(task_data->inputs[0]) + task_data->inputs_count[0]);
+  }
+  return true;
+}
+
+bool burykin_m_radix_all::RadixSampleSortALL::RunImpl() {
+  size_t array_size = input_.size();
+  boost::mpi::broadcast(world_, array_size, 0);
+  if (array_size == 0) {
+    local_data_.clear();
+    output_.clear();
+    return true;
+  }
+
+  std::vector<int> local = ScatterInput(array_size);
+  RadixALL::RadixSortLocal(local);
+  local_data_ = ExchangeBuckets(local, ChooseSplitters(local));
+
+  if (!keep_distributed_) {
+    GatherResult();
+  }
+  return true;
+}
+
+bool burykin_m_radix_all::RadixSampleSortALL::PostProcessingImpl() {
+  if (!keep_distributed_ && world_.rank() == 0 && !output_.empty()) {
+    std::memcpy(task_data->outputs[0], output_.data(), output_.size() * sizeof(int));
+  }
+  return true;
+}
+
+std::vector<int> burykin_m_radix_all::RadixSampleSortALL::ScatterInput(size_t array_size) {
+  const int size = world_.size();
+  std::vector<int> counts(size);
+  std::vector<int> displs(size);
+  for (int i = 0; i < size; ++i) {
+    counts[i] = static_cast<int>((array_size / size) + (std::cmp_less(i, array_size % size) ? 1 : 0));
+    displs[i] = i == 0 ? 0 : displs[i - 1] + counts[i - 1];
+  }
+  std::vector<int> local(counts[world_.rank()]);
+  if (world_.rank() == 0) {
+    boost::mpi::scatterv(world_, input_.data(), counts, displs, local.data(), counts[0], 0);
+  } else {
+    boost::mpi::scatterv(world_, local.data(), counts[world_.rank()], 0);
+  }
+  return local;
+}
+
+std::vector<int> burykin_m_radix_all::RadixSampleSortALL::ChooseSplitters(const std::vector<int>& local_sorted) {
+  const size_t count = std::min(local_sorted.size(), kSamplesPerRank);
+  std::vector<int> samples(count);
+  for (size_t i = 0; i < count; ++i) {
+    samples[i] = local_sorted[(i * local_sorted.size() / count) + (local_sorted.size() / (2 * count))];
+  }
+
+  // Every rank gets all samples and derives the same splitters, so no extra broadcast is needed
+  std::vector<std::vector<int>> gathered;
+  boost::mpi::all_gather(world_, samples, gathered);
+  std::vector<int> all_samples;
+  for (const auto& part : gathered) {
+    all_samples.insert(all_samples.end(), part.begin(), part.end());
+  }
+  std::ranges::sort(all_samples);
+
+  const auto size = static_cast<size_t>(world_.size());
+  std::vector<int> splitters(size - 1);
+  for (size_t b = 0; b + 1 < size; ++b) {
+    splitters[b] = all_samples[(b + 1) * all_samples.size() / size];
+  }
+  return splitters;
+}
+
+std::vector<int> burykin_m_radix_all::RadixSampleSortALL::ExchangeBuckets(const std::vector<int>& local_sorted,
+                                                                          const std::vector<int>& splitters) {
+  const int size = world_.size();
+  std::vector<int> send_counts(size);
+  std::vector<int> send_displs(size);
+  // Bucket r holds [splitters[r - 1], splitters[r]]; the local run is sorted, so buckets are contiguous. Keys equal
+  // to a run of k equal splitters may go to any of the k + 1 buckets around it and are split evenly between them,
+  // otherwise a heavily repeated key would land in a single bucket.
+  std::vector<size_t> bounds(size + 1, local_sorted.size());
+  bounds[0] = 0;
+  for (int r = 0; r + 1 < size; ++r) {
+    const int key = splitters[r];
+    const auto equal = std::ranges::equal_range(local_sorted, key);
+    const auto first = std::ranges::lower_bound(splitters, key) - splitters.begin();
+    const auto last = std::ranges::upper_bound(splitters, key) - splitters.begin();
+    const auto share = static_cast<size_t>(r - first + 1);
+    const auto parts = static_cast<size_t>(last - first + 1);
+    bounds[r + 1] = static_cast<size_t>(equal.begin() - local_sorted.begin()) + (equal.size() * share / parts);
+  }
+  for (int r = 0; r < size; ++r) {
+    send_displs[r] = static_cast<int>(bounds[r]);
+    send_counts[r] = static_cast<int>(bounds[r + 1] - bounds[r]);
+  }
+
+  std::vector<int> recv_counts;
+  boost::mpi::all_to_all(world_, send_counts, recv_counts);
+  std::vector<int> recv_displs(size);
+  std::exclusive_scan(recv_counts.begin(), recv_counts.end(), recv_displs.begin(), 0);
+  std::vector<int> received(recv_displs.back() + recv_counts.back());
+  MPI_Alltoallv(local_sorted.data(), send_counts.data(), send_displs.data(), MPI_INT, received.data(),
+                recv_counts.data(), recv_displs.data(), MPI_INT, world_);
+
+  // The bucket is made of one sorted run per source rank
+  const auto num_threads = static_cast<size_t>(ppc::util::GetPPCNumThreads());
+  ppc::sort::MergeNaturalRuns(std::span<int>(received), num_threads);
+  return received;
+}
+
+void burykin_m_radix_all::RadixSampleSortALL::GatherResult() {
+  std::vector<int> sizes;
+  const int local_size = static_cast<int>(local_data_.size());
+  boost::mpi::gather(world_, local_size, sizes, 0);
+  if (world_.rank() != 0) {
+    boost::mpi::gatherv(world_, local_data_.data(), local_size, 0);
+    return;
+  }
+  std::vector<int> displs(sizes.size());
+  std::exclusive_scan(sizes.begin(), sizes.end(), displs.begin(), 0);
+  output_.resize(displs.back() + sizes.back());
+  boost::mpi::gatherv(world_, local_data_.data(), local_size, output_.data(), sizes, displs, 0);
+}
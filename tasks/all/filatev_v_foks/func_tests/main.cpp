@@ -194,6 +194,31 @@ TEST(filatev_v_foks_all, test_matrix_4_1_block_2) {
   RunTest(size_block, size, matrix_a, matrix_b, matrix_ans);
 }
 
+TEST(filatev_v_foks_all, test_matrix_37_600_block_3_several_panels) {
+  std::vector<size_t> size = {600, 37, 37, 600, 37, 37};
+  size_t size_block = 3;
+  std::mt19937 gen(37);
+  std::uniform_int_distribution<int> dist(-9, 9);
+  std::vector<double> matrix_a(37 * 600);
+  std::vector<double> matrix_b(600 * 37);
+  for (auto& el : matrix_a) {
+    el = dist(gen);
+  }
+  for (auto& el : matrix_b) {
+    el = dist(gen);
+  }
+  std::vector<double> matrix_ans(37 * 37, 0.0);
+  for (size_t i = 0; i < 37; ++i) {
+    for (size_t k = 0; k < 600; ++k) {
+      for (size_t j = 0; j < 37; ++j) {
+        matrix_ans[(i * 37) + j] += matrix_a[(i * 600) + k] * matrix_b[(k * 37) + j];
+      }
+    }
+  }
+
+  RunTest(size_block, size, matrix_a, matrix_b, matrix_ans);
+}
+
 TEST(filatev_v_foks_all, test_error_matrix_size_b) {
   std::vector<size_t> size = {1, 4, 1, 4, 4, 4};
   size_t size_block = 2;
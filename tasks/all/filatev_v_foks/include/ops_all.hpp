@@ -1,7 +1,6 @@
 #pragma once
 
 #include <cstddef>
-#include <mutex>
 #include <utility>
 #include <vector>
 
@@ -35,14 +34,11 @@ class Focks : public ppc::core::Task {
   MatrixSize size_c_;
 
   size_t size_block_{};
-  size_t size_{};
 
   std::vector<double> matrix_a_;
   std::vector<double> matrix_b_;
   std::vector<double> matrix_c_;
   boost::mpi::communicator world_;
-
-  void Worker(size_t start_step, size_t end_step, size_t grid_size, std::mutex &mtx);
 };
 
 }  // namespace filatev_v_foks_all
\ No newline at end of file
@@ -191,6 +191,10 @@ TEST(nasedkin_e_strassen_algorithm_all, test_matrix_63x63_random_identity) { Run
 TEST(nasedkin_e_strassen_algorithm_all, test_matrix_64x64_random_identity) { RunRandomMatrixIdentityTest(64); }
 TEST(nasedkin_e_strassen_algorithm_all, test_matrix_63x63_fixed) { RunFixedMatrixTest(63); }
 TEST(nasedkin_e_strassen_algorithm_all, test_matrix_64x64_fixed) { RunFixedMatrixTest(64); }
+TEST(nasedkin_e_strassen_algorithm_all, test_matrix_1x1_fixed) { RunFixedMatrixTest(1); }
+TEST(nasedkin_e_strassen_algorithm_all, test_matrix_2x2_fixed) { RunFixedMatrixTest(2); }
+TEST(nasedkin_e_strassen_algorithm_all, test_matrix_3x3_fixed) { RunFixedMatrixTest(3); }
+TEST(nasedkin_e_strassen_algorithm_all, test_matrix_257x257_fixed) { RunFixedMatrixTest(257); }
 TEST(nasedkin_e_strassen_algorithm_all, test_matrix_64x64_random) { RunRandomMatrixTest(64); }
 TEST(nasedkin_e_strassen_algorithm_all, test_matrix_127x127_random) { RunRandomMatrixTest(127); }
 TEST(nasedkin_e_strassen_algorithm_all, test_matrix_128x128_random) { RunRandomMatrixTest(128); }
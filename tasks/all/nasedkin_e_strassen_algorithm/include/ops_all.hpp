@@ -1,6 +1,7 @@
 #pragma once
 
-#include <mutex>
+#include <cstddef>
+#include <span>
 #include <utility>
 #include <vector>
 
@@ -20,24 +21,26 @@ class StrassenAll : public ppc::core::Task {
   bool PostProcessingImpl() override;
 
  private:
-  static std::vector<double> AddMatrices(const std::vector<double>& a, const std::vector<double>& b, int size);
-  static std::vector<double> SubtractMatrices(const std::vector<double>& a, const std::vector<double>& b, int size);
-  static void SplitMatrix(const std::vector<double>& parent, std::vector<double>& child, int row_start, int col_start,
-                          int parent_size);
-  static void MergeMatrix(std::vector<double>& parent, const std::vector<double>& child, int row_start, int col_start,
-                          int parent_size);
-  static std::vector<double> PadMatrixToPowerOfTwo(const std::vector<double>& matrix, int original_size);
-  static std::vector<double> TrimMatrixToOriginalSize(const std::vector<double>& matrix, int original_size,
-                                                      int padded_size);
-  static std::vector<double> StrassenMultiply(const std::vector<double>& a, const std::vector<double>& b, int size);
-  static void StrassenWorker(int prod_idx, const std::vector<double>& a, const std::vector<double>& b, int size,
-                             std::vector<double>& result, std::mutex& mtx);
+  static constexpr int kNumProds = 7;
+
+  void StrassenWorker(int prod_idx, size_t slot, std::span<double> workspace);
+  void CombineProducts();
 
   std::vector<double> input_matrix_a_;
   std::vector<double> input_matrix_b_;
   std::vector<double> output_matrix_;
+  // Top-level Winograd products P1..P7; this rank computes the ones with prod_idx % world size == rank,
+  // each as a tree of TBB tasks
+  std::vector<double> products_;
+  // Operand sums of the products owned by this rank and the Strassen workspace of each of them
+  std::vector<double> operands_a_;
+  std::vector<double> operands_b_;
+  std::vector<double> workspace_;
+  std::vector<int> owned_prods_;
   int matrix_size_{};
-  int original_size_{};
+  size_t cutoff_{};
+  size_t task_depth_{};
+  int num_threads_{1};
   boost::mpi::communicator world_;
 };
 
@@ -1,21 +1,33 @@
 #include "all/nasedkin_e_strassen_algorithm/include/ops_all.hpp"
 
 #include <algorithm>
-#include <boost/serialization/vector.hpp>  // NOLINT(*-include-cleaner)
+#include <array>
 #include <cmath>
 #include <cstddef>
-#include <functional>
-#include <limits>
-#include <mutex>
-#include <stdexcept>
-#include <thread>
+#include <span>
 #include <vector>
 
 #include "boost/mpi/collectives/broadcast.hpp"
+#include "core/matmul/include/strassen.hpp"
 #include "core/util/include/util.hpp"
+#include "oneapi/tbb/task_arena.h"
+#include "oneapi/tbb/task_group.h"
 
 namespace nasedkin_e_strassen_algorithm_all {
 
+namespace {
+
+// Runs func(0), ..., func(count - 1) as TBB tasks and waits for all of them
+void ForkJoin(size_t count, const auto &func) {
+  oneapi::tbb::task_group group;
+  for (size_t i = 0; i < count; ++i) {
+    group.run([&func, i] { func(i); });
+  }
+  group.wait();
+}
+
+}  // namespace
+
 bool StrassenAll::PreProcessingImpl() {
   if (world_.rank() == 0) {
     unsigned int input_size = task_data->inputs_count[0];
@@ -23,23 +35,32 @@ bool StrassenAll::PreProcessingImpl() {
     auto *in_ptr_b = reinterpret_cast<double *>(task_data->inputs[1]);
 
     matrix_size_ = static_cast<int>(std::sqrt(input_size));
-    input_matrix_a_.resize(matrix_size_ * matrix_size_);
-    input_matrix_b_.resize(matrix_size_ * matrix_size_);
-
-    std::ranges::copy(in_ptr_a, in_ptr_a + input_size, input_matrix_a_.begin());
-    std::ranges::copy(in_ptr_b, in_ptr_b + input_size, input_matrix_b_.begin());
-
-    if ((matrix_size_ & (matrix_size_ - 1)) != 0) {
-      original_size_ = matrix_size_;
-      input_matrix_a_ = PadMatrixToPowerOfTwo(input_matrix_a_, matrix_size_);
-      input_matrix_b_ = PadMatrixToPowerOfTwo(input_matrix_b_, matrix_size_);
-      matrix_size_ = static_cast<int>(std::sqrt(input_matrix_a_.size()));
-    } else {
-      original_size_ = matrix_size_;
-    }
-
-    output_matrix_.resize(matrix_size_ * matrix_size_, 0.0);
+    input_matrix_a_.assign(in_ptr_a, in_ptr_a + input_size);
+    input_matrix_b_.assign(in_ptr_b, in_ptr_b + input_size);
+    cutoff_ = ppc::matmul::StrassenCutoff();
+  }
+  // Every buffer Run needs is sized here, so Run itself does not allocate
+  boost::mpi::broadcast(world_, matrix_size_, 0);
+  boost::mpi::broadcast(world_, cutoff_, 0);
+  const auto size = static_cast<size_t>(matrix_size_);
+  const size_t half_size = size / 2;
+  input_matrix_a_.resize(size * size);
+  input_matrix_b_.resize(size * size);
+  output_matrix_.assign(size * size, 0.0);
+  products_.assign(kNumProds * half_size * half_size, 0.0);
+
+  owned_prods_.clear();
+  for (int i = world_.rank(); i < kNumProds; i += world_.size()) {
+    owned_prods_.push_back(i);
   }
+  operands_a_.resize(owned_prods_.size() * half_size * half_size);
+  operands_b_.resize(owned_prods_.size() * half_size * half_size);
+  // Spawn products as tasks until this rank has at least one task per core
+  num_threads_ = ppc::util::GetPPCNumThreads();
+  task_depth_ =
+      ppc::matmul::StrassenTaskDepth(half_size, owned_prods_.size(), static_cast<size_t>(num_threads_), cutoff_);
+  workspace_.resize(owned_prods_.size() *
+                    ppc::matmul::ParallelStrassenWorkspaceSize(half_size, half_size, half_size, task_depth_, cutoff_));
   return true;
 }
 
@@ -64,198 +85,67 @@ bool StrassenAll::ValidationImpl() {
 }
 
 bool StrassenAll::RunImpl() {
-  boost::mpi::broadcast(world_, matrix_size_, 0);
-  boost::mpi::broadcast(world_, original_size_, 0);
-  if (world_.rank() != 0) {
-    input_matrix_a_.resize(matrix_size_ * matrix_size_);
-    input_matrix_b_.resize(matrix_size_ * matrix_size_);
-    output_matrix_.resize(matrix_size_ * matrix_size_, 0.0);
-  }
-  boost::mpi::broadcast(world_, input_matrix_a_, 0);
-  boost::mpi::broadcast(world_, input_matrix_b_, 0);
-
-  constexpr int kNumProds = 7;
-  int half_size = matrix_size_ / 2;
-  std::vector<double> a11(half_size * half_size);
-  std::vector<double> a12(half_size * half_size);
-  std::vector<double> a21(half_size * half_size);
-  std::vector<double> a22(half_size * half_size);
-  std::vector<double> b11(half_size * half_size);
-  std::vector<double> b12(half_size * half_size);
-  std::vector<double> b21(half_size * half_size);
-  std::vector<double> b22(half_size * half_size);
-
-  SplitMatrix(input_matrix_a_, a11, 0, 0, matrix_size_);
-  SplitMatrix(input_matrix_a_, a12, 0, half_size, matrix_size_);
-  SplitMatrix(input_matrix_a_, a21, half_size, 0, matrix_size_);
-  SplitMatrix(input_matrix_a_, a22, half_size, half_size, matrix_size_);
-  SplitMatrix(input_matrix_b_, b11, 0, 0, matrix_size_);
-  SplitMatrix(input_matrix_b_, b12, 0, half_size, matrix_size_);
-  SplitMatrix(input_matrix_b_, b21, half_size, 0, matrix_size_);
-  SplitMatrix(input_matrix_b_, b22, half_size, half_size, matrix_size_);
-
-  std::vector<std::vector<double>> products(kNumProds, std::vector<double>(half_size * half_size));
-  std::mutex mtx;
-  std::vector<std::thread> threads;
-
-  for (size_t i = world_.rank(); i < kNumProds; i += world_.size()) {
-    threads.emplace_back(&StrassenAll::StrassenWorker, i, std::cref(input_matrix_a_), std::cref(input_matrix_b_),
-                         matrix_size_, std::ref(products[i]), std::ref(mtx));
-  }
-  for (auto &t : threads) {
-    t.join();
-  }
+  const auto size = static_cast<size_t>(matrix_size_);
+  const size_t block = (size / 2) * (size / 2);
+  boost::mpi::broadcast(world_, input_matrix_a_.data(), static_cast<int>(size * size), 0);
+  boost::mpi::broadcast(world_, input_matrix_b_.data(), static_cast<int>(size * size), 0);
+
+  const size_t workspace_size = workspace_.size() / std::max<size_t>(owned_prods_.size(), 1);
+  oneapi::tbb::task_arena arena(num_threads_);
+  arena.execute([&] {
+    ForkJoin(owned_prods_.size(), [&](size_t slot) {
+      StrassenWorker(owned_prods_[slot], slot,
+                     std::span<double>(workspace_).subspan(slot * workspace_size, workspace_size));
+    });
+  });
 
   if (world_.rank() == 0) {
-    std::vector<std::vector<double>> all_products(kNumProds, std::vector<double>(half_size * half_size));
-    for (size_t i = 0; i < kNumProds; ++i) {
-      if (i % world_.size() == 0) {
-        all_products[i] = products[i];
-      } else {
-        size_t src = i % world_.size();
-        if (i > static_cast<size_t>(std::numeric_limits<int>::max())) {
-          throw std::runtime_error("Tag value too large for int");
-        }
-        world_.recv(static_cast<int>(src), static_cast<int>(i), all_products[i]);
+    for (int i = 0; i < kNumProds; ++i) {
+      if (i % world_.size() != 0) {
+        world_.recv(i % world_.size(), i, products_.data() + (static_cast<size_t>(i) * block), static_cast<int>(block));
       }
     }
-
-    std::vector<double> c11 = AddMatrices(
-        SubtractMatrices(AddMatrices(all_products[0], all_products[3], half_size), all_products[4], half_size),
-        all_products[6], half_size);
-    std::vector<double> c12 = AddMatrices(all_products[2], all_products[4], half_size);
-    std::vector<double> c21 = AddMatrices(all_products[1], all_products[3], half_size);
-    std::vector<double> c22 = AddMatrices(
-        SubtractMatrices(AddMatrices(all_products[0], all_products[2], half_size), all_products[1], half_size),
-        all_products[5], half_size);
-
-    output_matrix_.resize(matrix_size_ * matrix_size_);
-    MergeMatrix(output_matrix_, c11, 0, 0, matrix_size_);
-    MergeMatrix(output_matrix_, c12, 0, half_size, matrix_size_);
-    MergeMatrix(output_matrix_, c21, half_size, 0, matrix_size_);
-    MergeMatrix(output_matrix_, c22, half_size, half_size, matrix_size_);
+    CombineProducts();
   } else {
-    for (size_t i = world_.rank(); i < kNumProds; i += world_.size()) {
-      if (i > static_cast<size_t>(std::numeric_limits<int>::max())) {
-        throw std::runtime_error("Tag value too large for int");
-      }
-      world_.send(0, static_cast<int>(i), products[i]);
+    for (int i : owned_prods_) {
+      world_.send(0, i, products_.data() + (static_cast<size_t>(i) * block), static_cast<int>(block));
     }
   }
-
-  world_.barrier();
   return true;
 }
 
-void StrassenAll::StrassenWorker(int prod_idx, const std::vector<double> &a, const std::vector<double> &b, int size,
-                                 std::vector<double> &result, std::mutex &mtx) {
-  std::vector<double> local_result;
-  if (size <= 32) {
-    local_result = StandardMultiply(a, b, size);
-  } else {
-    int half_size = size / 2;
-    std::vector<double> a11(half_size * half_size);
-    std::vector<double> a12(half_size * half_size);
-    std::vector<double> a21(half_size * half_size);
-    std::vector<double> a22(half_size * half_size);
-    std::vector<double> b11(half_size * half_size);
-    std::vector<double> b12(half_size * half_size);
-    std::vector<double> b21(half_size * half_size);
-    std::vector<double> b22(half_size * half_size);
-
-    SplitMatrix(a, a11, 0, 0, size);
-    SplitMatrix(a, a12, 0, half_size, size);
-    SplitMatrix(a, a21, half_size, 0, size);
-    SplitMatrix(a, a22, half_size, half_size, size);
-    SplitMatrix(b, b11, 0, 0, size);
-    SplitMatrix(b, b12, 0, half_size, size);
-    SplitMatrix(b, b21, half_size, 0, size);
-    SplitMatrix(b, b22, half_size, half_size, size);
-
-    std::vector<std::vector<double>> inputs_a(7);
-    std::vector<std::vector<double>> inputs_b(7);
-    switch (prod_idx) {
-      case 0:
-        inputs_a[0] = AddMatrices(a11, a22, half_size);
-        inputs_b[0] = AddMatrices(b11, b22, half_size);
-        break;
-      case 1:
-        inputs_a[1] = AddMatrices(a21, a22, half_size);
-        inputs_b[1] = b11;
-        break;
-      case 2:
-        inputs_a[2] = a11;
-        inputs_b[2] = SubtractMatrices(b12, b22, half_size);
-        break;
-      case 3:
-        inputs_a[3] = a22;
-        inputs_b[3] = SubtractMatrices(b21, b11, half_size);
-        break;
-      case 4:
-        inputs_a[4] = AddMatrices(a11, a12, half_size);
-        inputs_b[4] = b22;
-        break;
-      case 5:
-        inputs_a[5] = SubtractMatrices(a21, a11, half_size);
-        inputs_b[5] = AddMatrices(b11, b12, half_size);
-        break;
-      case 6:
-        inputs_a[6] = SubtractMatrices(a12, a22, half_size);
-        inputs_b[6] = AddMatrices(b21, b22, half_size);
-        break;
-      default:
-        break;
-    }
+// Computes one top-level Winograd product; its own products are spawned as tasks down to task_depth_
+void StrassenAll::StrassenWorker(int prod_idx, size_t slot, std::span<double> workspace) {
+  const auto size = static_cast<size_t>(matrix_size_);
+  const size_t half = size / 2;
+  const auto operands = ppc::matmul::PrepareWinogradProduct(
+      prod_idx, half, half, half, input_matrix_a_.data(), size, input_matrix_b_.data(), size,
+      operands_a_.data() + (slot * half * half), operands_b_.data() + (slot * half * half));
+  ppc::matmul::ParallelStrassen(half, half, half, operands.lhs, operands.ld_lhs, operands.rhs, operands.ld_rhs,
+                                products_.data() + (static_cast<size_t>(prod_idx) * half * half), half, workspace,
+                                task_depth_, [](size_t count, const auto &func) { ForkJoin(count, func); }, cutoff_);
+}
 
-    local_result.resize(half_size * half_size);
-    if (size <= 32) {
-      local_result = StandardMultiply(inputs_a[prod_idx], inputs_b[prod_idx], half_size);
-    } else {
-      std::vector<std::thread> threads;
-      size_t num_threads = ppc::util::GetPPCNumThreads();
-      threads.reserve(num_threads);
-      std::mutex local_mtx;
-      for (size_t t = 0; t < num_threads; ++t) {
-        threads.emplace_back([&inputs_a, &inputs_b, prod_idx, half_size, &local_result, &local_mtx]() {
-          auto temp = StrassenMultiply(inputs_a[prod_idx], inputs_b[prod_idx], half_size);
-          std::lock_guard<std::mutex> lock(local_mtx);
-          local_result = temp;
-        });
-      }
-      for (auto &t : threads) {
-        t.join();
-      }
-    }
+void StrassenAll::CombineProducts() {
+  const auto size = static_cast<size_t>(matrix_size_);
+  const size_t half = size / 2;
+  std::array<const double *, ppc::matmul::kStrassenProducts> products{};
+  for (size_t i = 0; i < products.size(); ++i) {
+    products[i] = products_.data() + (i * half * half);
   }
-
-  std::lock_guard<std::mutex> lock(mtx);
-  result = local_result;
+  ppc::matmul::CombineWinogradProducts(half, half, products, output_matrix_.data(), size);
+  ppc::matmul::CompleteOddEdges(size, size, size, input_matrix_a_.data(), size, input_matrix_b_.data(), size,
+                                output_matrix_.data(), size);
 }
 
 bool StrassenAll::PostProcessingImpl() {
   if (world_.rank() == 0) {
-    if (original_size_ != matrix_size_) {
-      output_matrix_ = TrimMatrixToOriginalSize(output_matrix_, original_size_, matrix_size_);
-    }
     auto *out_ptr = reinterpret_cast<double *>(task_data->outputs[0]);
     std::ranges::copy(output_matrix_, out_ptr);
   }
   return true;
 }
 
-std::vector<double> StrassenAll::AddMatrices(const std::vector<double> &a, const std::vector<double> &b, int size) {
-  std::vector<double> result(size * size);
-  std::ranges::transform(a, b, result.begin(), std::plus<>());
-  return result;
-}
-
-std::vector<double> StrassenAll::SubtractMatrices(const std::vector<double> &a, const std::vector<double> &b,
-                                                  int size) {
-  std::vector<double> result(size * size);
-  std::ranges::transform(a, b, result.begin(), std::minus<>());
-  return result;
-}
-
 std::vector<double> StandardMultiply(const std::vector<double> &a, const std::vector<double> &b, int size) {
   std::vector<double> result(size * size, 0.0);
   for (int i = 0; i < size; ++i) {
@@ -268,98 +158,4 @@ std::vector<double> StandardMultiply(const std::vector<double> &a, const std::ve
   return result;
 }
 
-std::vector<double> StrassenAll::PadMatrixToPowerOfTwo(const std::vector<double> &matrix, int original_size) {
-  int new_size = 1;
-  while (new_size < original_size) {
-    new_size *= 2;
-  }
-  std::vector<double> padded_matrix(new_size * new_size, 0);
-  for (int i = 0; i < original_size; ++i) {
-    std::ranges::copy(matrix.begin() + i * original_size, matrix.begin() + (i + 1) * original_size,
-                      padded_matrix.begin() + i * new_size);
-  }
-  return padded_matrix;
-}
-
-std::vector<double> StrassenAll::TrimMatrixToOriginalSize(const std::vector<double> &matrix, int original_size,
-                                                          int padded_size) {
-  std::vector<double> trimmed_matrix(original_size * original_size);
-  for (int i = 0; i < original_size; ++i) {
-    std::ranges::copy(matrix.begin() + i * padded_size, matrix.begin() + i * padded_size + original_size,
-                      trimmed_matrix.begin() + i * original_size);
-  }
-  return trimmed_matrix;
-}
-
-std::vector<double> StrassenAll::StrassenMultiply(const std::vector<double> &a, const std::vector<double> &b,
-                                                  int size) {
-  if (size <= 32) {
-    return StandardMultiply(a, b, size);
-  }
-
-  int half_size = size / 2;
-  int half_size_squared = half_size * half_size;
-
-  std::vector<double> a11(half_size_squared);
-  std::vector<double> a12(half_size_squared);
-  std::vector<double> a21(half_size_squared);
-  std::vector<double> a22(half_size_squared);
-  std::vector<double> b11(half_size_squared);
-  std::vector<double> b12(half_size_squared);
-  std::vector<double> b21(half_size_squared);
-  std::vector<double> b22(half_size_squared);
-
-  SplitMatrix(a, a11, 0, 0, size);
-  SplitMatrix(a, a12, 0, half_size, size);
-  SplitMatrix(a, a21, half_size, 0, size);
-  SplitMatrix(a, a22, half_size, half_size, size);
-  SplitMatrix(b, b11, 0, 0, size);
-  SplitMatrix(b, b12, 0, half_size, size);
-  SplitMatrix(b, b21, half_size, 0, size);
-  SplitMatrix(b, b22, half_size, half_size, size);
-
-  std::vector<double> p1 =
-      StrassenMultiply(AddMatrices(a11, a22, half_size), AddMatrices(b11, b22, half_size), half_size);
-  std::vector<double> p2 = StrassenMultiply(AddMatrices(a21, a22, half_size), b11, half_size);
-  std::vector<double> p3 = StrassenMultiply(a11, SubtractMatrices(b12, b22, half_size), half_size);
-  std::vector<double> p4 = StrassenMultiply(a22, SubtractMatrices(b21, b11, half_size), half_size);
-  std::vector<double> p5 = StrassenMultiply(AddMatrices(a11, a12, half_size), b22, half_size);
-  std::vector<double> p6 =
-      StrassenMultiply(SubtractMatrices(a21, a11, half_size), AddMatrices(b11, b12, half_size), half_size);
-  std::vector<double> p7 =
-      StrassenMultiply(SubtractMatrices(a12, a22, half_size), AddMatrices(b21, b22, half_size), half_size);
-
-  std::vector<double> c11 = AddMatrices(SubtractMatrices(AddMatrices(p1, p4, half_size), p5, half_size), p7, half_size);
-  std::vector<double> c12 = AddMatrices(p3, p5, half_size);
-  std::vector<double> c21 = AddMatrices(p2, p4, half_size);
-  std::vector<double> c22 = AddMatrices(SubtractMatrices(AddMatrices(p1, p3, half_size), p2, half_size), p6, half_size);
-
-  std::vector<double> result(size * size);
-  MergeMatrix(result, c11, 0, 0, size);
-  MergeMatrix(result, c12, 0, half_size, size);
-  MergeMatrix(result, c21, half_size, 0, size);
-  MergeMatrix(result, c22, half_size, half_size, size);
-
-  return result;
-}
-
-void StrassenAll::SplitMatrix(const std::vector<double> &parent, std::vector<double> &child, int row_start,
-                              int col_start, int parent_size) {
-  int child_size = static_cast<int>(std::sqrt(child.size()));
-  for (int i = 0; i < child_size; ++i) {
-    std::ranges::copy(parent.begin() + (row_start + i) * parent_size + col_start,
-                      parent.begin() + (row_start + i) * parent_size + col_start + child_size,
-                      child.begin() + i * child_size);
-  }
-}
-
-void StrassenAll::MergeMatrix(std::vector<double> &parent, const std::vector<double> &child, int row_start,
-                              int col_start, int parent_size) {
-  int child_size = static_cast<int>(std::sqrt(child.size()));
-  for (int i = 0; i < child_size; ++i) {
-    std::ranges::copy(child.begin() + i * child_size, child.begin() + (i + 1) * child_size,
-                      parent.begin() + (row_start + i) * parent_size + col_start);
-  }
-}
-
-}  // namespace nasedkin_e_strassen_algorithm_all
\ No newline at end of file
+}  // namespace nasedkin_e_strassen_algorithm_all
@@ -196,3 +196,65 @@ TEST(odintsov_m_mulmatrix_cannon_all, test_block_sz_1) {
     }
   }
 }
+
+TEST(odintsov_m_mulmatrix_cannon_all, test_matrix_37_odd_blocks) {
+  boost::mpi::communicator com;
+  std::vector<double> matrix_a = odintsov_m_mulmatrix_cannon_all::GenerateMatrix(37);
+  std::vector<double> matrix_b = odintsov_m_mulmatrix_cannon_all::GenerateMatrix(37);
+  std::vector<double> out_all(1369, 0);
+  std::vector<double> out_ans = odintsov_m_mulmatrix_cannon_all::MultiplyMatrices(matrix_a, matrix_b, 37);
+
+  auto task_data_all = std::make_shared<ppc::core::TaskData>();
+  if (com.rank() == 0) {
+    task_data_all->inputs.emplace_back(reinterpret_cast<uint8_t *>(matrix_a.data()));
+    task_data_all->inputs.emplace_back(reinterpret_cast<uint8_t *>(matrix_b.data()));
+    task_data_all->inputs_count.emplace_back(matrix_a.size());
+    task_data_all->inputs_count.emplace_back(matrix_b.size());
+    task_data_all->outputs.emplace_back(reinterpret_cast<uint8_t *>(out_all.data()));
+  }
+  odintsov_m_mulmatrix_cannon_all::MulMatrixCannonALL test_task_all(task_data_all);
+
+  ASSERT_EQ(test_task_all.Validation(), true);
+
+  test_task_all.PreProcessing();
+  test_task_all.Run();
+  test_task_all.PostProcessing();
+
+  if (com.rank() == 0) {
+    ASSERT_EQ(out_ans.size(), out_all.size());
+    for (size_t i = 0; i < out_ans.size(); ++i) {
+      EXPECT_NEAR(out_ans[i], out_all[i], 0.00001);
+    }
+  }
+}
+
+TEST(odintsov_m_mulmatrix_cannon_all, test_matrix_300_several_panels) {
+  boost::mpi::communicator com;
+  std::vector<double> matrix_a = odintsov_m_mulmatrix_cannon_all::GenerateMatrix(300);
+  std::vector<double> matrix_b = odintsov_m_mulmatrix_cannon_all::GenerateMatrix(300);
+  std::vector<double> out_all(90000, 0);
+  std::vector<double> out_ans = odintsov_m_mulmatrix_cannon_all::MultiplyMatrices(matrix_a, matrix_b, 300);
+
+  auto task_data_all = std::make_shared<ppc::core::TaskData>();
+  if (com.rank() == 0) {
+    task_data_all->inputs.emplace_back(reinterpret_cast<uint8_t *>(matrix_a.data()));
+    task_data_all->inputs.emplace_back(reinterpret_cast<uint8_t *>(matrix_b.data()));
+    task_data_all->inputs_count.emplace_back(matrix_a.size());
+    task_data_all->inputs_count.emplace_back(matrix_b.size());
+    task_data_all->outputs.emplace_back(reinterpret_cast<uint8_t *>(out_all.data()));
+  }
+  odintsov_m_mulmatrix_cannon_all::MulMatrixCannonALL test_task_all(task_data_all);
+
+  ASSERT_EQ(test_task_all.Validation(), true);
+
+  test_task_all.PreProcessing();
+  test_task_all.Run();
+  test_task_all.PostProcessing();
+
+  if (com.rank() == 0) {
+    ASSERT_EQ(out_ans.size(), out_all.size());
+    for (size_t i = 0; i < out_ans.size(); ++i) {
+      EXPECT_NEAR(out_ans[i], out_all[i], 1e-6);
+    }
+  }
+}
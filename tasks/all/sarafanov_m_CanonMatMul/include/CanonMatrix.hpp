@@ -1,40 +0,0 @@
-#pragma once
-
-#include <cstddef>
-#include <vector>
-
-enum class MatrixType : char { kRowMatrix, kColumnMatrix };
-
-namespace sarafanov_m_canon_mat_mul_all {
-class CanonMatrix {
-  std::vector<double> matrix_;
-  size_t sqrt_size_ = 0;
-  size_t size_ = 0;
-
-  void CalculateSize(size_t s);
-  [[nodiscard]] size_t GetRowIndex(size_t index, size_t row_number) const;
-  [[nodiscard]] size_t GetColumnIndex(size_t index, size_t column_index, size_t offset) const;
-
- public:
-  template <typename Archive>
-  // NOLINTNEXTLINE(readability-identifier-naming)
-  void serialize(Archive& archive, const unsigned int) {
-    archive & matrix_;
-    archive & size_;
-    archive & sqrt_size_;
-  }
-  CanonMatrix() = default;
-  CanonMatrix(const std::vector<double>& initial_vector);
-  void SetBaseMatrix(std::vector<double>&& initial_vector);
-  void Transpose();
-  void StairShift();
-  void PreRoutine(MatrixType type);
-  [[nodiscard]] const std::vector<double>& GetMatrix() const;
-  [[nodiscard]] size_t GetSize() const;
-  [[nodiscard]] size_t GetSqrtSize() const;
-  [[nodiscard]] bool IsEmpty() const;
-  CanonMatrix MultiplicateMatrix(const CanonMatrix& canon_matrix, size_t offset);
-  void operator+=(const CanonMatrix& canon_matrix);
-  void ClearMatrix();
-};
-}  // namespace sarafanov_m_canon_mat_mul_all
\ No newline at end of file
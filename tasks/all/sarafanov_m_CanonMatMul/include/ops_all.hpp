@@ -1,32 +1,24 @@
 #pragma once
 
 #include <boost/mpi/communicator.hpp>
+#include <cstddef>
 #include <utility>
 #include <vector>
 
-#include "all/sarafanov_m_CanonMatMul/include/CanonMatrix.hpp"
 #include "core/task/include/task.hpp"
 
 namespace sarafanov_m_canon_mat_mul_all {
-struct IndexesPair {
-  int first = 0;
-  int second = 0;
-  IndexesPair() = default;
-  IndexesPair(int first, int second);
-  template <typename Archive>
-  // NOLINTNEXTLINE(readability-identifier-naming)
-  void serialize(Archive& archive, const unsigned int) {
-    archive & first;
-    archive & second;
-  }
-};
 class CanonMatMulALL : public ppc::core::Task {
-  CanonMatrix a_matrix_;
-  CanonMatrix b_matrix_;
-  CanonMatrix c_matrix_;
-  CanonMatrix matrix_sum_on_process_;
+  std::vector<double> a_matrix_;
+  std::vector<double> b_matrix_;
+  std::vector<double> c_matrix_;
+  // A is a_rows_ x a_columns_, B is a_columns_ x b_columns_
+  size_t a_rows_ = 0;
+  size_t a_columns_ = 0;
+  size_t b_columns_ = 0;
+  // Row length of the output, which holds the product padded with zeros to a square matrix
+  size_t out_columns_ = 0;
   boost::mpi::communicator world_;
-  std::vector<IndexesPair> indexes_;
 
  public:
   explicit CanonMatMulALL(ppc::core::TaskDataPtr task_data) : Task(std::move(task_data)) {}
@@ -34,8 +26,5 @@ class CanonMatMulALL : public ppc::core::Task {
   bool ValidationImpl() override;
   bool RunImpl() override;
   bool PostProcessingImpl() override;
-  bool CheckSquareSize(int number);
-  void CalculateIndexes();
-  static std::vector<double> ConvertToSquareMatrix(int need_size, MatrixType type, const std::vector<double>& matrx);
 };
-}  // namespace sarafanov_m_canon_mat_mul_all
\ No newline at end of file
+}  // namespace sarafanov_m_canon_mat_mul_all
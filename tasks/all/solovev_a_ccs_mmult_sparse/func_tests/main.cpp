@@ -301,3 +301,74 @@ TEST(solovev_a_ccs_mmult_sparse, test_identity_multiplication) {
     }
   }
 }
+
+TEST(solovev_a_ccs_mmult_sparse, test_rectangular_random_with_empty_columns) {
+  boost::mpi::communicator world;
+
+  const int rows = 30;
+  const int inner = 40;
+  const int cols = 25;
+  solovev_a_matrix_all::MatrixInCcsSparse m1(rows, inner);
+  solovev_a_matrix_all::MatrixInCcsSparse m2(inner, cols);
+  solovev_a_matrix_all::MatrixInCcsSparse m3;
+  std::vector<std::complex<double>> expected(static_cast<size_t>(rows) * cols);
+
+  std::shared_ptr<ppc::core::TaskData> task_data = std::make_shared<ppc::core::TaskData>();
+
+  if (world.rank() == 0) {
+    std::mt19937 gen(7);
+    std::bernoulli_distribution nonzero(0.15);
+    // Columns 3 and 17 of m1 and every fifth column of m2 stay empty
+    auto fill = [&](solovev_a_matrix_all::MatrixInCcsSparse& m, auto empty_column) {
+      m.val.clear();
+      m.row.clear();
+      for (int j = 0; j < m.c_n; j++) {
+        m.col_p[j] = static_cast<int>(m.row.size());
+        for (int i = 0; i < m.r_n; i++) {
+          if (!empty_column(j) && nonzero(gen)) {
+            m.row.push_back(i);
+            m.val.emplace_back(GenerateRandomComplex(-5.0, 5.0));
+          }
+        }
+      }
+      m.col_p[m.c_n] = static_cast<int>(m.row.size());
+      m.n_z = m.col_p[m.c_n];
+    };
+    fill(m1, [](int j) { return j == 3 || j == 17; });
+    fill(m2, [](int j) { return j % 5 == 0; });
+
+    for (int j = 0; j < cols; j++) {
+      for (int e = m2.col_p[j]; e < m2.col_p[j + 1]; e++) {
+        const int k = m2.row[e];
+        for (int f = m1.col_p[k]; f < m1.col_p[k + 1]; f++) {
+          expected[(static_cast<size_t>(j) * rows) + m1.row[f]] += m1.val[f] * m2.val[e];
+        }
+      }
+    }
+
+    task_data->inputs.emplace_back(reinterpret_cast<uint8_t*>(&m1));
+    task_data->inputs.emplace_back(reinterpret_cast<uint8_t*>(&m2));
+    task_data->outputs.emplace_back(reinterpret_cast<uint8_t*>(&m3));
+  }
+
+  solovev_a_matrix_all::SeqMatMultCcs multiplication_task(task_data);
+  ASSERT_EQ(multiplication_task.ValidationImpl(), true);
+  multiplication_task.PreProcessingImpl();
+  multiplication_task.RunImpl();
+  multiplication_task.PostProcessingImpl();
+
+  if (world.rank() == 0) {
+    ASSERT_EQ(m3.r_n, rows);
+    ASSERT_EQ(m3.c_n, cols);
+    ASSERT_EQ(m3.col_p.size(), static_cast<size_t>(cols) + 1);
+    std::vector<std::complex<double>> actual(expected.size());
+    for (int j = 0; j < cols; j++) {
+      for (int e = m3.col_p[j]; e < m3.col_p[j + 1]; e++) {
+        actual[(static_cast<size_t>(j) * rows) + m3.row[e]] = m3.val[e];
+      }
+    }
+    for (size_t i = 0; i < expected.size(); i++) {
+      ASSERT_TRUE(AreComplexNumbersApproxEqual(actual[i], expected[i])) << "at " << i;
+    }
+  }
+}
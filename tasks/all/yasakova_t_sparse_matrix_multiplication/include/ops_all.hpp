@@ -8,20 +8,13 @@
 #include <utility>
 #include <vector>
 
+#include "core/sparse/include/compressed.hpp"
 #include "core/task/include/task.hpp"
 
 using ComplexNum = std::complex<double>;
 
 namespace yasakova_t_sparse_matrix_mult_all {
 
-struct ElementPosition {
-  int row_idx;
-  int col_idx;
-  ComplexNum val;
-};
-
-void AppendElement(std::vector<ElementPosition>& data, int row_idx, int col_idx, const ComplexNum& val);
-
 struct SparseMatrixCRS {
   std::vector<ComplexNum> non_zero_elems;
   std::vector<int> column_idxs;
@@ -34,12 +27,11 @@ struct SparseMatrixCRS {
   SparseMatrixCRS(const SparseMatrixCRS& other) = default;
   SparseMatrixCRS& operator=(const SparseMatrixCRS& other) = default;
   static void DisplayMatrix(const SparseMatrixCRS& matrix);
+  [[nodiscard]] ppc::sparse::CompressedView<ComplexNum> View() const;
 };
 
 std::vector<ComplexNum> ConvertToDense(const SparseMatrixCRS& sparse_mat);
 SparseMatrixCRS ConvertToSparse(std::vector<ComplexNum>& vec);
-SparseMatrixCRS ConstructResultMatrix(
-    const std::vector<yasakova_t_sparse_matrix_mult_all::ElementPosition>& all_results, int a_num_rows, int b_num_cols);
 bool CompareMatrices(const SparseMatrixCRS& a, const SparseMatrixCRS& b);
 bool AreClose(const ComplexNum& a, const ComplexNum& b, double epsilon);
 
@@ -55,7 +47,6 @@ class TestTaskALL : public ppc::core::Task {
   std::vector<ComplexNum> input_data_, output_data_;
   SparseMatrixCRS matrix_a_, matrix_b_;
   boost::mpi::communicator world_;
-  void ProcessRowsRange(int start_row, int end_row, std::vector<ElementPosition>& local_results);
 };
 
 }  // namespace yasakova_t_sparse_matrix_mult_all
\ No newline at end of file
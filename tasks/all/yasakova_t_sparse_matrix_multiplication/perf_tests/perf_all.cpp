@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 
+#include <boost/mpi/communicator.hpp>
 #include <chrono>
 #include <cstdint>
 #include <cstdlib>
@@ -12,6 +13,7 @@
 #include "core/task/include/task.hpp"
 
 TEST(yasakova_t_sparse_matrix_mult_task_all, test_pipeline_run) {
+  boost::mpi::communicator world;
   srand(time(nullptr));
   const int matrix_size = 500;
   const int non_zero_elements = 1000;
@@ -74,6 +76,11 @@ TEST(yasakova_t_sparse_matrix_mult_task_all, test_pipeline_run) {
   perf_analyzer->PipelineRun(perf_attr, perf_results);
   ppc::core::Perf::PrintPerfStatistic(perf_results);
 
+  // Проверка результатов только на нулевом процессе
+  if (world.rank() != 0) {
+    return;
+  }
+
   // Конвертируем результат обратно в матрицу
   yasakova_t_sparse_matrix_mult_all::SparseMatrixCRS actual_result =
       yasakova_t_sparse_matrix_mult_all::ConvertToSparse(output_data);
@@ -94,6 +101,7 @@ TEST(yasakova_t_sparse_matrix_mult_task_all, test_pipeline_run) {
 }
 
 TEST(yasakova_t_sparse_matrix_mult_task_all, test_task_run) {
+  boost::mpi::communicator world;
   srand(time(nullptr));
   const int matrix_size = 500;
   const int non_zero_elements = 1000;
@@ -147,6 +155,10 @@ TEST(yasakova_t_sparse_matrix_mult_task_all, test_task_run) {
   perf_analyzer->TaskRun(perf_attr, perf_results);
   ppc::core::Perf::PrintPerfStatistic(perf_results);
 
+  if (world.rank() != 0) {
+    return;
+  }
+
   yasakova_t_sparse_matrix_mult_all::SparseMatrixCRS actual_result =
       yasakova_t_sparse_matrix_mult_all::ConvertToSparse(output_data);
 
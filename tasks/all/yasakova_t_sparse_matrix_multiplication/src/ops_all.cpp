@@ -1,18 +1,20 @@
 #include "all/yasakova_t_sparse_matrix_multiplication/include/ops_all.hpp"
 
-#include <mpi.h>
 #include <omp.h>
 
-#include <algorithm>
 #include <cmath>
 #include <complex>
 #include <core/util/include/util.hpp>
 #include <cstddef>
 #include <iostream>
-#include <map>
 #include <utility>
 #include <vector>
 
+#include "core/sparse/include/compressed.hpp"
+#include "core/sparse/include/distributed.hpp"
+#include "core/sparse/include/spgemm.hpp"
+#include "core/util/include/fork_join.hpp"
+
 void yasakova_t_sparse_matrix_mult_all::SparseMatrixCRS::InsertElement(int row_idx, ComplexNum val, int col_idx) {
   for (int j = row_ptrs[row_idx]; j < row_ptrs[row_idx + 1]; ++j) {
     if (column_idxs[j] == col_idx) {
@@ -40,11 +42,6 @@ bool yasakova_t_sparse_matrix_mult_all::AreClose(const ComplexNum& a, const Comp
   return std::abs(a.real() - b.real()) < epsilon && std::abs(a.imag() - b.imag()) < epsilon;
 }
 
-void yasakova_t_sparse_matrix_mult_all::AppendElement(std::vector<ElementPosition>& data, int row_idx, int col_idx,
-                                                      const ComplexNum& val) {
-  data.push_back({row_idx, col_idx, val});
-}
-
 std::vector<ComplexNum> yasakova_t_sparse_matrix_mult_all::ConvertToDense(const SparseMatrixCRS& sparse_mat) {
   std::vector<ComplexNum> res = {};
   res.reserve(5 + sparse_mat.non_zero_elems.size() + sparse_mat.column_idxs.size() + sparse_mat.row_ptrs.size());
@@ -117,61 +114,15 @@ yasakova_t_sparse_matrix_mult_all::SparseMatrixCRS yasakova_t_sparse_matrix_mult
   return res;
 }
 
-yasakova_t_sparse_matrix_mult_all::SparseMatrixCRS yasakova_t_sparse_matrix_mult_all::ConstructResultMatrix(
-    const std::vector<yasakova_t_sparse_matrix_mult_all::ElementPosition>& all_results, int a_num_rows,
-    int b_num_cols) {
-  yasakova_t_sparse_matrix_mult_all::SparseMatrixCRS c(a_num_rows, b_num_cols);
-  std::map<std::pair<int, int>, ComplexNum> result_map;
-
-  for (const auto& rv : all_results) {
-    result_map[{rv.row_idx, rv.col_idx}] += rv.val;
-  }
-
-  c.row_ptrs.resize(a_num_rows + 1);
-  c.non_zero_elems.reserve(result_map.size());
-  c.column_idxs.reserve(result_map.size());
-
-  c.row_ptrs[0] = 0;
-
-  for (int i = 0; i < a_num_rows; ++i) {
-    for (auto& kv : result_map) {
-      if (kv.first.first == i && kv.second != ComplexNum(0)) {
-        c.column_idxs.push_back(kv.first.second);
-        c.non_zero_elems.push_back(kv.second);
-      }
-    }
-    c.row_ptrs[i + 1] = static_cast<int>(c.column_idxs.size());
-
-    for (auto it = result_map.begin(); it != result_map.end();) {
-      if (it->first.first == i) {
-        it = result_map.erase(it);
-      } else {
-        ++it;
-      }
-    }
-  }
-  return c;
-}
-
-void yasakova_t_sparse_matrix_mult_all::TestTaskALL::ProcessRowsRange(int start_row, int end_row,
-                                                                      std::vector<ElementPosition>& local_results) {
-  for (int i = start_row; i < end_row; ++i) {
-    for (int j_idx = matrix_a_.row_ptrs[i]; j_idx < matrix_a_.row_ptrs[i + 1]; ++j_idx) {
-      int col_a = matrix_a_.column_idxs[j_idx];
-      ComplexNum value_a = matrix_a_.non_zero_elems[j_idx];
-
-      for (int k_idx = matrix_b_.row_ptrs[col_a]; k_idx < matrix_b_.row_ptrs[col_a + 1]; ++k_idx) {
-        int col_b = matrix_b_.column_idxs[k_idx];
-        ComplexNum value_b = matrix_b_.non_zero_elems[k_idx];
-
-#pragma omp critical
-        AppendElement(local_results, i, col_b, value_a * value_b);
-      }
-    }
-  }
+ppc::sparse::CompressedView<ComplexNum> yasakova_t_sparse_matrix_mult_all::SparseMatrixCRS::View() const {
+  return {.outer = total_rows, .inner = total_cols, .ptr = row_ptrs, .index = column_idxs, .values = non_zero_elems};
 }
 
 bool yasakova_t_sparse_matrix_mult_all::TestTaskALL::PreProcessingImpl() {
+  // Rank 0 alone reads the operands and hands every rank its rows in RunImpl
+  if (world_.rank() != 0) {
+    return true;
+  }
   unsigned int input_size = task_data->inputs_count[0];
   auto* in_ptr = reinterpret_cast<ComplexNum*>(task_data->inputs[0]);
   input_data_ = std::vector<ComplexNum>(in_ptr, in_ptr + input_size);
@@ -195,104 +146,47 @@ bool yasakova_t_sparse_matrix_mult_all::TestTaskALL::PreProcessingImpl() {
 
 bool yasakova_t_sparse_matrix_mult_all::TestTaskALL::ValidationImpl() {
   if (world_.rank() == 0) {
-    unsigned int input_size = task_data->inputs_count[0];
-    auto* in_ptr = reinterpret_cast<ComplexNum*>(task_data->inputs[0]);
-    std::vector<ComplexNum> vec = std::vector<ComplexNum>(in_ptr, in_ptr + input_size);
+    const auto* vec = reinterpret_cast<ComplexNum*>(task_data->inputs[0]);
     return !(vec[1] != vec[5 + (int)(vec[2].real() + vec[3].real() + vec[4].real())].real());
   }
   return true;
 }
 
 bool yasakova_t_sparse_matrix_mult_all::TestTaskALL::RunImpl() {
-  int rank = 0;
-  int size = 0;
-  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
-  MPI_Comm_size(MPI_COMM_WORLD, &size);
-
-  int a_num_rows = matrix_a_.total_rows;
-  int a_num_cols = matrix_a_.total_cols;
-  int b_num_rows = matrix_b_.total_rows;
-  int b_num_cols = matrix_b_.total_cols;
-
-  MPI_Bcast(&a_num_rows, 1, MPI_INT, 0, MPI_COMM_WORLD);
-  MPI_Bcast(&a_num_cols, 1, MPI_INT, 0, MPI_COMM_WORLD);
-  MPI_Bcast(&b_num_rows, 1, MPI_INT, 0, MPI_COMM_WORLD);
-  MPI_Bcast(&b_num_cols, 1, MPI_INT, 0, MPI_COMM_WORLD);
+  const int size = world_.size();
 
-  int row_per_proc = a_num_rows / size;
-  int remainder = a_num_rows % size;
-
-  int start_row = (rank * row_per_proc) + std::min(rank, remainder);
-  int end_row = start_row + row_per_proc + (rank < remainder ? 1 : 0);
-
-  std::vector<ElementPosition> local_results;
-  local_results.reserve((end_row - start_row) * b_num_cols);
+  ppc::sparse::CompressedView<ComplexNum> a;
+  ppc::sparse::CompressedView<ComplexNum> b;
+  std::vector<int> a_bounds;
+  std::vector<int> b_bounds;
+  if (world_.rank() == 0) {
+    a = matrix_a_.View();
+    b = matrix_b_.View();
+    // Rows of A drive the product: ranks get row ranges of equal product count, and rows of B are spread by entries
+    a_bounds = ppc::sparse::SplitByWork(ppc::sparse::WorkPrefix(a, b), size);
+    b_bounds = ppc::sparse::SplitByEntries(b, size);
+  }
+  const auto a_rows = ppc::sparse::Scatter(world_, a, a_bounds);
+  const auto b_rows = ppc::sparse::Scatter(world_, b, b_bounds);
 
   // Установка числа потоков OpenMP
   int num_threads = ppc::util::GetPPCNumThreads();
   omp_set_num_threads(num_threads);
+  auto product = ppc::sparse::MultiplyCrs(world_, a_rows, b_rows, num_threads,
+                                          [](size_t count, const auto& func) { ppc::util::OmpForkJoin(count, func); });
+  ppc::sparse::DropEntries(product.local, [](const ComplexNum& value) { return value == 0.0; });
 
-#pragma omp parallel
-  {
-    std::vector<ElementPosition> thread_local_results;
-    thread_local_results.reserve((end_row - start_row) * b_num_cols / num_threads);
-
-#pragma omp for schedule(static)
-    for (int i = start_row; i < end_row; ++i) {
-      for (int j_idx = matrix_a_.row_ptrs[i]; j_idx < matrix_a_.row_ptrs[i + 1]; ++j_idx) {
-        int col_a = matrix_a_.column_idxs[j_idx];
-        ComplexNum value_a = matrix_a_.non_zero_elems[j_idx];
-
-        for (int k_idx = matrix_b_.row_ptrs[col_a]; k_idx < matrix_b_.row_ptrs[col_a + 1]; ++k_idx) {
-          int col_b = matrix_b_.column_idxs[k_idx];
-          ComplexNum value_b = matrix_b_.non_zero_elems[k_idx];
-
-          AppendElement(thread_local_results, i, col_b, value_a * value_b);
-        }
-      }
-    }
-
-#pragma omp critical
-    local_results.insert(local_results.end(), thread_local_results.begin(), thread_local_results.end());
-  }
-
-  // Сбор результатов с помощью MPI
-  int local_size_bytes = static_cast<int>(local_results.size() * sizeof(ElementPosition));
-  std::vector<int> recv_counts(size);
-  MPI_Gather(&local_size_bytes, 1, MPI_INT, recv_counts.data(), 1, MPI_INT, 0, MPI_COMM_WORLD);
-
-  if (rank == 0) {
-    std::vector<int> displs(size);
-    if (!displs.empty()) {
-      displs[0] = 0;
-      for (int i = 1; i < size; ++i) {
-        displs[i] = displs[i - 1] + recv_counts[i - 1];
-      }
-    }
-    int total_bytes = displs[size - 1] + recv_counts[size - 1];
-
-    std::vector<char> recv_buffer(total_bytes);
-    std::vector<ElementPosition> send_buffer(local_results.begin(), local_results.end());
-
-    MPI_Gatherv(send_buffer.data(), static_cast<int>(send_buffer.size() * sizeof(ElementPosition)), MPI_BYTE,
-                recv_buffer.data(), recv_counts.data(), displs.data(), MPI_BYTE, 0, MPI_COMM_WORLD);
-
-    std::vector<ElementPosition> all_results;
-    all_results.reserve(total_bytes / sizeof(ElementPosition));
-    auto* ptr = reinterpret_cast<ElementPosition*>(recv_buffer.data());
-    size_t count_coords = total_bytes / sizeof(ElementPosition);
-    for (size_t i = 0; i < count_coords; ++i) {
-      all_results.push_back(ptr[i]);
-    }
-
-    yasakova_t_sparse_matrix_mult_all::SparseMatrixCRS c(a_num_rows, b_num_cols);
-    c = ConstructResultMatrix(all_results, a_num_rows, b_num_cols);
-    output_data_ = ConvertToDense(c);
-  } else {
-    MPI_Gatherv(local_results.data(), static_cast<int>(local_results.size() * sizeof(ElementPosition)), MPI_BYTE,
-                nullptr, nullptr, nullptr, MPI_BYTE, 0, MPI_COMM_WORLD);
+  // Every rank keeps its rows of the product; rank 0 collects them only because the task returns C there
+  auto c = ppc::sparse::Gather(world_, product);
+  if (world_.rank() == 0) {
+    SparseMatrixCRS result;
+    result.total_rows = c.outer;
+    result.total_cols = c.inner;
+    result.row_ptrs = std::move(c.ptr);
+    result.column_idxs = std::move(c.index);
+    result.non_zero_elems = std::move(c.values);
+    output_data_ = ConvertToDense(result);
   }
-
   return true;
 }
 
@@ -267,4 +267,42 @@ TEST(gromov_a_fox_algorithm_omp, test_negative_numbers_4x4) {
   for (size_t i = 0; i < out.size(); ++i) {
     EXPECT_NEAR(out[i], expected[i], 1e-9);
   }
-}
\ No newline at end of file
+}
+
+TEST(gromov_a_fox_algorithm_omp, test_random_130x130_ragged_tiles) {
+  constexpr size_t kN = 130;
+
+  std::vector<double> a = GenerateRandomMatrix(kN, -10.0, 10.0);
+  std::vector<double> b = GenerateRandomMatrix(kN, -10.0, 10.0);
+  std::vector<double> out(kN * kN, 0.0);
+
+  std::vector<double> input;
+  input.reserve(a.size() + b.size());
+  std::ranges::copy(a, std::back_inserter(input));
+  std::ranges::copy(b, std::back_inserter(input));
+
+  auto task_data_omp = std::make_shared<ppc::core::TaskData>();
+  task_data_omp->inputs.emplace_back(reinterpret_cast<uint8_t *>(input.data()));
+  task_data_omp->inputs_count.emplace_back(input.size());
+  task_data_omp->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  task_data_omp->outputs_count.emplace_back(out.size());
+
+  gromov_a_fox_algorithm_omp::TestTaskOpenMP test_task_omp(task_data_omp);
+  ASSERT_TRUE(test_task_omp.Validation());
+  test_task_omp.PreProcessing();
+  test_task_omp.Run();
+  test_task_omp.PostProcessing();
+
+  std::vector<double> expected(kN * kN, 0.0);
+  for (size_t i = 0; i < kN; ++i) {
+    for (size_t j = 0; j < kN; ++j) {
+      for (size_t k = 0; k < kN; ++k) {
+        expected[(i * kN) + j] += a[(i * kN) + k] * b[(k * kN) + j];
+      }
+    }
+  }
+
+  for (size_t i = 0; i < out.size(); ++i) {
+    EXPECT_NEAR(out[i], expected[i], 1e-9);
+  }
+}
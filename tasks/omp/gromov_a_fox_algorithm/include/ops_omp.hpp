@@ -1,12 +1,16 @@
 #pragma once
 
+#include <cstddef>
 #include <utility>
-#include <vector>
 
+#include "core/matmul/include/tiled.hpp"
 #include "core/task/include/task.hpp"
 
 namespace gromov_a_fox_algorithm_omp {
 
+// Side of the square tiles the matrices are split into; three tiles stay in L2
+constexpr size_t kFoxTileSize = 64;
+
 class TestTaskOpenMP : public ppc::core::Task {
  public:
   explicit TestTaskOpenMP(ppc::core::TaskDataPtr task_data) : Task(std::move(task_data)) {}
@@ -16,7 +20,8 @@ class TestTaskOpenMP : public ppc::core::Task {
   bool PostProcessingImpl() override;
 
  private:
-  std::vector<double> A_, B_, output_;
+  // Tile-major copies: Fox's broadcast of A(i, (i + stage) mod q) along block row i is just a tile index
+  ppc::matmul::TiledMatrix A_, B_, output_;
   int n_;
   int block_size_;
 };
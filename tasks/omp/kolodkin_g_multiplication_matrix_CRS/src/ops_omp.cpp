@@ -9,6 +9,10 @@
 #include <utility>
 #include <vector>
 
+#include "core/sparse/include/compressed.hpp"
+#include "core/sparse/include/spgemm.hpp"
+#include "core/util/include/fork_join.hpp"
+
 void kolodkin_g_multiplication_matrix_omp::SparseMatrixCRS::AddValue(int row, Complex value, int col) {
   bool found = false;
   for (int j = rowPtr[row]; j < rowPtr[row + 1]; j++) {
@@ -137,40 +141,28 @@ bool kolodkin_g_multiplication_matrix_omp::TestTaskOpenMP::PreProcessingImpl() {
 }
 
 bool kolodkin_g_multiplication_matrix_omp::TestTaskOpenMP::ValidationImpl() {
-  unsigned int input_size = task_data->inputs_count[0];
-  auto* in_ptr = reinterpret_cast<Complex*>(task_data->inputs[0]);
-  std::vector<Complex> vec = std::vector<Complex>(in_ptr, in_ptr + input_size);
+  // Check equality of counts elements
+  const auto* vec = reinterpret_cast<Complex*>(task_data->inputs[0]);
   return !(vec[1] != vec[5 + (int)(vec[2].real() + vec[3].real() + vec[4].real())].real());
 }
 
 bool kolodkin_g_multiplication_matrix_omp::TestTaskOpenMP::RunImpl() {
-  SparseMatrixCRS c(A_.numRows, B_.numCols);
-  std::vector<std::vector<std::pair<unsigned int, Complex>>> local_results(A_.numRows);
-
-#pragma omp parallel for
-  for (int i = 0; i < A_.numRows; i++) {
-    std::vector<std::pair<unsigned int, Complex>> temp_results;
-
-    for (int j = A_.rowPtr[i]; j < A_.rowPtr[i + 1]; j++) {
-      unsigned int col_a = A_.colIndices[j];
-      Complex value_a = A_.values[j];
-
-      for (int k = B_.rowPtr[col_a]; k < B_.rowPtr[col_a + 1]; k++) {
-        unsigned int col_b = B_.colIndices[k];
-        Complex value_b = B_.values[k];
-
-        temp_results.emplace_back(col_b, value_a * value_b);
-      }
-    }
-    local_results[i] = std::move(temp_results);
-  }
-
-  for (int i = 0; i < A_.numRows; i++) {
-    for (const auto& result : local_results[i]) {
-      c.AddValue(i, result.second, (int)result.first);
-    }
-  }
-
+  auto view = [](const SparseMatrixCRS& matrix) {
+    return ppc::sparse::CompressedView<Complex>{.outer = matrix.numRows,
+                                                .inner = matrix.numCols,
+                                                .ptr = matrix.rowPtr,
+                                                .index = matrix.colIndices,
+                                                .values = matrix.values};
+  };
+  auto product = ppc::sparse::MultiplyCrs(view(A_), view(B_), omp_get_max_threads(),
+                                          [](size_t count, const auto& func) { ppc::util::OmpForkJoin(count, func); });
+
+  SparseMatrixCRS c;
+  c.numRows = product.outer;
+  c.numCols = product.inner;
+  c.values = std::move(product.values);
+  c.colIndices = std::move(product.index);
+  c.rowPtr = std::move(product.ptr);
   output_ = ParseMatrixIntoVec(c);
   return true;
 }
@@ -294,3 +294,17 @@ TEST(kondratev_ya_ccs_complex_multiplication_omp, test_incompatible_matrix_sizes
   EXPECT_TRUE(task.ValidationImpl());
   EXPECT_FALSE(task.PreProcessingImpl());
 }
+
+TEST(kondratev_ya_ccs_complex_multiplication_omp, test_multiply_vector_and_dense_block) {
+  const int rows = 40;
+  const int cols = 30;
+  const int columns = 3;
+  auto a = GenerateRandomSparseMatrix({rows, cols}, 0.2);
+  auto x = GenerateRandomSparseMatrix({cols, 1}, 1.0);
+  auto b = GenerateRandomSparseMatrix({cols, columns}, 1.0);
+  auto ccs_a = ConvertToCCS(a, {rows, cols});
+
+  EXPECT_TRUE(IsComplexVectorEqual(ccs_a.MultiplyVector(x), ClassicMultiplyMatrices(a, {rows, cols}, x, {cols, 1})));
+  EXPECT_TRUE(IsComplexVectorEqual(ccs_a.MultiplyDense(b, columns),
+                                   ClassicMultiplyMatrices(a, {rows, cols}, b, {cols, columns})));
+}
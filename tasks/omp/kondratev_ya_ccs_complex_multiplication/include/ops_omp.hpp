@@ -23,6 +23,12 @@ struct CCSMatrix {
   CCSMatrix() : rows(0), cols(0) {}
   CCSMatrix(std::pair<int, int> sizes) : rows(sizes.first), cols(sizes.second) { col_ptrs.resize(cols + 1, 0); }
   CCSMatrix operator*(const CCSMatrix& other) const;
+
+  // this * x on all OpenMP threads
+  [[nodiscard]] std::vector<std::complex<double>> MultiplyVector(const std::vector<std::complex<double>>& x) const;
+  // this * b for a dense row-major block b of cols x columns; the result is rows x columns, row-major
+  [[nodiscard]] std::vector<std::complex<double>> MultiplyDense(const std::vector<std::complex<double>>& b,
+                                                                int columns) const;
 };
 
 class TestTaskOMP : public ppc::core::Task {
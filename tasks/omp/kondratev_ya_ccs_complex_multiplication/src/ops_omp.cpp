@@ -2,12 +2,17 @@
 
 #include <omp.h>
 
-#include <algorithm>
 #include <cmath>
 #include <complex>
+#include <cstddef>
 #include <utility>
 #include <vector>
 
+#include "core/sparse/include/compressed.hpp"
+#include "core/sparse/include/spgemm.hpp"
+#include "core/sparse/include/spmv.hpp"
+#include "core/util/include/fork_join.hpp"
+
 bool kondratev_ya_ccs_complex_multiplication_omp::IsZero(const std::complex<double> &value) {
   return std::norm(value) < kEpsilonForZero;
 }
@@ -49,45 +54,35 @@ bool kondratev_ya_ccs_complex_multiplication_omp::TestTaskOMP::PostProcessingImp
 
 kondratev_ya_ccs_complex_multiplication_omp::CCSMatrix
 kondratev_ya_ccs_complex_multiplication_omp::CCSMatrix::operator*(const CCSMatrix &other) const {
-  CCSMatrix result({rows, other.cols});
-  result.values.reserve(std::min(rows * other.cols, static_cast<int>(values.size() * other.values.size())));
-  result.row_index.reserve(result.values.capacity());
-  result.col_ptrs.resize(other.cols + 1, 0);
-
-  std::vector<std::vector<std::pair<int, std::complex<double>>>> temp_cols(other.cols);
-
-#pragma omp parallel for
-  for (int result_col = 0; result_col < other.cols; result_col++) {
-    std::vector<std::complex<double>> local_temp_col(rows, std::complex<double>(0.0, 0.0));
-
-    for (int k = other.col_ptrs[result_col]; k < other.col_ptrs[result_col + 1]; k++) {
-      int row_other = other.row_index[k];
-      std::complex<double> val_other = other.values[k];
-
-      for (int i = col_ptrs[row_other]; i < col_ptrs[row_other + 1]; i++) {
-        int row_this = row_index[i];
-        local_temp_col[row_this] += values[i] * val_other;
-      }
-    }
-
-    for (int i = 0; i < rows; i++) {
-      if (!IsZero(local_temp_col[i])) {
-        temp_cols[result_col].emplace_back(i, local_temp_col[i]);
-      }
-    }
-  }
+  auto view = [](const CCSMatrix &matrix) {
+    return ppc::sparse::CompressedView<std::complex<double>>{.outer = matrix.cols,
+                                                             .inner = matrix.rows,
+                                                             .ptr = matrix.col_ptrs,
+                                                             .index = matrix.row_index,
+                                                             .values = matrix.values};
+  };
+  auto product = ppc::sparse::MultiplyCcs(view(*this), view(other), omp_get_max_threads(),
+                                          [](size_t count, const auto &func) { ppc::util::OmpForkJoin(count, func); });
+  ppc::sparse::DropEntries(product, [](const std::complex<double> &value) { return IsZero(value); });
 
-  int nonzero_elements_processed = 0;
-  for (int col = 0; col < other.cols; col++) {
-    result.col_ptrs[col] = nonzero_elements_processed;
+  CCSMatrix result({rows, other.cols});
+  result.values = std::move(product.values);
+  result.row_index = std::move(product.index);
+  result.col_ptrs = std::move(product.ptr);
+  return result;
+}
 
-    for (const auto &[row, value] : temp_cols[col]) {
-      result.row_index.emplace_back(row);
-      result.values.emplace_back(value);
-      nonzero_elements_processed++;
-    }
-  }
-  result.col_ptrs[other.cols] = nonzero_elements_processed;
+std::vector<std::complex<double>> kondratev_ya_ccs_complex_multiplication_omp::CCSMatrix::MultiplyVector(
+    const std::vector<std::complex<double>> &x) const {
+  return MultiplyDense(x, 1);
+}
 
-  return result;
-}
\ No newline at end of file
+std::vector<std::complex<double>> kondratev_ya_ccs_complex_multiplication_omp::CCSMatrix::MultiplyDense(
+    const std::vector<std::complex<double>> &b, int columns) const {
+  const ppc::sparse::CompressedView<std::complex<double>> view{
+      .outer = cols, .inner = rows, .ptr = col_ptrs, .index = row_index, .values = values};
+  std::vector<std::complex<double>> c(static_cast<size_t>(rows) * columns);
+  auto fork_join = [](size_t count, const auto &func) { ppc::util::OmpForkJoin(count, func); };
+  ppc::sparse::SpmmCcs<std::complex<double>>(view, b, columns, c, omp_get_max_threads(), fork_join);
+  return c;
+}
@@ -7,6 +7,8 @@
 #include <stdexcept>
 #include <vector>
 
+#include "core/sparse/include/compressed.hpp"
+#include "core/sparse/include/task_data.hpp"
 #include "core/task/include/task.hpp"
 #include "omp/korotin_e_crs_multiplication/include/ops_omp.hpp"
 
@@ -480,4 +482,45 @@ TEST(korotin_e_crs_multiplication_omp, test_rnd_17_23_47) {
   ASSERT_EQ(c_ri, out_ri);
   ASSERT_EQ(c_col, out_col);
   ASSERT_EQ(c_val, out_val);
-}
\ No newline at end of file
+}
+
+TEST(korotin_e_crs_multiplication_omp, test_sparse_layout_30_40_20) {
+  const unsigned int m = 30;
+  const unsigned int n = 40;
+  const unsigned int p = 20;
+  auto a = korotin_e_crs_multiplication_omp::GetRandomMatrix(m, n);
+  auto b = korotin_e_crs_multiplication_omp::GetRandomMatrix(n, p);
+  for (unsigned int i = 0; i < m * n; i++) {
+    if (i % 3 != 0) {
+      a[i] = 0;
+    }
+  }
+  for (unsigned int i = 0; i < n * p; i++) {
+    if (i % 4 != 1) {
+      b[i] = 0;
+    }
+  }
+  const auto a_crs = ppc::sparse::CrsMatrix<double>::FromDense(a.data(), m, n);
+  const auto b_crs = ppc::sparse::CrsMatrix<double>::FromDense(b.data(), n, p);
+  ppc::sparse::CrsMatrix<double> c_crs;
+
+  auto task_data_omp = std::make_shared<ppc::core::TaskData>();
+  ppc::sparse::AddSparseInput(*task_data_omp, a_crs);
+  ppc::sparse::AddSparseInput(*task_data_omp, b_crs);
+  ppc::sparse::AddSparseOutput(*task_data_omp, c_crs);
+
+  korotin_e_crs_multiplication_omp::CrsMultiplicationOMP test_task_omp(task_data_omp);
+  ASSERT_EQ(test_task_omp.Validation(), true);
+  test_task_omp.PreProcessing();
+  test_task_omp.Run();
+  test_task_omp.PostProcessing();
+
+  std::vector<double> c(m * p, 0);
+  korotin_e_crs_multiplication_omp::MatrixMultiplication(a, b, c, m, n, p);
+  const auto expected = ppc::sparse::CrsMatrix<double>::FromDense(c.data(), m, p);
+  ASSERT_EQ(c_crs.shape.rows, static_cast<int>(m));
+  ASSERT_EQ(c_crs.shape.cols, static_cast<int>(p));
+  ASSERT_EQ(c_crs.ptr, expected.ptr);
+  ASSERT_EQ(c_crs.index, expected.index);
+  ASSERT_EQ(c_crs.values, expected.values);
+}
@@ -1,12 +1,17 @@
 #pragma once
 
+#include <cstddef>
 #include <utility>
 #include <vector>
 
+#include "core/sparse/include/compressed.hpp"
 #include "core/task/include/task.hpp"
 
 namespace korotin_e_crs_multiplication_omp {
 
+// C = A * B for CRS matrices. Inputs are either A and B in the standard sparse layout (see
+// core/sparse/include/task_data.hpp) with a CrsMatrix<double> output, or the row offsets, column indices and values
+// of A and then of B as unsigned/unsigned/double arrays with the same three arrays of C as outputs.
 class CrsMultiplicationOMP : public ppc::core::Task {
  public:
   explicit CrsMultiplicationOMP(ppc::core::TaskDataPtr task_data) : Task(std::move(task_data)) {}
@@ -16,9 +21,14 @@ class CrsMultiplicationOMP : public ppc::core::Task {
   bool PostProcessingImpl() override;
 
  private:
-  std::vector<double> A_val_, B_val_, output_val_;
-  std::vector<unsigned int> A_col_, A_rI_, B_col_, B_rI_, output_col_, output_rI_;
-  unsigned int A_N_, A_Nz_, B_N_, B_Nz_;
+  [[nodiscard]] bool IsSparseLayout() const;
+  // Copies the unsigned arrays of the operand starting at input first into int offsets and indices
+  [[nodiscard]] ppc::sparse::CrsMatrix<double> CopyArrays(size_t first) const;
+
+  // Operands given as unsigned arrays; operands in the sparse layout are read in place
+  ppc::sparse::CrsMatrix<double> A_copy_, B_copy_;
+  ppc::sparse::CompressedView<double> A_, B_;
+  ppc::sparse::CrsMatrix<double> output_;
 };
 
 std::vector<double> GetRandomMatrix(unsigned int m, unsigned int n);
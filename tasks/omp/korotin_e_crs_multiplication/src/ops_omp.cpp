@@ -3,40 +3,57 @@
 #include <omp.h>
 
 #include <algorithm>
-#include <cmath>
 #include <cstddef>
-#include <vector>
+#include <utility>
 
-bool korotin_e_crs_multiplication_omp::CrsMultiplicationOMP::PreProcessingImpl() {
-  A_N_ = task_data->inputs_count[0];
-  auto *in_ptr = reinterpret_cast<unsigned int *>(task_data->inputs[0]);
-  A_rI_ = std::vector<unsigned int>(in_ptr, in_ptr + A_N_);
-
-  A_Nz_ = task_data->inputs_count[1];
-  in_ptr = reinterpret_cast<unsigned int *>(task_data->inputs[1]);
-  A_col_ = std::vector<unsigned int>(in_ptr, in_ptr + A_Nz_);
-
-  auto *val_ptr = reinterpret_cast<double *>(task_data->inputs[2]);
-  A_val_ = std::vector<double>(val_ptr, val_ptr + A_Nz_);
+#include "core/sparse/include/compressed.hpp"
+#include "core/sparse/include/spgemm.hpp"
+#include "core/sparse/include/task_data.hpp"
+#include "core/util/include/fork_join.hpp"
 
-  B_N_ = task_data->inputs_count[3];
-  in_ptr = reinterpret_cast<unsigned int *>(task_data->inputs[3]);
-  B_rI_ = std::vector<unsigned int>(in_ptr, in_ptr + B_N_);
-
-  B_Nz_ = task_data->inputs_count[4];
-  in_ptr = reinterpret_cast<unsigned int *>(task_data->inputs[4]);
-  B_col_ = std::vector<unsigned int>(in_ptr, in_ptr + B_Nz_);
-
-  val_ptr = reinterpret_cast<double *>(task_data->inputs[5]);
-  B_val_ = std::vector<double>(val_ptr, val_ptr + B_Nz_);
+bool korotin_e_crs_multiplication_omp::CrsMultiplicationOMP::IsSparseLayout() const {
+  return task_data->inputs.size() == 2 * ppc::sparse::kSparseInputs;
+}
 
-  unsigned int output_size = task_data->outputs_count[0];
-  output_rI_ = std::vector<unsigned int>(output_size);
+ppc::sparse::CrsMatrix<double> korotin_e_crs_multiplication_omp::CrsMultiplicationOMP::CopyArrays(
+    size_t first) const {
+  const auto *r_i = reinterpret_cast<unsigned int *>(task_data->inputs[first]);
+  const auto *col = reinterpret_cast<unsigned int *>(task_data->inputs[first + 1]);
+  const auto *val = reinterpret_cast<double *>(task_data->inputs[first + 2]);
+  const unsigned int n = task_data->inputs_count[first];
+  const unsigned int nz = task_data->inputs_count[first + 1];
+  ppc::sparse::CrsMatrix<double> matrix;
+  matrix.shape.rows = static_cast<int>(n) - 1;
+  matrix.shape.cols = nz == 0 ? 0 : static_cast<int>(*std::max_element(col, col + nz)) + 1;
+  matrix.ptr.assign(r_i, r_i + n);
+  matrix.index.assign(col, col + nz);
+  matrix.values.assign(val, val + nz);
+  return matrix;
+}
 
+bool korotin_e_crs_multiplication_omp::CrsMultiplicationOMP::PreProcessingImpl() {
+  if (IsSparseLayout()) {
+    A_ = ppc::sparse::SparseInput<double>(*task_data, 0);
+    B_ = ppc::sparse::SparseInput<double>(*task_data, ppc::sparse::kSparseInputs);
+    return true;
+  }
+  A_copy_ = CopyArrays(0);
+  B_copy_ = CopyArrays(3);
+  // A has as many columns as B has rows, whether or not its last columns hold anything
+  A_copy_.shape.cols = B_copy_.shape.rows;
+  A_ = A_copy_.View();
+  B_ = B_copy_.View();
   return true;
 }
 
 bool korotin_e_crs_multiplication_omp::CrsMultiplicationOMP::ValidationImpl() {
+  if (IsSparseLayout()) {
+    return ppc::sparse::IsSparseInput(*task_data, 0, ppc::sparse::Layout::kCrs) &&
+           ppc::sparse::IsSparseInput(*task_data, ppc::sparse::kSparseInputs, ppc::sparse::Layout::kCrs) &&
+           ppc::sparse::SparseInputShape(*task_data, 0).cols ==
+               ppc::sparse::SparseInputShape(*task_data, ppc::sparse::kSparseInputs).rows &&
+           ppc::sparse::IsSparseOutput(*task_data, 0);
+  }
   return task_data->inputs_count[1] == task_data->inputs_count[2] &&
          task_data->inputs_count[4] == task_data->inputs_count[5] &&
          task_data->inputs_count[0] == task_data->outputs_count[0] &&
@@ -46,86 +63,22 @@ bool korotin_e_crs_multiplication_omp::CrsMultiplicationOMP::ValidationImpl() {
 }
 
 bool korotin_e_crs_multiplication_omp::CrsMultiplicationOMP::RunImpl() {
-  std::vector<unsigned int> tr_i(*std::ranges::max_element(B_col_.begin(), B_col_.end()) + 2, 0);
-  unsigned int i = 0;
-  unsigned int j = 0;
-  for (i = 0; i < B_Nz_; i++) {
-    tr_i[B_col_[i] + 1]++;
-  }
-  for (i = 1; i < tr_i.size(); i++) {
-    tr_i[i] += tr_i[i - 1];
-  }
-
-  std::vector<unsigned int> tcol(B_Nz_, 0);
-  std::vector<double> tval(B_Nz_, 0);
-  for (i = 0; i < B_N_ - 1; i++) {
-    for (j = B_rI_[i]; j < B_rI_[i + 1]; j++) {
-      tval[tr_i[B_col_[j]]] = B_val_[j];
-      tcol[tr_i[B_col_[j]]] = i;
-      tr_i[B_col_[j]]++;
-    }
-  }
-  for (i = tr_i.size() - 1; i > 0; i--) {
-    tr_i[i] = tr_i[i - 1];
-  }
-  tr_i[0] = 0;
-
-  unsigned int ai = 0;
-  unsigned int bt = 0;
-  double sum = 0;
-  std::ranges::fill(output_rI_.begin(), output_rI_.end(), 0);
-  output_col_.clear();
-  output_val_.clear();
-  std::vector<std::vector<double>> local_val(omp_get_max_threads());
-  std::vector<std::vector<unsigned int>> local_col(omp_get_max_threads());
-  std::vector<int> temp_r_i(A_N_, 0);
-
-#pragma omp parallel for private(j, sum, ai, bt)
-  for (int k = 0; k < static_cast<int>(A_N_ - 1); k++) {
-    int thread_id = omp_get_thread_num();
-    for (j = 0; j < tr_i.size() - 1; j++) {
-      sum = 0;
-      ai = A_rI_[k];
-      bt = tr_i[j];
-      while (ai < A_rI_[k + 1] && bt < tr_i[j + 1]) {
-        if (A_col_[ai] == tcol[bt]) {
-          sum += A_val_[ai] * tval[bt];
-          ai++;
-          bt++;
-        } else if (A_col_[ai] < tcol[bt]) {
-          ai++;
-        } else {
-          bt++;
-        }
-      }
-      if (sum != 0) {
-        local_val[thread_id].push_back(sum);
-        local_col[thread_id].push_back(j);
-        temp_r_i[k + 1]++;
-      }
-    }
-  }
-
-  for (int t = 0; t < omp_get_max_threads(); t++) {
-    output_val_.insert(output_val_.end(), local_val[t].begin(), local_val[t].end());
-    output_col_.insert(output_col_.end(), local_col[t].begin(), local_col[t].end());
-  }
-
-  for (i = 1; i < A_N_; i++) {
-    output_rI_[i] += output_rI_[i - 1] + temp_r_i[i];
-  }
+  auto c = ppc::sparse::MultiplyCrs(A_, B_, omp_get_max_threads(),
+                                    [](size_t count, const auto &func) { ppc::util::OmpForkJoin(count, func); });
+  ppc::sparse::DropEntries(c, [](double value) { return value == 0.0; });
+  output_ = ppc::sparse::CrsMatrix<double>::FromCompressed(std::move(c));
   return true;
 }
 
 bool korotin_e_crs_multiplication_omp::CrsMultiplicationOMP::PostProcessingImpl() {
-  for (size_t i = 0; i < output_rI_.size(); i++) {
-    reinterpret_cast<unsigned int *>(task_data->outputs[0])[i] = output_rI_[i];
-  }
-  for (size_t i = 0; i < output_col_.size(); i++) {
-    reinterpret_cast<unsigned int *>(task_data->outputs[1])[i] = output_col_[i];
-    reinterpret_cast<double *>(task_data->outputs[2])[i] = output_val_[i];
+  if (IsSparseLayout()) {
+    ppc::sparse::SparseOutput<double, ppc::sparse::Layout::kCrs>(*task_data, 0) = std::move(output_);
+    return true;
   }
-  task_data->outputs_count.emplace_back(output_col_.size());
-  task_data->outputs_count.emplace_back(output_val_.size());
+  std::ranges::copy(output_.ptr, reinterpret_cast<unsigned int *>(task_data->outputs[0]));
+  std::ranges::copy(output_.index, reinterpret_cast<unsigned int *>(task_data->outputs[1]));
+  std::ranges::copy(output_.values, reinterpret_cast<double *>(task_data->outputs[2]));
+  task_data->outputs_count.emplace_back(output_.index.size());
+  task_data->outputs_count.emplace_back(output_.values.size());
   return true;
 }
@@ -216,3 +216,73 @@ TEST(moiseev_a_mult_mat_omp, test_negative_values) {
 
   EXPECT_EQ(c, expected_c);
 }
+
+TEST(moiseev_a_mult_mat_omp, test_float32_matches_double) {
+  constexpr size_t kSize = 70;
+  auto a = GenerateRandomMatrix(kSize, kSize);
+  auto b = GenerateRandomMatrix(kSize, kSize);
+  std::vector<float> a_float(a.begin(), a.end());
+  std::vector<float> b_float(b.begin(), b.end());
+  std::vector<float> c(kSize * kSize, 0.0F);
+
+  auto task_data_omp = std::make_shared<ppc::core::TaskData>();
+  task_data_omp->inputs.emplace_back(reinterpret_cast<uint8_t *>(a_float.data()));
+  task_data_omp->inputs_count.emplace_back(a_float.size());
+  task_data_omp->inputs.emplace_back(reinterpret_cast<uint8_t *>(b_float.data()));
+  task_data_omp->inputs_count.emplace_back(b_float.size());
+  task_data_omp->outputs.emplace_back(reinterpret_cast<uint8_t *>(c.data()));
+  task_data_omp->outputs_count.emplace_back(c.size());
+  task_data_omp->data_type = ppc::core::DataType::kFloat32;
+
+  moiseev_a_mult_mat_omp::MultMatOMP test_task_omp(task_data_omp);
+  ASSERT_TRUE(test_task_omp.Validation());
+  test_task_omp.PreProcessing();
+  test_task_omp.Run();
+  test_task_omp.PostProcessing();
+
+  for (size_t i = 0; i < kSize; ++i) {
+    for (size_t j = 0; j < kSize; ++j) {
+      double expected = 0.0;
+      for (size_t k = 0; k < kSize; ++k) {
+        expected += static_cast<double>(a_float[(i * kSize) + k]) * static_cast<double>(b_float[(k * kSize) + j]);
+      }
+      // Values up to 100 * 100 * 70 in float keep about seven significant digits
+      EXPECT_NEAR(c[(i * kSize) + j], expected, 1.0);
+    }
+  }
+}
+
+TEST(moiseev_a_mult_mat_omp, test_float32_inputs_sum_into_float64_output) {
+  constexpr size_t kSize = 70;
+  auto a = GenerateRandomMatrix(kSize, kSize);
+  auto b = GenerateRandomMatrix(kSize, kSize);
+  std::vector<float> a_float(a.begin(), a.end());
+  std::vector<float> b_float(b.begin(), b.end());
+  std::vector<double> c(kSize * kSize, 0.0);
+
+  auto task_data_omp = std::make_shared<ppc::core::TaskData>();
+  task_data_omp->inputs.emplace_back(reinterpret_cast<uint8_t *>(a_float.data()));
+  task_data_omp->inputs_count.emplace_back(a_float.size());
+  task_data_omp->inputs.emplace_back(reinterpret_cast<uint8_t *>(b_float.data()));
+  task_data_omp->inputs_count.emplace_back(b_float.size());
+  task_data_omp->outputs.emplace_back(reinterpret_cast<uint8_t *>(c.data()));
+  task_data_omp->outputs_count.emplace_back(c.size());
+  task_data_omp->data_type = ppc::core::DataType::kFloat32Float64;
+
+  moiseev_a_mult_mat_omp::MultMatOMP test_task_omp(task_data_omp);
+  ASSERT_TRUE(test_task_omp.Validation());
+  test_task_omp.PreProcessing();
+  test_task_omp.Run();
+  test_task_omp.PostProcessing();
+
+  for (size_t i = 0; i < kSize; ++i) {
+    for (size_t j = 0; j < kSize; ++j) {
+      double expected = 0.0;
+      for (size_t k = 0; k < kSize; ++k) {
+        expected += static_cast<double>(a_float[(i * kSize) + k]) * static_cast<double>(b_float[(k * kSize) + j]);
+      }
+      // Only the rounding of each product to float is left: at most 70 * 100 * 100 * 2^-24
+      EXPECT_NEAR(c[(i * kSize) + j], expected, 0.05);
+    }
+  }
+}
@@ -1,12 +1,20 @@
 #pragma once
 
 #include <utility>
+#include <variant>
 #include <vector>
 
 #include "core/task/include/task.hpp"
 
 namespace moiseev_a_mult_mat_omp {
 
+// Operands in T and result in Acc, the element types TaskData::data_type selects
+template <typename T, typename Acc = T>
+struct Matrices {
+  std::vector<T> a, b;
+  std::vector<Acc> c;
+};
+
 class MultMatOMP : public ppc::core::Task {
  public:
   explicit MultMatOMP(ppc::core::TaskDataPtr task_data) : Task(std::move(task_data)) {}
@@ -16,7 +24,7 @@ class MultMatOMP : public ppc::core::Task {
   bool PostProcessingImpl() override;
 
  private:
-  std::vector<double> matrix_a_, matrix_b_, matrix_c_;
+  std::variant<Matrices<double>, Matrices<float>, Matrices<float, double>> matrices_;
   int matrix_size_{};
   int num_blocks_{};
   int block_size_{};
@@ -2,29 +2,77 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstddef>
+#include <type_traits>
+#include <variant>
 #include <vector>
 
-bool moiseev_a_mult_mat_omp::MultMatOMP::PreProcessingImpl() {
-  unsigned int input_size_a = task_data->inputs_count[0];
-  unsigned int input_size_b = task_data->inputs_count[1];
+#include "core/matmul/include/autotune.hpp"
+#include "core/matmul/include/gemm.hpp"
+#include "core/task/include/task.hpp"
+#include "core/util/include/util.hpp"
 
-  auto* in_ptr_a = reinterpret_cast<double*>(task_data->inputs[0]);
-  auto* in_ptr_b = reinterpret_cast<double*>(task_data->inputs[1]);
+namespace {
 
-  matrix_a_ = std::vector<double>(in_ptr_a, in_ptr_a + input_size_a);
-  matrix_b_ = std::vector<double>(in_ptr_b, in_ptr_b + input_size_b);
+template <typename T, typename Acc = T>
+moiseev_a_mult_mat_omp::Matrices<T, Acc> ReadMatrices(const ppc::core::TaskData& task_data) {
+  auto* in_ptr_a = reinterpret_cast<T*>(task_data.inputs[0]);
+  auto* in_ptr_b = reinterpret_cast<T*>(task_data.inputs[1]);
+  return {.a = std::vector<T>(in_ptr_a, in_ptr_a + task_data.inputs_count[0]),
+          .b = std::vector<T>(in_ptr_b, in_ptr_b + task_data.inputs_count[1]),
+          .c = std::vector<Acc>(task_data.outputs_count[0], Acc{})};
+}
 
-  unsigned int output_size = task_data->outputs_count[0];
-  matrix_c_ = std::vector<double>(output_size, 0.0);
+// Block (i_block, j_block) of C accumulates A(i_block, s') * B(s', j_block) with s' starting on the diagonal, as in
+// Cannon's algorithm; the last block row and column may be narrower
+template <typename T, typename Acc>
+void MultiplyBlocks(moiseev_a_mult_mat_omp::Matrices<T, Acc>& matrices, int matrix_size, int num_blocks,
+                    int block_size) {
+  const auto n = static_cast<size_t>(matrix_size);
+#pragma omp parallel for
+  for (int i_block = 0; i_block < num_blocks; ++i_block) {
+    for (int j_block = 0; j_block < num_blocks; ++j_block) {
+      for (int s = 0; s < num_blocks; ++s) {
+        int k_block = (i_block + s) % num_blocks;
 
-  matrix_size_ = static_cast<int>(std::sqrt(input_size_a));
+        int i_start = i_block * block_size;
+        int j_start = j_block * block_size;
+        int k_start = k_block * block_size;
+        int i_end = std::min(i_start + block_size, matrix_size);
+        int j_end = std::min(j_start + block_size, matrix_size);
+        int k_end = std::min(k_start + block_size, matrix_size);
 
-  block_size_ = static_cast<int>(std::sqrt(matrix_size_));
-  if (matrix_size_ % block_size_ != 0) {
-    block_size_ = 1;
+        ppc::matmul::Gemm(i_end - i_start, j_end - j_start, k_end - k_start, &matrices.a[(i_start * n) + k_start], n,
+                          &matrices.b[(k_start * n) + j_start], n, &matrices.c[(i_start * n) + j_start], n, true);
+      }
+    }
   }
+}
+
+}  // namespace
 
-  num_blocks_ = matrix_size_ / block_size_;
+bool moiseev_a_mult_mat_omp::MultMatOMP::PreProcessingImpl() {
+  // float operands run through SIMD kernels with twice the lanes of double; with a double result the products are
+  // summed in double, so the rounding error no longer grows with the matrix size
+  switch (task_data->data_type) {
+    case ppc::core::DataType::kFloat32:
+      matrices_ = ReadMatrices<float>(*task_data);
+      break;
+    case ppc::core::DataType::kFloat32Float64:
+      matrices_ = ReadMatrices<float, double>(*task_data);
+      break;
+    case ppc::core::DataType::kFloat64:
+      matrices_ = ReadMatrices<double>(*task_data);
+      break;
+  }
+
+  matrix_size_ = static_cast<int>(std::sqrt(task_data->inputs_count[0]));
+
+  // Blocks take the tile edge tuned for Gemm() on this CPU, but are small enough that every thread gets a block row;
+  // the last block row and column may be narrower
+  block_size_ = static_cast<int>(ppc::matmul::ParallelBlock(ppc::matmul::TunedBlockSizes().gemm, matrix_size_,
+                                                            ppc::util::GetPPCNumThreads()));
+  num_blocks_ = (matrix_size_ + block_size_ - 1) / block_size_;
 
   return true;
 }
@@ -35,37 +83,16 @@ bool moiseev_a_mult_mat_omp::MultMatOMP::ValidationImpl() {
 }
 
 bool moiseev_a_mult_mat_omp::MultMatOMP::RunImpl() {
-#pragma omp parallel for
-  for (int i_block = 0; i_block < num_blocks_; ++i_block) {
-    for (int j_block = 0; j_block < num_blocks_; ++j_block) {
-      for (int s = 0; s < num_blocks_; ++s) {
-        int a_block_j = (i_block + s) % num_blocks_;
-        int b_block_i = a_block_j;
-
-        int i_start = i_block * block_size_;
-        int j_start = j_block * block_size_;
-        int a_j_start = a_block_j * block_size_;
-        int b_i_start = b_block_i * block_size_;
-
-        for (int i = 0; i < block_size_; ++i) {
-          for (int j = 0; j < block_size_; ++j) {
-            double sum = 0.0;
-            for (int k = 0; k < block_size_; ++k) {
-              double a_val = matrix_a_[((i_start + i) * matrix_size_) + (a_j_start + k)];
-              double b_val = matrix_b_[((b_i_start + k) * matrix_size_) + (j_start + j)];
-              sum += a_val * b_val;
-            }
-            matrix_c_[((i_start + i) * matrix_size_) + (j_start + j)] += sum;
-          }
-        }
-      }
-    }
-  }
+  std::visit([&](auto& matrices) { MultiplyBlocks(matrices, matrix_size_, num_blocks_, block_size_); }, matrices_);
   return true;
 }
 
 bool moiseev_a_mult_mat_omp::MultMatOMP::PostProcessingImpl() {
-  auto* out_ptr = reinterpret_cast<double*>(task_data->outputs[0]);
-  std::ranges::copy(matrix_c_, out_ptr);
+  std::visit(
+      [&](const auto& matrices) {
+        using T = typename std::decay_t<decltype(matrices.c)>::value_type;
+        std::ranges::copy(matrices.c, reinterpret_cast<T*>(task_data->outputs[0]));
+      },
+      matrices_);
   return true;
 }
@@ -125,4 +125,31 @@ TEST(sadikov_i_sparse_matrix_multiplication_task_omp, test_random_matrix) {
   for (auto i = 0; i < static_cast<int>(out.size()); ++i) {
     EXPECT_NEAR(out[i], check_out[i], kEpsilon);
   }
-}
\ No newline at end of file
+}
+
+TEST(sadikov_i_sparse_matrix_multiplication_task_omp, test_multiply_vector_and_dense_matrix) {
+  constexpr auto kEpsilon = 0.000001;
+  constexpr auto kRowsCount = 40;
+  constexpr auto kColumnsCount = 30;
+  constexpr auto kBlockColumnsCount = 4;
+  auto fmatrix = GetRandomMatrix(kRowsCount * kColumnsCount);
+  auto vector = GetRandomMatrix(kColumnsCount);
+  auto smatrix = GetRandomMatrix(kColumnsCount * kBlockColumnsCount);
+  auto sparse = sadikov_i_sparse_matrix_multiplication_task_omp::MatrixToSparse(kRowsCount, kColumnsCount, fmatrix);
+
+  auto out = sparse.MultiplyVector(vector);
+  auto test_out = sadikov_i_sparse_matrix_multiplication_task_omp::BaseMatrixMultiplication(
+      fmatrix, kRowsCount, kColumnsCount, vector, kColumnsCount, 1);
+  ASSERT_EQ(out.size(), test_out.size());
+  for (auto i = 0; i < static_cast<int>(out.size()); ++i) {
+    EXPECT_NEAR(out[i], test_out[i], kEpsilon);
+  }
+
+  out = sparse.MultiplyDense(smatrix, kBlockColumnsCount);
+  test_out = sadikov_i_sparse_matrix_multiplication_task_omp::BaseMatrixMultiplication(
+      fmatrix, kRowsCount, kColumnsCount, smatrix, kColumnsCount, kBlockColumnsCount);
+  ASSERT_EQ(out.size(), test_out.size());
+  for (auto i = 0; i < static_cast<int>(out.size()); ++i) {
+    EXPECT_NEAR(out[i], test_out[i], kEpsilon);
+  }
+}
@@ -32,6 +32,10 @@ class SparseMatrix {
   [[nodiscard]] int GetColumnsCount() const noexcept { return m_columnsCount_; }
   [[nodiscard]] int GetRowsCount() const noexcept { return m_rowsCount_; }
   SparseMatrix operator*(SparseMatrix& smatrix) const noexcept(false);
+  // this * x on all OpenMP threads
+  [[nodiscard]] std::vector<double> MultiplyVector(const std::vector<double>& x) const;
+  // this * matrix for a dense row-major matrix of GetColumnsCount() x columns_count; the result is row-major too
+  [[nodiscard]] std::vector<double> MultiplyDense(const std::vector<double>& matrix, int columns_count) const;
 };
 
 SparseMatrix MatrixToSparse(int rows_count, int columns_count, const std::vector<double>& values);
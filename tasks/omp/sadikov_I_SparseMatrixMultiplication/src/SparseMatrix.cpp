@@ -7,6 +7,10 @@
 #include <utility>
 #include <vector>
 
+#include "core/sparse/include/compressed.hpp"
+#include "core/sparse/include/spmv.hpp"
+#include "core/util/include/fork_join.hpp"
+
 namespace sadikov_i_sparse_matrix_multiplication_task_omp {
 SparseMatrix SparseMatrix::Transpose(const SparseMatrix& matrix) {
   std::vector<double> val;
@@ -89,6 +93,19 @@ SparseMatrix SparseMatrix::operator*(SparseMatrix& smatrix) const {
   return SparseMatrix(smatrix.GetColumnsCount(), smatrix.GetColumnsCount(), values, rows, elements_sum);
 }
 
+std::vector<double> SparseMatrix::MultiplyVector(const std::vector<double>& x) const { return MultiplyDense(x, 1); }
+
+std::vector<double> SparseMatrix::MultiplyDense(const std::vector<double>& matrix, int columns_count) const {
+  std::vector<int> column_ptr(m_elementsSum_.size() + 1, 0);
+  std::ranges::copy(m_elementsSum_, column_ptr.begin() + 1);
+  const ppc::sparse::CompressedView<double> view{
+      .outer = m_columnsCount_, .inner = m_rowsCount_, .ptr = column_ptr, .index = m_rows_, .values = m_values_};
+  std::vector<double> answer(static_cast<size_t>(m_rowsCount_) * columns_count);
+  ppc::sparse::SpmmCcs<double>(view, matrix, columns_count, answer, omp_get_max_threads(),
+                               [](size_t count, const auto& func) { ppc::util::OmpForkJoin(count, func); });
+  return answer;
+}
+
 SparseMatrix MatrixToSparse(int rows_count, int columns_count, const std::vector<double>& values) {
   std::vector<double> val;
   std::vector<int> sums(columns_count, 0);
@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <complex>
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <random>
@@ -155,3 +156,29 @@ TEST(tyrin_m_matmul_crs_complex_omp, validation_failure) {
   tyurin_m_matmul_crs_complex_omp::TestTaskOpenMP task(data);
   EXPECT_FALSE(task.Validation());
 }
+
+TEST(tyurin_m_matmul_crs_complex_omp, test_multiply_vector_and_dense_block) {
+  Matrix lhs = RandMatrix(40, 30, 0.2);
+  // A full row makes the vector product take the merge path on several threads
+  for (uint32_t col = 0; col < lhs.cols; ++col) {
+    lhs.Get(7, col) = std::complex<double>(col, 1.0);
+  }
+  Matrix block = RandMatrix(30, 4, 1.0);
+  Matrix x = RandMatrix(30, 1, 1.0);
+  const MatrixCRS crs = RegularToCRS(lhs);
+
+  const auto expected_y = MultiplyMat(lhs, x);
+  const auto y = tyurin_m_matmul_crs_complex_omp::MultiplyVector(crs, x.data);
+  ASSERT_EQ(y.size(), expected_y.data.size());
+  for (size_t i = 0; i < y.size(); ++i) {
+    EXPECT_LE(std::abs(y[i] - expected_y.data[i]), 1e-9 * std::abs(expected_y.data[i]));
+  }
+
+  const auto expected_c = MultiplyMat(lhs, block);
+  const auto c = tyurin_m_matmul_crs_complex_omp::MultiplyDense(crs, block);
+  ASSERT_EQ(c.rows, expected_c.rows);
+  ASSERT_EQ(c.cols, expected_c.cols);
+  for (size_t i = 0; i < c.data.size(); ++i) {
+    EXPECT_LE(std::abs(c.data[i] - expected_c.data[i]), 1e-9 * std::abs(expected_c.data[i]));
+  }
+}
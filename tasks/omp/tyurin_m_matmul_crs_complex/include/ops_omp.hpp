@@ -5,6 +5,7 @@
 #include <utility>
 #include <vector>
 
+#include "core/sparse/include/compressed.hpp"
 #include "core/task/include/task.hpp"
 
 struct Matrix {
@@ -84,6 +85,13 @@ inline Matrix CRSToRegular(const MatrixCRS& crs) {
 
 namespace tyurin_m_matmul_crs_complex_omp {
 
+// matrix * x on all OpenMP threads; rows are split by entry count, or along the merge path when a few rows hold most
+// of the entries
+std::vector<std::complex<double>> MultiplyVector(const MatrixCRS& matrix, const std::vector<std::complex<double>>& x);
+
+// matrix * block for a dense block with few columns (SpMM)
+Matrix MultiplyDense(const MatrixCRS& matrix, const Matrix& block);
+
 class TestTaskOpenMP : public ppc::core::Task {
  public:
   explicit TestTaskOpenMP(ppc::core::TaskDataPtr task_data) : Task(std::move(task_data)) {}
@@ -93,8 +101,8 @@ class TestTaskOpenMP : public ppc::core::Task {
   bool PostProcessingImpl() override;
 
  private:
-  MatrixCRS lhs_;
-  MatrixCRS rhs_;
+  ppc::sparse::CompressedMatrix<std::complex<double>> lhs_;
+  ppc::sparse::CompressedMatrix<std::complex<double>> rhs_;
   MatrixCRS res_;
 };
 
@@ -1,40 +1,56 @@
 #include "omp/tyurin_m_matmul_crs_complex/include/ops_omp.hpp"
 
-#include <cmath>
+#include <omp.h>
+
 #include <complex>
+#include <cstddef>
 #include <cstdint>
-#include <cstdio>
-#include <tuple>
+#include <utility>
 #include <vector>
 
+#include "core/sparse/include/compressed.hpp"
+#include "core/sparse/include/spgemm.hpp"
+#include "core/sparse/include/spmv.hpp"
+#include "core/util/include/fork_join.hpp"
+
 namespace {
-MatrixCRS TransposeMatrixCRS(const MatrixCRS &crs) {
-  const auto new_cols = crs.GetRows();
+// The SpGEMM engine takes int offsets and indices
+ppc::sparse::CompressedMatrix<std::complex<double>> CopyWithIntIndices(const MatrixCRS &crs) {
+  ppc::sparse::CompressedMatrix<std::complex<double>> matrix;
+  matrix.outer = static_cast<int>(crs.GetRows());
+  matrix.inner = static_cast<int>(crs.GetCols());
+  matrix.ptr.assign(crs.rowptr.begin(), crs.rowptr.end());
+  matrix.index.assign(crs.colind.begin(), crs.colind.end());
+  matrix.values = crs.data;
+  return matrix;
+}
 
-  MatrixCRS res;
-  res.cols_count = new_cols;
-  res.rowptr.resize(crs.GetCols() + 2);
-  res.colind.resize(crs.colind.size(), 0);
-  res.data.resize(crs.data.size(), 0);
+ppc::sparse::CompressedView<std::complex<double>, uint32_t> View(const MatrixCRS &crs) {
+  return {.outer = static_cast<int>(crs.GetRows()),
+          .inner = static_cast<int>(crs.GetCols()),
+          .ptr = crs.rowptr,
+          .index = crs.colind,
+          .values = crs.data};
+}
+}  // namespace
 
-  for (uint32_t i = 0; i < crs.data.size(); ++i) {
-    ++res.rowptr[crs.colind[i] + 2];
-  }
-  for (uint32_t i = 2; i < res.rowptr.size(); ++i) {
-    res.rowptr[i] += res.rowptr[i - 1];
-  }
-  for (uint32_t i = 0; i < new_cols; ++i) {
-    for (uint32_t j = crs.rowptr[i]; j < crs.rowptr[i + 1]; ++j) {
-      const auto new_index = res.rowptr[crs.colind[j] + 1]++;
-      res.data[new_index] = crs.data[j];
-      res.colind[new_index] = i;
-    }
-  }
-  res.rowptr.pop_back();
+std::vector<std::complex<double>> tyurin_m_matmul_crs_complex_omp::MultiplyVector(
+    const MatrixCRS &matrix, const std::vector<std::complex<double>> &x) {
+  std::vector<std::complex<double>> y(matrix.GetRows());
+  auto fork_join = [](size_t count, const auto &func) { ppc::util::OmpForkJoin(count, func); };
+  ppc::sparse::SpmvCrs<std::complex<double>>(View(matrix), x, y, omp_get_max_threads(), fork_join);
+  return y;
+}
 
+Matrix tyurin_m_matmul_crs_complex_omp::MultiplyDense(const MatrixCRS &matrix, const Matrix &block) {
+  Matrix res{.rows = matrix.GetRows(),
+             .cols = block.cols,
+             .data = std::vector<std::complex<double>>(matrix.GetRows() * block.cols)};
+  auto fork_join = [](size_t count, const auto &func) { ppc::util::OmpForkJoin(count, func); };
+  ppc::sparse::SpmmCrs<std::complex<double>>(View(matrix), block.data, block.cols, res.data, omp_get_max_threads(),
+                                             fork_join);
   return res;
 }
-}  // namespace
 
 bool tyurin_m_matmul_crs_complex_omp::TestTaskOpenMP::ValidationImpl() {
   const bool left_cols_equal_right_rows = task_data->inputs_count[1] == task_data->inputs_count[2];
@@ -44,50 +60,21 @@ bool tyurin_m_matmul_crs_complex_omp::TestTaskOpenMP::ValidationImpl() {
 }
 
 bool tyurin_m_matmul_crs_complex_omp::TestTaskOpenMP::PreProcessingImpl() {
-  lhs_ = *reinterpret_cast<MatrixCRS *>(task_data->inputs[0]);
-  rhs_ = TransposeMatrixCRS(*reinterpret_cast<MatrixCRS *>(task_data->inputs[1]));
+  lhs_ = CopyWithIntIndices(*reinterpret_cast<MatrixCRS *>(task_data->inputs[0]));
+  rhs_ = CopyWithIntIndices(*reinterpret_cast<MatrixCRS *>(task_data->inputs[1]));
   res_ = {};
-  res_.rowptr.resize(lhs_.GetRows() + 1);
-  res_.cols_count = rhs_.GetRows();
   return true;
 }
 
 bool tyurin_m_matmul_crs_complex_omp::TestTaskOpenMP::RunImpl() {
-  const auto rows = lhs_.GetRows();
-  const auto cols = rhs_.GetRows();
-
-  std::vector<std::vector<std::tuple<std::complex<double>, uint32_t>>> buf(rows);
-
-#pragma omp parallel for
-  for (int i = 0; i < static_cast<int>(rows); ++i) {
-    for (uint32_t j = 0; j < cols; ++j) {
-      auto ii = lhs_.rowptr[i];
-      auto ij = rhs_.rowptr[j];
-      std::complex<double> summul = 0.0;
-      while (ii < lhs_.rowptr[i + 1] && ij < rhs_.rowptr[j + 1]) {
-        if (lhs_.colind[ii] < rhs_.colind[ij]) {
-          ++ii;
-        } else if (lhs_.colind[ii] > rhs_.colind[ij]) {
-          ++ij;
-        } else {
-          summul += lhs_.data[ii++] * rhs_.data[ij++];
-        }
-      }
-      if (summul != 0.0) {
-        buf[i].emplace_back(summul, j);
-      }
-    }
-  }
-
-  for (uint32_t i = 0; i < rows; i++) {
-    res_.rowptr[i + 1] = res_.rowptr[i];
-    for (const auto &[summul, j] : buf[i]) {
-      res_.data.push_back(summul);
-      res_.colind.push_back(j);
-      ++res_.rowptr[i + 1];
-    }
-  }
+  auto product = ppc::sparse::MultiplyCrs(lhs_.View(), rhs_.View(), omp_get_max_threads(),
+                                          [](size_t count, const auto &func) { ppc::util::OmpForkJoin(count, func); });
+  ppc::sparse::DropEntries(product, [](const std::complex<double> &value) { return value == 0.0; });
 
+  res_.cols_count = product.inner;
+  res_.rowptr.assign(product.ptr.begin(), product.ptr.end());
+  res_.colind.assign(product.index.begin(), product.index.end());
+  res_.data = std::move(product.values);
   return true;
 }
 
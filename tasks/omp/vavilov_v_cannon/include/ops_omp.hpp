@@ -1,10 +1,9 @@
 #pragma once
 
-#include <cmath>
 #include <memory>
 #include <utility>
-#include <vector>
 
+#include "core/matmul/include/tiled.hpp"
 #include "core/task/include/task.hpp"
 
 namespace vavilov_v_cannon_omp {
@@ -21,12 +20,11 @@ class CannonOMP : public ppc::core::Task {
   int N_;
   int block_size_;
   int num_blocks_;
-  std::vector<double> A_;
-  std::vector<double> B_;
-  std::vector<double> C_;
+  // Tile-major copies: Cannon's skew and shifts only change which tiles meet, so no data is moved
+  ppc::matmul::TiledMatrix A_;
+  ppc::matmul::TiledMatrix B_;
+  ppc::matmul::TiledMatrix C_;
 
-  void InitialShift();
-  void BlockMultiply();
-  void ShiftBlocks();
+  void BlockMultiply(int step);
 };
 }  // namespace vavilov_v_cannon_omp
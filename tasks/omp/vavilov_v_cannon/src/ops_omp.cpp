@@ -2,18 +2,26 @@
 
 #include <algorithm>
 #include <cmath>
-#include <vector>
+#include <cstddef>
+
+#include "core/matmul/include/autotune.hpp"
+#include "core/matmul/include/gemm.hpp"
+#include "core/matmul/include/tiled.hpp"
+#include "core/util/include/util.hpp"
 
 bool vavilov_v_cannon_omp::CannonOMP::PreProcessingImpl() {
   N_ = static_cast<int>(std::sqrt(task_data->inputs_count[0]));
-  num_blocks_ = static_cast<int>(task_data->inputs_count[2]);
-  block_size_ = N_ / num_blocks_;
+  // The caller's block count is only validated: tiles take the edge tuned for Gemm() on this CPU, but are small enough
+  // that every thread gets a tile row; edge tiles are padded
+  block_size_ = static_cast<int>(
+      ppc::matmul::ParallelBlock(ppc::matmul::TunedBlockSizes().gemm, N_, ppc::util::GetPPCNumThreads()));
+  num_blocks_ = (N_ + block_size_ - 1) / block_size_;
 
   auto* a = reinterpret_cast<double*>(task_data->inputs[0]);
   auto* b = reinterpret_cast<double*>(task_data->inputs[1]);
-  A_.assign(a, a + (N_ * N_));
-  B_.assign(b, b + (N_ * N_));
-  C_.assign(N_ * N_, 0);
+  A_ = ppc::matmul::TiledMatrix::FromRowMajor(a, N_, block_size_);
+  B_ = ppc::matmul::TiledMatrix::FromRowMajor(b, N_, block_size_);
+  C_ = ppc::matmul::TiledMatrix(N_, block_size_);
 
   return true;
 }
@@ -29,78 +37,27 @@ bool vavilov_v_cannon_omp::CannonOMP::ValidationImpl() {
   return n % num_blocks == 0;
 }
 
-void vavilov_v_cannon_omp::CannonOMP::InitialShift() {
-  std::vector<double> a_tmp = A_;
-  std::vector<double> b_tmp = B_;
-
-#pragma omp parallel for
-  for (int bi = 0; bi < num_blocks_; ++bi) {
-    for (int bj = 0; bj < num_blocks_; ++bj) {
-      int src_row = (bi + bj) % num_blocks_;
-      int src_col = (bj + bi) % num_blocks_;
-      for (int i = 0; i < block_size_; ++i) {
-        for (int j = 0; j < block_size_; ++j) {
-          B_[(((bi * block_size_) + i) * N_) + ((bj * block_size_) + j)] =
-              b_tmp[(((src_row * block_size_) + i) * N_) + ((bj * block_size_) + j)];
-          A_[(((bi * block_size_) + i) * N_) + ((bj * block_size_) + j)] =
-              a_tmp[(((bi * block_size_) + i) * N_) + ((src_col * block_size_) + j)];
-        }
-      }
-    }
-  }
-}
-void vavilov_v_cannon_omp::CannonOMP::BlockMultiply() {
-#pragma omp parallel for
-  for (int bi = 0; bi < num_blocks_; ++bi) {
-    for (int bj = 0; bj < num_blocks_; ++bj) {
-      for (int i = 0; i < block_size_; ++i) {
-        for (int j = 0; j < block_size_; ++j) {
-          double temp = 0.0;
-          for (int k = 0; k < block_size_; ++k) {
-            int row = (bi * block_size_) + i;
-            int col = (bj * block_size_) + j;
-            int k_idx = (bj * block_size_) + k;
-            int k_row = (bi * block_size_) + k;
-            temp += A_[(row * N_) + k_idx] * B_[(k_row * N_) + col];
-          }
-          C_[(((bi * block_size_) + i) * N_) + ((bj * block_size_) + j)] += temp;
-        }
-      }
-    }
-  }
-}
-
-void vavilov_v_cannon_omp::CannonOMP::ShiftBlocks() {
-  std::vector<double> a_tmp = A_;
-  std::vector<double> b_tmp = B_;
-
+// After the initial skew and `step` shifts, the tiles meeting at (bi, bj) are A(bi, k) and B(k, bj) with
+// k = (bi + bj + step) mod num_blocks, so the shifts are an index rotation instead of copies of A and B
+void vavilov_v_cannon_omp::CannonOMP::BlockMultiply(int step) {
+  const auto tile = static_cast<size_t>(block_size_);
 #pragma omp parallel for
-  for (int bi = 0; bi < num_blocks_; ++bi) {
-    for (int bj = 0; bj < num_blocks_; ++bj) {
-      int src_row = (bi + 1) % num_blocks_;
-      int src_col = (bj + 1) % num_blocks_;
-      for (int i = 0; i < block_size_; ++i) {
-        for (int j = 0; j < block_size_; ++j) {
-          B_[(((bi * block_size_) + i) * N_) + ((bj * block_size_) + j)] =
-              b_tmp[(((src_row * block_size_) + i) * N_) + ((bj * block_size_) + j)];
-          A_[(((bi * block_size_) + i) * N_) + ((bj * block_size_) + j)] =
-              a_tmp[(((bi * block_size_) + i) * N_) + ((src_col * block_size_) + j)];
-        }
-      }
-    }
+  for (int idx = 0; idx < num_blocks_ * num_blocks_; ++idx) {
+    const int bi = idx / num_blocks_;
+    const int bj = idx % num_blocks_;
+    const int k = (bi + bj + step) % num_blocks_;
+    ppc::matmul::Gemm(tile, tile, tile, A_.Tile(bi, k), tile, B_.Tile(k, bj), tile, C_.Tile(bi, bj), tile, true);
   }
 }
 
 bool vavilov_v_cannon_omp::CannonOMP::RunImpl() {
-  InitialShift();
-  for (int iter = 0; iter < num_blocks_; ++iter) {
-    BlockMultiply();
-    ShiftBlocks();
+  for (int step = 0; step < num_blocks_; ++step) {
+    BlockMultiply(step);
   }
   return true;
 }
 
 bool vavilov_v_cannon_omp::CannonOMP::PostProcessingImpl() {
-  std::ranges::copy(C_, reinterpret_cast<double*>(task_data->outputs[0]));
+  C_.ToRowMajor(reinterpret_cast<double*>(task_data->outputs[0]));
   return true;
 }
@@ -7,6 +7,7 @@
 #include <utility>
 #include <vector>
 
+#include "core/sparse/include/compressed.hpp"
 #include "core/task/include/task.hpp"
 
 struct MatrixStructure {
@@ -119,8 +120,8 @@ class SparseMatrixMultiplier : public ppc::core::Task {
   bool PostProcessingImpl() override;
 
  private:
-  SparseMatrixFormat left_matrix_;
-  SparseMatrixFormat transposed_right_matrix_;
+  ppc::sparse::CompressedMatrix<std::complex<double>> left_matrix_;
+  ppc::sparse::CompressedMatrix<std::complex<double>> right_matrix_;
   SparseMatrixFormat result_matrix_;
 };
 
@@ -4,6 +4,8 @@
 #include <memory>
 #include <vector>
 
+#include "core/sparse/include/compressed.hpp"
+#include "core/sparse/include/task_data.hpp"
 #include "core/task/include/task.hpp"
 #include "seq/kolodkin_g_multiplication_matrix_CRS/include/ops_seq.hpp"
 
@@ -330,4 +332,45 @@ TEST(kolodkin_g_multiplication_seq, test_matmul_row_by_col) {
   kolodkin_g_multiplication_matrix_seq::SparseMatrixCRS res =
       kolodkin_g_multiplication_matrix_seq::ParseVectorIntoMatrix(out);
   ASSERT_TRUE(kolodkin_g_multiplication_matrix_seq::CheckMatrixesEquality(res, c));
-}
\ No newline at end of file
+}
+
+TEST(kolodkin_g_multiplication_seq, test_matmul_sparse_layout) {
+  ppc::sparse::CrsMatrix<Complex> a;
+  a.shape = {.rows = 3, .cols = 3, .layout = ppc::sparse::Layout::kCrs};
+  a.ptr = {0, 2, 3, 5};
+  a.index = {0, 2, 1, 0, 1};
+  a.values = {Complex(1, 1), Complex(2, 0), Complex(0, 3), Complex(4, -1), Complex(5, 0)};
+  ppc::sparse::CrsMatrix<Complex> b;
+  b.shape = {.rows = 3, .cols = 2, .layout = ppc::sparse::Layout::kCrs};
+  b.ptr = {0, 1, 2, 4};
+  b.index = {1, 0, 0, 1};
+  b.values = {Complex(6, 0), Complex(0, 7), Complex(8, 0), Complex(1, 1)};
+  ppc::sparse::CrsMatrix<Complex> c;
+
+  auto task_data_seq = std::make_shared<ppc::core::TaskData>();
+  ppc::sparse::AddSparseInput(*task_data_seq, a);
+  ppc::sparse::AddSparseInput(*task_data_seq, b);
+  ppc::sparse::AddSparseOutput(*task_data_seq, c);
+
+  kolodkin_g_multiplication_matrix_seq::TestTaskSequential test_task_sequential(task_data_seq);
+  ASSERT_EQ(test_task_sequential.Validation(), true);
+  test_task_sequential.PreProcessing();
+  test_task_sequential.Run();
+  test_task_sequential.PostProcessing();
+
+  std::vector<Complex> dense_a(9);
+  std::vector<Complex> dense_b(6);
+  std::vector<Complex> dense_c(6);
+  a.ToDense(dense_a.data());
+  b.ToDense(dense_b.data());
+  c.ToDense(dense_c.data());
+  for (int i = 0; i < 3; ++i) {
+    for (int j = 0; j < 2; ++j) {
+      Complex expected(0, 0);
+      for (int k = 0; k < 3; ++k) {
+        expected += dense_a[(i * 3) + k] * dense_b[(k * 2) + j];
+      }
+      EXPECT_TRUE(kolodkin_g_multiplication_matrix_seq::AreEqualElems(dense_c[(i * 2) + j], expected, 1e-9));
+    }
+  }
+}
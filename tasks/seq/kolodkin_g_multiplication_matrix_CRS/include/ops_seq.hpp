@@ -4,6 +4,7 @@
 #include <utility>
 #include <vector>
 
+#include "core/sparse/include/compressed.hpp"
 #include "core/task/include/task.hpp"
 
 using Complex = std::complex<double>;
@@ -28,6 +29,9 @@ std::vector<Complex> ParseMatrixIntoVec(const SparseMatrixCRS& mat);
 SparseMatrixCRS ParseVectorIntoMatrix(std::vector<Complex>& vec);
 bool CheckMatrixesEquality(const SparseMatrixCRS& a, const SparseMatrixCRS& b);
 bool AreEqualElems(const Complex& a, const Complex& b, double epsilon);
+// C = A * B for complex CRS matrices. Inputs are either A and B in the standard sparse layout (see
+// core/sparse/include/task_data.hpp) with a CrsMatrix<Complex> output, or one vector holding ParseMatrixIntoVec() of A
+// followed by that of B, with the same encoding of C as output.
 class TestTaskSequential : public ppc::core::Task {
  public:
   explicit TestTaskSequential(ppc::core::TaskDataPtr task_data) : Task(std::move(task_data)) {}
@@ -37,8 +41,13 @@ class TestTaskSequential : public ppc::core::Task {
   bool PostProcessingImpl() override;
 
  private:
+  [[nodiscard]] bool IsSparseLayout() const;
+
   std::vector<Complex> input_, output_;
+  // Operands decoded from the vector input; operands in the sparse layout are read in place
   SparseMatrixCRS A_, B_;
+  ppc::sparse::CompressedView<Complex> a_view_, b_view_;
+  ppc::sparse::CrsMatrix<Complex> c_;
 };
 
-}  // namespace kolodkin_g_multiplication_matrix_seq
\ No newline at end of file
+}  // namespace kolodkin_g_multiplication_matrix_seq
\ No newline at end of file
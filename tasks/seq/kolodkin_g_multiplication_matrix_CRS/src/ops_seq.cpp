@@ -4,8 +4,13 @@
 #include <complex>
 #include <cstddef>
 #include <iostream>
+#include <utility>
 #include <vector>
 
+#include "core/sparse/include/compressed.hpp"
+#include "core/sparse/include/spgemm.hpp"
+#include "core/sparse/include/task_data.hpp"
+
 void kolodkin_g_multiplication_matrix_seq::SparseMatrixCRS::AddValue(int row, Complex value, int col) {
   for (int j = rowPtr[row]; j < rowPtr[row + 1]; ++j) {
     if (colIndices[j] == col) {
@@ -103,7 +108,16 @@ kolodkin_g_multiplication_matrix_seq::SparseMatrixCRS kolodkin_g_multiplication_
   return res;
 }
 
+bool kolodkin_g_multiplication_matrix_seq::TestTaskSequential::IsSparseLayout() const {
+  return task_data->inputs.size() == 2 * ppc::sparse::kSparseInputs;
+}
+
 bool kolodkin_g_multiplication_matrix_seq::TestTaskSequential::PreProcessingImpl() {
+  if (IsSparseLayout()) {
+    a_view_ = ppc::sparse::SparseInput<Complex>(*task_data, 0);
+    b_view_ = ppc::sparse::SparseInput<Complex>(*task_data, ppc::sparse::kSparseInputs);
+    return true;
+  }
   // Init value for input and output
   unsigned int input_size = task_data->inputs_count[0];
   auto* in_ptr = reinterpret_cast<Complex*>(task_data->inputs[0]);
@@ -121,38 +135,41 @@ bool kolodkin_g_multiplication_matrix_seq::TestTaskSequential::PreProcessingImpl
   }
   A_ = ParseVectorIntoMatrix(matrix_a);
   B_ = ParseVectorIntoMatrix(matrix_b);
+  a_view_ = {.outer = A_.numRows, .inner = A_.numCols, .ptr = A_.rowPtr, .index = A_.colIndices, .values = A_.values};
+  b_view_ = {.outer = B_.numRows, .inner = B_.numCols, .ptr = B_.rowPtr, .index = B_.colIndices, .values = B_.values};
   return true;
 }
 
 bool kolodkin_g_multiplication_matrix_seq::TestTaskSequential::ValidationImpl() {
+  if (IsSparseLayout()) {
+    return ppc::sparse::IsSparseInput(*task_data, 0, ppc::sparse::Layout::kCrs) &&
+           ppc::sparse::IsSparseInput(*task_data, ppc::sparse::kSparseInputs, ppc::sparse::Layout::kCrs) &&
+           ppc::sparse::SparseInputShape(*task_data, 0).cols ==
+               ppc::sparse::SparseInputShape(*task_data, ppc::sparse::kSparseInputs).rows &&
+           ppc::sparse::IsSparseOutput(*task_data, 0);
+  }
   // Check equality of counts elements
-  unsigned int input_size = task_data->inputs_count[0];
-  auto* in_ptr = reinterpret_cast<Complex*>(task_data->inputs[0]);
-  std::vector<Complex> vec = std::vector<Complex>(in_ptr, in_ptr + input_size);
+  const auto* vec = reinterpret_cast<Complex*>(task_data->inputs[0]);
   return !(vec[1] != vec[5 + (int)(vec[2].real() + vec[3].real() + vec[4].real())].real());
 }
 
 bool kolodkin_g_multiplication_matrix_seq::TestTaskSequential::RunImpl() {
-  SparseMatrixCRS c(A_.numRows, B_.numCols);
-  for (unsigned int i = 0; i < (unsigned int)A_.numRows; ++i) {
-    for (unsigned int j = A_.rowPtr[i]; j < (unsigned int)A_.rowPtr[i + 1]; ++j) {
-      unsigned int col_a = A_.colIndices[j];
-      Complex value_a = A_.values[j];
-      for (unsigned int k = B_.rowPtr[col_a]; k < (unsigned int)B_.rowPtr[col_a + 1]; ++k) {
-        unsigned int col_b = B_.colIndices[k];
-        Complex value_b = B_.values[k];
-
-        c.AddValue((int)i, value_a * value_b, (int)col_b);
-      }
-    }
-  }
-  output_ = ParseMatrixIntoVec(c);
+  c_ = ppc::sparse::CrsMatrix<Complex>::FromCompressed(ppc::sparse::MultiplyCrs(a_view_, b_view_));
   return true;
 }
 
 bool kolodkin_g_multiplication_matrix_seq::TestTaskSequential::PostProcessingImpl() {
+  if (IsSparseLayout()) {
+    ppc::sparse::SparseOutput<Complex, ppc::sparse::Layout::kCrs>(*task_data, 0) = std::move(c_);
+    return true;
+  }
+  SparseMatrixCRS c(c_.shape.rows, c_.shape.cols);
+  c.values = std::move(c_.values);
+  c.colIndices = std::move(c_.index);
+  c.rowPtr = std::move(c_.ptr);
+  output_ = ParseMatrixIntoVec(c);
   for (size_t i = 0; i < output_.size(); i++) {
     reinterpret_cast<Complex*>(task_data->outputs[0])[i] = output_[i];
   }
   return true;
-}
\ No newline at end of file
+}
@@ -10,6 +10,7 @@
 #include <vector>
 
 #include "core/perf/include/perf.hpp"
+#include "core/perf/include/sort_bench.hpp"
 #include "core/task/include/task.hpp"
 #include "stl/Konstantinov_I_Sort_Batcher/include/ops_stl.hpp"
 
@@ -100,4 +101,13 @@ TEST(Konstantinov_I_Sort_Batcher_stl, test_task_run) {
 
   ASSERT_TRUE(std::equal(exp_out.begin(), exp_out.end(), out.begin(),
                          [](double a, double b) { return std::abs(a - b) < 1e-9; }));
-}
\ No newline at end of file
+}
+
+TEST(Konstantinov_I_Sort_Batcher_stl, test_sort_bench_suite) {
+  auto results = ppc::core::RunSortBenchSuite(
+      "stl/Konstantinov_I_Sort_Batcher",
+      ppc::core::MakeSortTaskFactory<konstantinov_i_sort_batcher_stl::RadixSortBatcherSTL, double>());
+  for (const auto& result : results) {
+    EXPECT_TRUE(result.sorted);
+  }
+}
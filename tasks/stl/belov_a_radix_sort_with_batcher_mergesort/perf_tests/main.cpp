@@ -8,6 +8,7 @@
 #include <vector>
 
 #include "core/perf/include/perf.hpp"
+#include "core/perf/include/sort_bench.hpp"
 #include "core/task/include/task.hpp"
 #include "stl/belov_a_radix_sort_with_batcher_mergesort/include/ops_stl.hpp"
 
@@ -124,4 +125,20 @@ TEST(belov_a_radix_batcher_mergesort_stl, test_task_run) {
 
   ppc::core::Perf::PrintPerfStatistic(perf_results);
   EXPECT_TRUE(std::ranges::is_sorted(arr));
-}
\ No newline at end of file
+}
+
+TEST(belov_a_radix_batcher_mergesort_stl, test_sort_bench_suite) {
+  auto results = ppc::core::RunSortBenchSuite<Bigint>(
+      "stl/belov_a_radix_sort_with_batcher_mergesort", [](std::vector<Bigint> &input, std::vector<Bigint> &output) {
+        auto task_data = std::make_shared<ppc::core::TaskData>();
+        task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(input.data()));
+        task_data->inputs_count.emplace_back(input.size());
+        task_data->inputs_count.emplace_back(input.size());
+        task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(output.data()));
+        task_data->outputs_count.emplace_back(output.size());
+        return std::make_shared<belov_a_radix_batcher_mergesort_stl::RadixBatcherMergesortParallel>(task_data);
+      });
+  for (const auto &result : results) {
+    EXPECT_TRUE(result.sorted);
+  }
+}
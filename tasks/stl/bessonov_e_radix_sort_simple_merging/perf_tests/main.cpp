@@ -7,6 +7,7 @@
 #include <vector>
 
 #include "core/perf/include/perf.hpp"
+#include "core/perf/include/sort_bench.hpp"
 #include "core/task/include/task.hpp"
 #include "stl/bessonov_e_radix_sort_simple_merging/include/ops_stl.hpp"
 
@@ -80,4 +81,13 @@ TEST(bessonov_e_radix_sort_simple_merging_seq, test_task_run) {
   ppc::core::Perf::PrintPerfStatistic(perf_results);
 
   ASSERT_EQ(output_vector, result_vector);
-}
\ No newline at end of file
+}
+
+TEST(bessonov_e_radix_sort_simple_merging_seq, test_sort_bench_suite) {
+  auto results = ppc::core::RunSortBenchSuite(
+      "stl/bessonov_e_radix_sort_simple_merging",
+      ppc::core::MakeSortTaskFactory<bessonov_e_radix_sort_simple_merging_stl::TestTaskSTL, double>());
+  for (const auto& result : results) {
+    EXPECT_TRUE(result.sorted);
+  }
+}
@@ -5,24 +5,12 @@
 #include <thread>
 #include <vector>
 
+#include "core/matmul/include/gemm.hpp"
+
 namespace borisov_s_strassen_stl {
 
 namespace {
 
-std::vector<double> MultiplyNaive(const std::vector<double> &a, const std::vector<double> &b, int n) {
-  std::vector<double> c(n * n, 0.0);
-  for (int i = 0; i < n; ++i) {
-    for (int j = 0; j < n; ++j) {
-      double sum = 0.0;
-      for (int k = 0; k < n; ++k) {
-        sum += a[(i * n) + k] * b[(k * n) + j];
-      }
-      c[(i * n) + j] = sum;
-    }
-  }
-  return c;
-}
-
 std::vector<double> AddMatr(const std::vector<double> &a, const std::vector<double> &b, int n) {
   std::vector<double> c(n * n);
   for (int i = 0; i < n * n; ++i) {
@@ -57,8 +45,8 @@ std::vector<double> StrassenRecursive(const std::vector<double> &a, const std::v
                                       int depth = 0) {
   const int parallel_depth = 2;
 
-  if (n <= 64) {
-    return MultiplyNaive(a, b, n);
+  if (static_cast<size_t>(n) <= ppc::matmul::StrassenCutoff()) {
+    return ppc::matmul::Multiply(a, b, n);
   }
   int k = n / 2;
   auto a11 = SubMatrix(a, n, 0, 0, k);
@@ -3,10 +3,13 @@
 #include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <filesystem>
+#include <fstream>
 #include <memory>
 #include <random>
 #include <vector>
 
+#include "core/sort/include/external.hpp"
 #include "core/task/include/task.hpp"
 #include "stl/burykin_m_radix/include/ops_stl.hpp"
 
@@ -110,6 +113,29 @@ TEST(burykin_m_radix_stl, RandomVector_3000) {
   EXPECT_EQ(output, expected);
 }
 
+TEST(burykin_m_radix_stl, SortedWithAppendedRuns) {
+  std::vector<int> input = GenerateRandomVector(20000, -100000, 100000);
+  std::sort(input.begin(), input.begin() + 12000);
+  std::sort(input.begin() + 12000, input.end());
+  std::vector<int> expected = input;
+  std::ranges::sort(expected);
+  std::vector<int> output(input.size(), 0);
+
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.push_back(reinterpret_cast<uint8_t*>(input.data()));
+  task_data->inputs_count.push_back(static_cast<std::uint32_t>(input.size()));
+  task_data->outputs.push_back(reinterpret_cast<uint8_t*>(output.data()));
+  task_data->outputs_count.push_back(static_cast<std::uint32_t>(output.size()));
+
+  burykin_m_radix_stl::RadixSTL task(task_data);
+  ASSERT_TRUE(task.Validation());
+  task.PreProcessing();
+  task.Run();
+  task.PostProcessing();
+
+  EXPECT_EQ(output, expected);
+}
+
 TEST(burykin_m_radix_stl, AllEqual) {
   constexpr size_t kSize = 100;
   std::vector<int> input(kSize, 42);
@@ -150,3 +176,35 @@ TEST(burykin_m_radix_stl, EmptyVector) {
 
   EXPECT_EQ(output, expected);
 }
+
+TEST(burykin_m_radix_stl, ExternalSortWithRadixChunks) {
+  constexpr size_t kSize = 50000;
+  std::vector<int> input = GenerateRandomVector(kSize, -1000000, 1000000);
+  std::vector<int> expected = input;
+  std::ranges::sort(expected);
+
+  const auto dir = std::filesystem::temp_directory_path() / "burykin_m_radix_stl_external";
+  std::filesystem::remove_all(dir);
+  std::filesystem::create_directories(dir);
+  {
+    std::ofstream out(dir / "input.bin", std::ios::binary);
+    out.write(reinterpret_cast<const char*>(input.data()), static_cast<std::streamsize>(kSize * sizeof(int)));
+  }
+
+  ppc::sort::ExternalSortOptions options;
+  options.chunk_elements = 6000;
+  options.block_elements = 512;
+  options.temp_dir = dir;
+  const auto stats = ppc::sort::ExternalSort<int>(dir / "input.bin", dir / "output.bin",
+                                                  burykin_m_radix_stl::RadixSTL::SortChunk, options);
+
+  std::vector<int> output(kSize);
+  {
+    std::ifstream in(dir / "output.bin", std::ios::binary);
+    in.read(reinterpret_cast<char*>(output.data()), static_cast<std::streamsize>(kSize * sizeof(int)));
+  }
+  std::filesystem::remove_all(dir);
+
+  EXPECT_EQ(stats.runs, 9U);
+  EXPECT_EQ(output, expected);
+}
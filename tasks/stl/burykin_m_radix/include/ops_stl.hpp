@@ -2,6 +2,7 @@
 
 #include <array>
 #include <cstddef>
+#include <span>
 #include <utility>
 #include <vector>
 
@@ -17,6 +18,11 @@ class RadixSTL : public ppc::core::Task {
   bool RunImpl() override;
   bool PostProcessingImpl() override;
 
+  // Sorts a in place with the parallel LSD radix passes
+  static void Sort(std::vector<int>& a);
+  // Chunk kernel for ppc::sort::ExternalSort
+  static void SortChunk(std::span<int> chunk);
+
   static std::array<int, 256> ComputeFrequency(const std::vector<int>& a, int shift);
   static std::array<int, 256> ComputeFrequencyParallel(const std::vector<int>& a, int shift, int num_threads);
   static std::array<int, 256> ComputeIndices(const std::array<int, 256>& count);
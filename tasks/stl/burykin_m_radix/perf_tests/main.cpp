@@ -9,6 +9,7 @@
 #include <vector>
 
 #include "core/perf/include/perf.hpp"
+#include "core/perf/include/sort_bench.hpp"
 #include "core/task/include/task.hpp"
 #include "stl/burykin_m_radix/include/ops_stl.hpp"
 
@@ -96,3 +97,11 @@ TEST(burykin_m_radix_stl, test_task_run) {
 
   EXPECT_EQ(output, expected);
 }
+
+TEST(burykin_m_radix_stl, test_sort_bench_suite) {
+  auto results = ppc::core::RunSortBenchSuite(
+      "stl/burykin_m_radix", ppc::core::MakeSortTaskFactory<burykin_m_radix_stl::RadixSTL, int>());
+  for (const auto &result : results) {
+    EXPECT_TRUE(result.sorted);
+  }
+}
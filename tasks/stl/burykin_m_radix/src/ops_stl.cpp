@@ -3,10 +3,12 @@
 #include <algorithm>
 #include <array>
 #include <cstddef>
+#include <span>
 #include <thread>
 #include <utility>
 #include <vector>
 
+#include "core/sort/include/presort.hpp"
 #include "core/util/include/util.hpp"
 
 std::array<int, 256> burykin_m_radix_stl::RadixSTL::ComputeFrequency(const std::vector<int>& a, const int shift) {
@@ -164,12 +166,15 @@ bool burykin_m_radix_stl::RadixSTL::ValidationImpl() {
   return task_data->inputs_count[0] == task_data->outputs_count[0];
 }
 
-bool burykin_m_radix_stl::RadixSTL::RunImpl() {
-  if (input_.empty()) {
-    return true;
+void burykin_m_radix_stl::RadixSTL::Sort(std::vector<int>& a) {
+  if (a.empty()) {
+    return;
+  }
+
+  if (ppc::sort::SortIfPresorted(std::span<int>(a), static_cast<size_t>(ppc::util::GetPPCNumThreads()))) {
+    return;
   }
 
-  std::vector<int> a = std::move(input_);
   std::vector<int> b(a.size());
 
   constexpr size_t kParallelThreshold = 3000;
@@ -195,8 +200,17 @@ bool burykin_m_radix_stl::RadixSTL::RunImpl() {
 
     a.swap(b);
   }
+}
+
+void burykin_m_radix_stl::RadixSTL::SortChunk(std::span<int> chunk) {
+  std::vector<int> a(chunk.begin(), chunk.end());
+  Sort(a);
+  std::ranges::copy(a, chunk.begin());
+}
 
-  output_ = std::move(a);
+bool burykin_m_radix_stl::RadixSTL::RunImpl() {
+  output_ = std::move(input_);
+  Sort(output_);
   return true;
 }
 
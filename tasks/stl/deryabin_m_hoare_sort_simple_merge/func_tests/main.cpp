@@ -322,3 +322,283 @@ TEST(deryabin_m_hoare_sort_simple_merge_stl, test_invalid_chunk_count) {
   deryabin_m_hoare_sort_simple_merge_stl::HoareSortTaskSTL hoare_sort_task_stl(task_data_stl);
   ASSERT_EQ(hoare_sort_task_stl.Validation(), false);
 }
+
+TEST(deryabin_m_hoare_sort_simple_merge_stl, test_sample_sort_task_random_array) {
+  std::random_device rd;
+  std::mt19937 gen(rd());
+  std::uniform_real_distribution<> distribution(-100, 100);
+  std::vector<double> input_array(20000);
+  std::ranges::generate(input_array.begin(), input_array.end(), [&] { return distribution(gen); });
+  std::vector<std::vector<double>> in_array(1, input_array);
+  size_t chunk_count = 8;
+  std::vector<double> output_array(20000);
+  std::vector<std::vector<double>> out_array(1, output_array);
+  std::vector<double> true_solution(input_array);
+  std::ranges::sort(true_solution.begin(), true_solution.end());
+
+  auto task_data_stl = std::make_shared<ppc::core::TaskData>();
+  task_data_stl->inputs.emplace_back(reinterpret_cast<uint8_t*>(in_array.data()));
+  task_data_stl->inputs_count.emplace_back(input_array.size());
+  task_data_stl->inputs_count.emplace_back(chunk_count);
+  task_data_stl->outputs.emplace_back(reinterpret_cast<uint8_t*>(out_array.data()));
+  task_data_stl->outputs_count.emplace_back(output_array.size());
+
+  deryabin_m_hoare_sort_simple_merge_stl::HoareSampleSortTaskSTL sample_sort_task_stl(task_data_stl);
+  ASSERT_EQ(sample_sort_task_stl.Validation(), true);
+  sample_sort_task_stl.PreProcessing();
+  sample_sort_task_stl.Run();
+  sample_sort_task_stl.PostProcessing();
+  ASSERT_EQ(true_solution, out_array[0]);
+}
+
+TEST(deryabin_m_hoare_sort_simple_merge_stl, test_sample_sort_many_threads_random_array) {
+  std::random_device rd;
+  std::mt19937 gen(rd());
+  std::uniform_real_distribution<> distribution(-100, 100);
+  std::vector<double> input_array(50000);
+  std::ranges::generate(input_array.begin(), input_array.end(), [&] { return distribution(gen); });
+  std::vector<double> true_solution(input_array);
+  std::ranges::sort(true_solution.begin(), true_solution.end());
+
+  deryabin_m_hoare_sort_simple_merge_stl::SampleSort(input_array, 7);
+  ASSERT_EQ(true_solution, input_array);
+}
+
+TEST(deryabin_m_hoare_sort_simple_merge_stl, test_sample_sort_backward_sorted_array) {
+  std::vector<double> input_array(50000);
+  std::ranges::generate(input_array.begin(), input_array.end(), [value = 50000.0]() mutable { return value--; });
+  std::vector<double> true_solution(input_array);
+  std::ranges::sort(true_solution.begin(), true_solution.end());
+
+  deryabin_m_hoare_sort_simple_merge_stl::SampleSort(input_array, 8);
+  ASSERT_EQ(true_solution, input_array);
+}
+
+TEST(deryabin_m_hoare_sort_simple_merge_stl, test_sample_sort_few_unique_values) {
+  std::random_device rd;
+  std::mt19937 gen(rd());
+  std::uniform_int_distribution<> distribution(0, 3);
+  std::vector<double> input_array(50000);
+  std::ranges::generate(input_array.begin(), input_array.end(), [&] { return distribution(gen); });
+  std::vector<double> true_solution(input_array);
+  std::ranges::sort(true_solution.begin(), true_solution.end());
+
+  deryabin_m_hoare_sort_simple_merge_stl::SampleSort(input_array, 8);
+  ASSERT_EQ(true_solution, input_array);
+}
+
+TEST(deryabin_m_hoare_sort_simple_merge_stl, test_sample_partition_spreads_repeated_key) {
+  std::random_device rd;
+  std::mt19937 gen(rd());
+  std::uniform_real_distribution<> distribution(-100, 100);
+  std::vector<double> input_array(50000);
+  for (size_t i = 0; i < input_array.size(); ++i) {
+    input_array[i] = i % 10 == 0 ? distribution(gen) : 7.0;
+  }
+  std::vector<double> true_solution(input_array);
+  std::ranges::sort(true_solution.begin(), true_solution.end());
+
+  const auto bucket_begin = deryabin_m_hoare_sort_simple_merge_stl::SamplePartition(input_array, 8);
+  ASSERT_EQ(bucket_begin.size(), 9U);
+  for (size_t b = 0; b < 8; ++b) {
+    // 90% of the keys are 7.0; they must not all end up in one bucket
+    EXPECT_LE(bucket_begin[b + 1] - bucket_begin[b], input_array.size() / 4);
+    if (b > 0 && bucket_begin[b] > bucket_begin[b - 1] && bucket_begin[b + 1] > bucket_begin[b]) {
+      EXPECT_LE(*std::max_element(input_array.begin() + static_cast<long>(bucket_begin[b - 1]),
+                                  input_array.begin() + static_cast<long>(bucket_begin[b])),
+                *std::min_element(input_array.begin() + static_cast<long>(bucket_begin[b]),
+                                  input_array.begin() + static_cast<long>(bucket_begin[b + 1])));
+    }
+  }
+  std::ranges::sort(input_array.begin(), input_array.end());
+  ASSERT_EQ(true_solution, input_array);
+}
+
+TEST(deryabin_m_hoare_sort_simple_merge_stl, test_sample_sort_task_without_chunk_count) {
+  std::random_device rd;
+  std::mt19937 gen(rd());
+  std::uniform_real_distribution<> distribution(-100, 100);
+  std::vector<double> input_array(65536);
+  std::ranges::generate(input_array.begin(), input_array.end(), [&] { return distribution(gen); });
+  std::vector<std::vector<double>> in_array(1, input_array);
+  std::vector<double> output_array(65536);
+  std::vector<std::vector<double>> out_array(1, output_array);
+  std::vector<double> true_solution(input_array);
+  std::ranges::sort(true_solution.begin(), true_solution.end());
+
+  auto task_data_stl = std::make_shared<ppc::core::TaskData>();
+  task_data_stl->inputs.emplace_back(reinterpret_cast<uint8_t*>(in_array.data()));
+  task_data_stl->inputs_count.emplace_back(input_array.size());
+  task_data_stl->outputs.emplace_back(reinterpret_cast<uint8_t*>(out_array.data()));
+  task_data_stl->outputs_count.emplace_back(output_array.size());
+
+  deryabin_m_hoare_sort_simple_merge_stl::HoareSampleSortTaskSTL sample_sort_task_stl(task_data_stl);
+  ASSERT_EQ(sample_sort_task_stl.Validation(), true);
+  sample_sort_task_stl.PreProcessing();
+  sample_sort_task_stl.Run();
+  sample_sort_task_stl.PostProcessing();
+  ASSERT_EQ(true_solution, out_array[0]);
+}
+
+TEST(deryabin_m_hoare_sort_simple_merge_stl, test_all_equal_array) {
+  std::vector<double> input_array(3200, 7.0);
+  std::vector<std::vector<double>> in_array(1, input_array);
+  size_t chunk_count = 8;
+  std::vector<double> output_array(3200);
+  std::vector<std::vector<double>> out_array(1, output_array);
+
+  auto task_data_stl = std::make_shared<ppc::core::TaskData>();
+  task_data_stl->inputs.emplace_back(reinterpret_cast<uint8_t*>(in_array.data()));
+  task_data_stl->inputs_count.emplace_back(input_array.size());
+  task_data_stl->inputs_count.emplace_back(chunk_count);
+  task_data_stl->outputs.emplace_back(reinterpret_cast<uint8_t*>(out_array.data()));
+  task_data_stl->outputs_count.emplace_back(output_array.size());
+
+  deryabin_m_hoare_sort_simple_merge_stl::HoareSortTaskSTL hoare_sort_task_stl(task_data_stl);
+  ASSERT_EQ(hoare_sort_task_stl.Validation(), true);
+  hoare_sort_task_stl.PreProcessing();
+  hoare_sort_task_stl.Run();
+  hoare_sort_task_stl.PostProcessing();
+  ASSERT_EQ(input_array, out_array[0]);
+}
+
+TEST(deryabin_m_hoare_sort_simple_merge_stl, test_hoare_sort_organ_pipe_array) {
+  std::vector<double> input_array(100000);
+  const auto half = static_cast<long>(input_array.size() / 2U);
+  std::ranges::generate(input_array.begin(), input_array.begin() + half, [value = 0.0]() mutable { return value++; });
+  std::ranges::generate(input_array.begin() + half, input_array.end(), [value = 50000.0]() mutable { return value--; });
+  std::vector<double> true_solution(input_array);
+  std::ranges::sort(true_solution.begin(), true_solution.end());
+
+  deryabin_m_hoare_sort_simple_merge_stl::HoareSort(input_array, 0, input_array.size() - 1);
+  ASSERT_EQ(true_solution, input_array);
+}
+
+TEST(deryabin_m_hoare_sort_simple_merge_stl, test_hoare_sort_subrange_with_duplicates) {
+  std::random_device rd;
+  std::mt19937 gen(rd());
+  std::uniform_int_distribution<> distribution(-5, 5);
+  std::vector<double> input_array(10000);
+  std::ranges::generate(input_array.begin(), input_array.end(), [&] { return distribution(gen); });
+  std::vector<double> true_solution(input_array);
+  std::sort(true_solution.begin() + 1000, true_solution.end() - 1000);
+
+  deryabin_m_hoare_sort_simple_merge_stl::HoareSort(input_array, 1000, input_array.size() - 1001);
+  ASSERT_EQ(true_solution, input_array);
+}
+
+TEST(deryabin_m_hoare_sort_simple_merge_stl, test_sorted_array_with_appended_tail) {
+  std::random_device rd;
+  std::mt19937 gen(rd());
+  std::uniform_real_distribution<> distribution(-100, 100);
+  std::vector<double> input_array(6400);
+  std::ranges::generate(input_array.begin(), input_array.end(), [&] { return distribution(gen); });
+  std::sort(input_array.begin(), input_array.end() - 400);
+  std::sort(input_array.end() - 400, input_array.end());
+  std::vector<std::vector<double>> in_array(1, input_array);
+  size_t chunk_count = 8;
+  std::vector<double> output_array(6400);
+  std::vector<std::vector<double>> out_array(1, output_array);
+  std::vector<double> true_solution(input_array);
+  std::ranges::sort(true_solution.begin(), true_solution.end());
+
+  auto task_data_stl = std::make_shared<ppc::core::TaskData>();
+  task_data_stl->inputs.emplace_back(reinterpret_cast<uint8_t*>(in_array.data()));
+  task_data_stl->inputs_count.emplace_back(input_array.size());
+  task_data_stl->inputs_count.emplace_back(chunk_count);
+  task_data_stl->outputs.emplace_back(reinterpret_cast<uint8_t*>(out_array.data()));
+  task_data_stl->outputs_count.emplace_back(output_array.size());
+
+  deryabin_m_hoare_sort_simple_merge_stl::HoareSampleSortTaskSTL sample_sort_task_stl(task_data_stl);
+  ASSERT_EQ(sample_sort_task_stl.Validation(), true);
+  sample_sort_task_stl.PreProcessing();
+  sample_sort_task_stl.Run();
+  sample_sort_task_stl.PostProcessing();
+  ASSERT_EQ(true_solution, out_array[0]);
+}
+
+TEST(deryabin_m_hoare_sort_simple_merge_stl, test_size_not_multiple_of_chunk_count) {
+  std::random_device rd;
+  std::mt19937 gen(rd());
+  std::uniform_real_distribution<> distribution(-100, 100);
+  std::vector<double> input_array(1000);
+  std::ranges::generate(input_array.begin(), input_array.end(), [&] { return distribution(gen); });
+  std::vector<std::vector<double>> in_array(1, input_array);
+  size_t chunk_count = 16;
+  std::vector<double> output_array(1000);
+  std::vector<std::vector<double>> out_array(1, output_array);
+  std::vector<double> true_solution(input_array);
+  std::ranges::sort(true_solution.begin(), true_solution.end());
+
+  auto task_data_stl = std::make_shared<ppc::core::TaskData>();
+  task_data_stl->inputs.emplace_back(reinterpret_cast<uint8_t*>(in_array.data()));
+  task_data_stl->inputs_count.emplace_back(input_array.size());
+  task_data_stl->inputs_count.emplace_back(chunk_count);
+  task_data_stl->outputs.emplace_back(reinterpret_cast<uint8_t*>(out_array.data()));
+  task_data_stl->outputs_count.emplace_back(output_array.size());
+
+  deryabin_m_hoare_sort_simple_merge_stl::HoareSortTaskSTL hoare_sort_task_stl(task_data_stl);
+  ASSERT_EQ(hoare_sort_task_stl.Validation(), true);
+  hoare_sort_task_stl.PreProcessing();
+  hoare_sort_task_stl.Run();
+  hoare_sort_task_stl.PostProcessing();
+  ASSERT_EQ(true_solution, out_array[0]);
+}
+
+TEST(deryabin_m_hoare_sort_simple_merge_stl, test_chunk_count_not_power_of_two) {
+  std::random_device rd;
+  std::mt19937 gen(rd());
+  std::uniform_real_distribution<> distribution(-100, 100);
+  for (size_t chunk_count : {3, 5, 6, 7}) {
+    std::vector<double> input_array(65536);
+    std::ranges::generate(input_array.begin(), input_array.end(), [&] { return distribution(gen); });
+    std::vector<std::vector<double>> in_array(1, input_array);
+    std::vector<double> output_array(65536);
+    std::vector<std::vector<double>> out_array(1, output_array);
+    std::vector<double> true_solution(input_array);
+    std::ranges::sort(true_solution.begin(), true_solution.end());
+
+    auto task_data_stl = std::make_shared<ppc::core::TaskData>();
+    task_data_stl->inputs.emplace_back(reinterpret_cast<uint8_t*>(in_array.data()));
+    task_data_stl->inputs_count.emplace_back(input_array.size());
+    task_data_stl->inputs_count.emplace_back(chunk_count);
+    task_data_stl->outputs.emplace_back(reinterpret_cast<uint8_t*>(out_array.data()));
+    task_data_stl->outputs_count.emplace_back(output_array.size());
+
+    deryabin_m_hoare_sort_simple_merge_stl::HoareSortTaskSTL hoare_sort_task_stl(task_data_stl);
+    ASSERT_EQ(hoare_sort_task_stl.Validation(), true);
+    hoare_sort_task_stl.PreProcessing();
+    hoare_sort_task_stl.Run();
+    hoare_sort_task_stl.PostProcessing();
+    ASSERT_EQ(true_solution, out_array[0]) << "chunk_count = " << chunk_count;
+  }
+}
+
+TEST(deryabin_m_hoare_sort_simple_merge_stl, test_sequential_size_not_multiple_of_chunk_count) {
+  std::random_device rd;
+  std::mt19937 gen(rd());
+  std::uniform_real_distribution<> distribution(-100, 100);
+  for (size_t chunk_count : {3, 8}) {
+    std::vector<double> input_array(1000);
+    std::ranges::generate(input_array.begin(), input_array.end(), [&] { return distribution(gen); });
+    std::vector<std::vector<double>> in_array(1, input_array);
+    std::vector<double> output_array(1000);
+    std::vector<std::vector<double>> out_array(1, output_array);
+    std::vector<double> true_solution(input_array);
+    std::ranges::sort(true_solution.begin(), true_solution.end());
+
+    auto task_data_seq = std::make_shared<ppc::core::TaskData>();
+    task_data_seq->inputs.emplace_back(reinterpret_cast<uint8_t*>(in_array.data()));
+    task_data_seq->inputs_count.emplace_back(input_array.size());
+    task_data_seq->inputs_count.emplace_back(chunk_count);
+    task_data_seq->outputs.emplace_back(reinterpret_cast<uint8_t*>(out_array.data()));
+    task_data_seq->outputs_count.emplace_back(output_array.size());
+
+    deryabin_m_hoare_sort_simple_merge_stl::HoareSortTaskSequential hoare_sort_task_seq(task_data_seq);
+    ASSERT_EQ(hoare_sort_task_seq.Validation(), true);
+    hoare_sort_task_seq.PreProcessing();
+    hoare_sort_task_seq.Run();
+    hoare_sort_task_seq.PostProcessing();
+    ASSERT_EQ(true_solution, out_array[0]) << "chunk_count = " << chunk_count;
+  }
+}
@@ -8,7 +8,14 @@
 
 namespace deryabin_m_hoare_sort_simple_merge_stl {
 
+// Sorts a[first..last] (inclusive) with introsort, so the worst case stays O(n log n)
 void HoareSort(std::vector<double>& a, size_t first, size_t last);
+// Moves a into bucket_count buckets around oversampled splitters, keys equal to a splitter are spread over the
+// buckets it bounds. Returns the bucket_count + 1 bucket boundaries. Needs a.size() >= bucket_count * 32.
+std::vector<size_t> SamplePartition(std::vector<double>& a, size_t bucket_count);
+// Sample sort: oversampled splitters, parallel partition into num_threads buckets and independent
+// bucket sorts with HoareSort. Buckets are already in order, so there is no merge phase.
+void SampleSort(std::vector<double>& a, size_t num_threads);
 
 class HoareSortTaskSequential : public ppc::core::Task {
  public:
@@ -38,4 +45,16 @@ class HoareSortTaskSTL : public ppc::core::Task {
   size_t min_chunk_size_;
   size_t chunk_count_;
 };
+class HoareSampleSortTaskSTL : public ppc::core::Task {
+ public:
+  explicit HoareSampleSortTaskSTL(ppc::core::TaskDataPtr task_data) : Task(std::move(task_data)) {}
+  bool PreProcessingImpl() override;
+  bool ValidationImpl() override;
+  bool RunImpl() override;
+  bool PostProcessingImpl() override;
+
+ private:
+  std::vector<double> input_array_A_;
+  size_t dimension_;
+};
 }  // namespace deryabin_m_hoare_sort_simple_merge_stl
@@ -10,6 +10,7 @@
 #include <vector>
 
 #include "core/perf/include/perf.hpp"
+#include "core/perf/include/sort_bench.hpp"
 #include "core/task/include/task.hpp"
 #include "stl/deryabin_m_hoare_sort_simple_merge/include/ops_stl.hpp"
 
@@ -124,3 +125,19 @@ TEST(deryabin_m_hoare_sort_simple_merge_stl, test_task_run_STL) {
   ASSERT_EQ(true_solution, out_array_stl[0]);
   ASSERT_EQ(true_solution, out_array_seq[0]);
 }
+
+TEST(deryabin_m_hoare_sort_simple_merge_stl, test_sort_bench_suite) {
+  auto results = ppc::core::RunSortBenchSuite<double>(
+      "stl/deryabin_m_hoare_sort_simple_merge", [](std::vector<double>& input, std::vector<double>& output) {
+        auto task_data = std::make_shared<ppc::core::TaskData>();
+        task_data->inputs.emplace_back(reinterpret_cast<uint8_t*>(&input));
+        task_data->inputs_count.emplace_back(input.size());
+        task_data->inputs_count.emplace_back(16);
+        task_data->outputs.emplace_back(reinterpret_cast<uint8_t*>(&output));
+        task_data->outputs_count.emplace_back(output.size());
+        return std::make_shared<deryabin_m_hoare_sort_simple_merge_stl::HoareSortTaskSTL>(task_data);
+      });
+  for (const auto& result : results) {
+    EXPECT_TRUE(result.sorted);
+  }
+}
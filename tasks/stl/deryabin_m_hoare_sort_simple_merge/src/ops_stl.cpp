@@ -1,36 +1,295 @@
 #include "stl/deryabin_m_hoare_sort_simple_merge/include/ops_stl.hpp"
 
 #include <algorithm>
+#include <array>
 #include <bit>
 #include <cmath>
 #include <cstddef>
+#include <cstdint>
+#include <span>
 #include <thread>
+#include <utility>
 #include <vector>
 
+#include "core/sort/include/presort.hpp"
 #include "core/util/include/util.hpp"
 
+namespace {
+
+// Samples taken per bucket when choosing splitters
+constexpr size_t kOversampling = 32;
+
+// First element of chunk c; the last chunk also takes the remainder when the size is not a multiple of the chunk count
+size_t ChunkBegin(size_t c, size_t chunk_count, size_t min_chunk_size, size_t dimension) {
+  return c < chunk_count ? c * min_chunk_size : dimension;
+}
+
+template <typename Func>
+void RunOnThreads(size_t num_threads, Func&& func) {
+  std::vector<std::thread> workers;
+  workers.reserve(num_threads - 1);
+  for (size_t t = 1; t < num_threads; ++t) {
+    workers.emplace_back([&func, t] { func(t); });
+  }
+  func(0);
+  for (auto& worker : workers) {
+    worker.join();
+  }
+}
+
+std::vector<double> ChooseSplitters(const std::vector<double>& a, size_t bucket_count) {
+  const size_t sample_size = bucket_count * kOversampling;
+  const size_t stride = a.size() / sample_size;
+  std::vector<double> sample(sample_size);
+  for (size_t i = 0; i < sample_size; ++i) {
+    sample[i] = a[(i * stride) + (stride / 2)];
+  }
+  deryabin_m_hoare_sort_simple_merge_stl::HoareSort(sample, 0, sample_size - 1);
+  std::vector<double> splitters(bucket_count - 1);
+  for (size_t b = 0; b + 1 < bucket_count; ++b) {
+    splitters[b] = sample[(b + 1) * kOversampling];
+  }
+  return splitters;
+}
+
+// Ranges this short are finished by insertion sort
+constexpr ptrdiff_t kInsertionSortThreshold = 16;
+// Above this size the pivot is Tukey's ninther instead of a median of three
+constexpr ptrdiff_t kNintherThreshold = 128;
+// Elements classified per side in one round of the block partition
+constexpr ptrdiff_t kPartitionBlock = 64;
+
+void InsertionSort(double* begin, double* end) {
+  for (double* cur = begin + 1; cur < end; ++cur) {
+    const double value = *cur;
+    double* hole = cur;
+    while (hole > begin && value < *(hole - 1)) {
+      *hole = *(hole - 1);
+      --hole;
+    }
+    *hole = value;
+  }
+}
+
+void Sort3(double* a, double* b, double* c) {
+  if (*b < *a) {
+    std::swap(*a, *b);
+  }
+  if (*c < *b) {
+    std::swap(*b, *c);
+    if (*b < *a) {
+      std::swap(*a, *b);
+    }
+  }
+}
+
+// Moves the median of three (or of three medians of three on large ranges) to *begin
+void MovePivotToBegin(double* begin, double* end) {
+  const ptrdiff_t size = end - begin;
+  double* mid = begin + (size / 2);
+  if (size > kNintherThreshold) {
+    Sort3(begin, mid, end - 1);
+    Sort3(begin + 1, mid - 1, end - 2);
+    Sort3(begin + 2, mid + 1, end - 3);
+    Sort3(mid - 1, mid, mid + 1);
+  } else {
+    Sort3(begin, mid, end - 1);
+  }
+  std::swap(*begin, *mid);
+}
+
+// Partitions (begin, end) around the pivot *begin into [< pivot][pivot][>= pivot] and returns the pivot
+// position. Misplaced elements are first collected into offset buffers without branches (BlockQuicksort),
+// then swapped pairwise, so the comparison loop carries no data-dependent jumps.
+double* BlockPartition(double* begin, double* end) {
+  const double pivot = *begin;
+  double* first = begin + 1;
+  double* last = end;
+  std::array<unsigned char, kPartitionBlock> offsets_l{};
+  std::array<unsigned char, kPartitionBlock> offsets_r{};
+  ptrdiff_t num_l = 0;
+  ptrdiff_t num_r = 0;
+  ptrdiff_t start_l = 0;
+  ptrdiff_t start_r = 0;
+  while (last - first > 2 * kPartitionBlock) {
+    if (num_l == 0) {
+      start_l = 0;
+      for (ptrdiff_t i = 0; i < kPartitionBlock; ++i) {
+        offsets_l[num_l] = static_cast<unsigned char>(i);
+        num_l += static_cast<ptrdiff_t>(!(first[i] < pivot));
+      }
+    }
+    if (num_r == 0) {
+      start_r = 0;
+      for (ptrdiff_t i = 0; i < kPartitionBlock; ++i) {
+        offsets_r[num_r] = static_cast<unsigned char>(i);
+        num_r += static_cast<ptrdiff_t>(*(last - 1 - i) < pivot);
+      }
+    }
+    const ptrdiff_t num = std::min(num_l, num_r);
+    for (ptrdiff_t k = 0; k < num; ++k) {
+      std::swap(first[offsets_l[start_l + k]], *(last - 1 - offsets_r[start_r + k]));
+    }
+    num_l -= num;
+    num_r -= num;
+    start_l += num;
+    start_r += num;
+    if (num_l == 0) {
+      first += kPartitionBlock;
+    }
+    if (num_r == 0) {
+      last -= kPartitionBlock;
+    }
+  }
+  // Whatever is left, including a partially processed block, goes through a plain Hoare pass
+  while (true) {
+    while (first < last && *first < pivot) {
+      ++first;
+    }
+    while (first < last && !(*(last - 1) < pivot)) {
+      --last;
+    }
+    if (first >= last) {
+      break;
+    }
+    std::swap(*first, *(last - 1));
+    ++first;
+    --last;
+  }
+  double* pivot_pos = first - 1;
+  std::swap(*begin, *pivot_pos);
+  return pivot_pos;
+}
+
+// Used when the pivot equals the element just before the range: nothing in the range is smaller than it, so
+// this gathers every copy of the pivot at the front and returns the first element greater than the pivot
+double* PartitionEqual(double* begin, double* end) {
+  const double pivot = *begin;
+  double* first = begin + 1;
+  double* last = end;
+  while (true) {
+    while (first < last && !(pivot < *first)) {
+      ++first;
+    }
+    while (first < last && pivot < *(last - 1)) {
+      --last;
+    }
+    if (first >= last) {
+      break;
+    }
+    std::swap(*first, *(last - 1));
+    ++first;
+    --last;
+  }
+  return first;
+}
+
+// Introsort: quicksort with median-of-3/ninther pivots, a three-way split for runs of equal keys and a
+// heapsort fallback once the recursion gets 2*log2(n) levels deep
+void IntroSort(double* begin, double* end, int depth_limit, bool leftmost) {
+  while (end - begin > kInsertionSortThreshold) {
+    if (depth_limit == 0) {
+      std::make_heap(begin, end);
+      std::sort_heap(begin, end);
+      return;
+    }
+    --depth_limit;
+    MovePivotToBegin(begin, end);
+    if (!leftmost && !(*(begin - 1) < *begin)) {
+      begin = PartitionEqual(begin, end);
+      continue;
+    }
+    double* pivot_pos = BlockPartition(begin, end);
+    // Recurse into the smaller side and loop on the larger one to keep the stack shallow
+    if (pivot_pos - begin < end - pivot_pos) {
+      IntroSort(begin, pivot_pos, depth_limit, leftmost);
+      begin = pivot_pos + 1;
+      leftmost = false;
+    } else {
+      IntroSort(pivot_pos + 1, end, depth_limit, false);
+      end = pivot_pos;
+    }
+  }
+  InsertionSort(begin, end);
+}
+
+}  // namespace
+
 void deryabin_m_hoare_sort_simple_merge_stl::HoareSort(std::vector<double>& a, size_t first, size_t last) {
   if (first >= last) {
     return;
   }
-  const double x = a[(first + last) >> 1];
-  double* pi = &a[first];
-  double* pj = &a[last];
-  do {
-    while (*pi < x) {
-      pi++;
+  double* begin = a.data() + first;
+  double* end = a.data() + last + 1;
+  IntroSort(begin, end, 2 * (static_cast<int>(std::bit_width(last - first + 1)) - 1), true);
+}
+
+std::vector<size_t> deryabin_m_hoare_sort_simple_merge_stl::SamplePartition(std::vector<double>& a,
+                                                                            size_t bucket_count) {
+  const size_t n = a.size();
+  const std::vector<double> splitters = ChooseSplitters(a, bucket_count);
+
+  // Every thread classifies its own contiguous block, remembering the bucket of each element. Bucket b holds
+  // [splitters[b - 1], splitters[b]], so a key equal to a run of k equal splitters may go to any of the k + 1
+  // buckets around it; such keys take those buckets in turn by position, otherwise a heavily repeated key
+  // would fill a single bucket.
+  const size_t block_size = (n + bucket_count - 1) / bucket_count;
+  std::vector<uint32_t> bucket_of(n);
+  std::vector<std::vector<size_t>> offsets(bucket_count, std::vector<size_t>(bucket_count, 0));
+  RunOnThreads(bucket_count, [&](size_t t) {
+    const size_t begin = std::min(n, t * block_size);
+    const size_t end = std::min(n, begin + block_size);
+    for (size_t i = begin; i < end; ++i) {
+      const auto upper = std::ranges::upper_bound(splitters, a[i]);
+      auto bucket = static_cast<size_t>(upper - splitters.begin());
+      if (upper != splitters.begin() && !(*(upper - 1) < a[i])) {
+        const auto first = static_cast<size_t>(std::lower_bound(splitters.begin(), upper, a[i]) - splitters.begin());
+        bucket = first + (i % (bucket - first + 1));
+      }
+      bucket_of[i] = static_cast<uint32_t>(bucket);
+      offsets[t][bucket]++;
     }
-    while (*pj > x) {
-      pj--;
+  });
+
+  // Exclusive prefix sum in bucket-major order gives each thread its write position in every bucket
+  std::vector<size_t> bucket_begin(bucket_count + 1, 0);
+  size_t position = 0;
+  for (size_t b = 0; b < bucket_count; ++b) {
+    bucket_begin[b] = position;
+    for (size_t t = 0; t < bucket_count; ++t) {
+      const size_t count = offsets[t][b];
+      offsets[t][b] = position;
+      position += count;
     }
-    const double tmp = *pi;
-    *pi = *pj;
-    *pj = tmp;
-  } while (pi < pj);
-  const size_t j = pj - a.data();
-  const size_t i = pi - a.data();
-  HoareSort(a, first, j);
-  HoareSort(a, i + 1, last);
+  }
+  bucket_begin[bucket_count] = n;
+
+  std::vector<double> partitioned(n);
+  RunOnThreads(bucket_count, [&](size_t t) {
+    const size_t begin = std::min(n, t * block_size);
+    const size_t end = std::min(n, begin + block_size);
+    for (size_t i = begin; i < end; ++i) {
+      partitioned[offsets[t][bucket_of[i]]++] = a[i];
+    }
+  });
+  a = std::move(partitioned);
+  return bucket_begin;
+}
+
+void deryabin_m_hoare_sort_simple_merge_stl::SampleSort(std::vector<double>& a, size_t num_threads) {
+  const size_t n = a.size();
+  if (num_threads < 2 || n < 2 * num_threads * kOversampling) {
+    if (n > 1) {
+      HoareSort(a, 0, n - 1);
+    }
+    return;
+  }
+  const std::vector<size_t> bucket_begin = SamplePartition(a, num_threads);
+  RunOnThreads(num_threads, [&](size_t b) {
+    if (bucket_begin[b + 1] - bucket_begin[b] > 1) {
+      HoareSort(a, bucket_begin[b], bucket_begin[b + 1] - 1);
+    }
+  });
 }
 
 bool deryabin_m_hoare_sort_simple_merge_stl::HoareSortTaskSequential::PreProcessingImpl() {
@@ -42,24 +301,27 @@ bool deryabin_m_hoare_sort_simple_merge_stl::HoareSortTaskSequential::PreProcess
 }
 
 bool deryabin_m_hoare_sort_simple_merge_stl::HoareSortTaskSequential::ValidationImpl() {
-  return static_cast<unsigned short>(task_data->inputs_count[0]) > 2 &&
-         static_cast<unsigned short>(task_data->inputs_count[1]) >= 2 &&
+  return task_data->inputs_count.size() > 1 && task_data->inputs_count[0] > 2 && task_data->inputs_count[1] >= 2 &&
          task_data->inputs_count[0] == task_data->outputs_count[0];
 }
 
 bool deryabin_m_hoare_sort_simple_merge_stl::HoareSortTaskSequential::RunImpl() {
-  size_t count = 0;
-  while (count != chunk_count_) {
-    HoareSort(input_array_A_, count * min_chunk_size_, ((count + 1) * min_chunk_size_) - 1);
-    count++;
+  for (size_t count = 0; count < chunk_count_; ++count) {
+    const size_t first = ChunkBegin(count, chunk_count_, min_chunk_size_, dimension_);
+    const size_t last = ChunkBegin(count + 1, chunk_count_, min_chunk_size_, dimension_);
+    if (last - first > 1) {
+      HoareSort(input_array_A_, first, last - 1);
+    }
   }
-  size_t chunk_count = chunk_count_;
-  for (size_t i = 0; i < static_cast<size_t>(std::bit_width(chunk_count_) - 1); i++) {
-    for (size_t j = 0; j < chunk_count; j++) {
-      std::inplace_merge(input_array_A_.begin() + static_cast<long>(j * min_chunk_size_ << (i + 1)),
-                         input_array_A_.begin() + static_cast<long>(((j << 1 | 1) * (min_chunk_size_ << i))),
-                         input_array_A_.begin() + static_cast<long>((j + 1) * min_chunk_size_ << (i + 1)));
-      chunk_count--;
+  // On the level with runs of width chunks, run 2j is merged with run 2j + 1. A run without a pair is carried
+  // to the next level unchanged, so any chunk count works, not only powers of two.
+  const auto begin = [this](size_t c) {
+    return input_array_A_.begin() +
+           static_cast<long>(ChunkBegin(std::min(c, chunk_count_), chunk_count_, min_chunk_size_, dimension_));
+  };
+  for (size_t width = 1; width < chunk_count_; width <<= 1) {
+    for (size_t j = 0; (2 * j + 1) * width < chunk_count_; ++j) {
+      std::inplace_merge(begin(2 * j * width), begin((2 * j + 1) * width), begin((2 * j + 2) * width));
     }
   }
   return true;
@@ -79,14 +341,16 @@ bool deryabin_m_hoare_sort_simple_merge_stl::HoareSortTaskSTL::PreProcessingImpl
 }
 
 bool deryabin_m_hoare_sort_simple_merge_stl::HoareSortTaskSTL::ValidationImpl() {
-  return static_cast<unsigned short>(task_data->inputs_count[0]) > 2 &&
-         static_cast<unsigned short>(task_data->inputs_count[1]) >= 2 &&
+  return task_data->inputs_count.size() > 1 && task_data->inputs_count[0] > 2 && task_data->inputs_count[1] >= 2 &&
          task_data->inputs_count[0] == task_data->outputs_count[0];
 }
 
 bool deryabin_m_hoare_sort_simple_merge_stl::HoareSortTaskSTL::RunImpl() {
   const size_t num_threads =
       std::min(static_cast<unsigned int>(ppc::util::GetPPCNumThreads()), std::thread::hardware_concurrency());
+  if (ppc::sort::SortIfPresorted(std::span<double>(input_array_A_), num_threads)) {
+    return true;
+  }
   if (chunk_count_ < num_threads) {
     // Увеличиваем число кусочков до ближайшей степени двойки >= num_threads,
     // чтобы эффективно загрузить все доступные потоки
@@ -117,22 +381,23 @@ bool deryabin_m_hoare_sort_simple_merge_stl::HoareSortTaskSTL::RunImpl() {
     }
     workers.resize(0);
   };
+  // The last chunk also takes the remainder when dimension_ is not a multiple of chunk_count_
   parallel_for(0, chunk_count_, [this](size_t count) {
-    HoareSort(input_array_A_, count * min_chunk_size_, ((count + 1) * min_chunk_size_) - 1);
+    const size_t first = ChunkBegin(count, chunk_count_, min_chunk_size_, dimension_);
+    const size_t last = ChunkBegin(count + 1, chunk_count_, min_chunk_size_, dimension_);
+    if (last - first > 1) {
+      HoareSort(input_array_A_, first, last - 1);
+    }
   });
-  for (size_t i = 0; i < static_cast<size_t>(std::bit_width(chunk_count_) -
-                                             1);  // Вычисялем сколько уровней слияния потребуется как логарифм по
-                                                  // основанию 2 от числа частей chunk_count_
-       ++i) {  // На каждом уровне сливаются пары соседних блоков размером min_chunk_size_ × 2^i
-    parallel_for(
-        0, chunk_count_ >> (i + 1), [this, i](size_t j) {  // Распределение слияний между потоками на каждом уровне
-          std::inplace_merge(
-              input_array_A_.begin() +
-                  static_cast<long>(j * min_chunk_size_ << (i + 1)),  // Вызов std::inplace_merge для слияния двух
-                                                                      // подмассивов, отсортированных функцией HoareSort
-              input_array_A_.begin() + static_cast<long>(((j << 1 | 1) * (min_chunk_size_ << i))),
-              input_array_A_.begin() + static_cast<long>((j + 1) * min_chunk_size_ << (i + 1)));
-        });
+  // Same level-by-level merge as the sequential task, with the merges of a level spread over the threads
+  const auto begin = [this](size_t c) {
+    return input_array_A_.begin() +
+           static_cast<long>(ChunkBegin(std::min(c, chunk_count_), chunk_count_, min_chunk_size_, dimension_));
+  };
+  for (size_t width = 1; width < chunk_count_; width <<= 1) {
+    parallel_for(0, (chunk_count_ + width - 1) / (2 * width), [&begin, width](size_t j) {
+      std::inplace_merge(begin(2 * j * width), begin((2 * j + 1) * width), begin((2 * j + 2) * width));
+    });
   }
   return true;
 }
@@ -141,3 +406,29 @@ bool deryabin_m_hoare_sort_simple_merge_stl::HoareSortTaskSTL::PostProcessingImp
   reinterpret_cast<std::vector<double>*>(task_data->outputs[0])[0] = input_array_A_;
   return true;
 }
+
+bool deryabin_m_hoare_sort_simple_merge_stl::HoareSampleSortTaskSTL::PreProcessingImpl() {
+  input_array_A_ = reinterpret_cast<std::vector<double>*>(task_data->inputs[0])[0];
+  dimension_ = task_data->inputs_count[0];
+  return true;
+}
+
+bool deryabin_m_hoare_sort_simple_merge_stl::HoareSampleSortTaskSTL::ValidationImpl() {
+  // The buckets follow the thread count, so unlike the chunked tasks no chunk count is needed
+  return task_data->inputs_count[0] > 2 && task_data->inputs_count[0] == task_data->outputs_count[0];
+}
+
+bool deryabin_m_hoare_sort_simple_merge_stl::HoareSampleSortTaskSTL::RunImpl() {
+  const size_t num_threads =
+      std::min(static_cast<unsigned int>(ppc::util::GetPPCNumThreads()), std::thread::hardware_concurrency());
+  if (ppc::sort::SortIfPresorted(std::span<double>(input_array_A_), num_threads)) {
+    return true;
+  }
+  SampleSort(input_array_A_, std::max<size_t>(num_threads, 1));
+  return true;
+}
+
+bool deryabin_m_hoare_sort_simple_merge_stl::HoareSampleSortTaskSTL::PostProcessingImpl() {
+  reinterpret_cast<std::vector<double>*>(task_data->outputs[0])[0] = input_array_A_;
+  return true;
+}
@@ -10,6 +10,7 @@
 #include <vector>
 
 #include "core/perf/include/perf.hpp"
+#include "core/perf/include/sort_bench.hpp"
 #include "core/task/include/task.hpp"
 #include "stl/ermilova_d_shell_sort_batcher_even_odd_merger/include/ops_stl.hpp"
 
@@ -93,4 +94,15 @@ TEST(ermilova_d_shell_sort_batcher_even_odd_merger_stl, test_task_run) {
   perf_analyzer->TaskRun(perf_attr, perf_results);
   ppc::core::Perf::PrintPerfStatistic(perf_results);
   ASSERT_TRUE(std::ranges::is_sorted(out));
-}
\ No newline at end of file
+}
+
+TEST(ermilova_d_shell_sort_batcher_even_odd_merger_stl, test_sort_bench_suite) {
+  // The unsorted gap sequence makes this Shell sort close to quadratic; larger sizes take minutes
+  auto results = ppc::core::RunSortBenchSuite(
+      "stl/ermilova_d_shell_sort_batcher_even_odd_merger",
+      ppc::core::MakeSortTaskFactory<ermilova_d_shell_sort_batcher_even_odd_merger_stl::StlTask, int>(),
+      ppc::core::SortBenchSizes(10000));
+  for (const auto &result : results) {
+    EXPECT_TRUE(result.sorted);
+  }
+}
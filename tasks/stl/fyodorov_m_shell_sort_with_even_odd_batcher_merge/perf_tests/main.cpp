@@ -8,6 +8,7 @@
 #include <vector>
 
 #include "core/perf/include/perf.hpp"
+#include "core/perf/include/sort_bench.hpp"
 #include "core/task/include/task.hpp"
 #include "stl/fyodorov_m_shell_sort_with_even_odd_batcher_merge/include/ops_stl.hpp"
 
@@ -103,4 +104,13 @@ TEST(fyodorov_m_shell_sort_with_even_odd_batcher_merge_stl, test_task_run) {
   std::vector<int> expected_output = input;
   std::ranges::sort(expected_output);
   ASSERT_EQ(output, expected_output);
-}
\ No newline at end of file
+}
+
+TEST(fyodorov_m_shell_sort_with_even_odd_batcher_merge_stl, test_sort_bench_suite) {
+  auto results = ppc::core::RunSortBenchSuite(
+      "stl/fyodorov_m_shell_sort_with_even_odd_batcher_merge",
+      ppc::core::MakeSortTaskFactory<fyodorov_m_shell_sort_with_even_odd_batcher_merge_stl::TestTaskSTL, int>());
+  for (const auto &result : results) {
+    EXPECT_TRUE(result.sorted);
+  }
+}
@@ -9,6 +9,8 @@
 #include <utility>
 #include <vector>
 
+#include "core/matmul/include/gemm.hpp"
+
 bool gnitienko_k_strassen_algorithm_stl::StrassenAlgSTL::PreProcessingImpl() {
   size_t input_size = task_data->inputs_count[0];
   auto* in_ptr = reinterpret_cast<double*>(task_data->inputs[0]);
@@ -21,6 +23,7 @@ bool gnitienko_k_strassen_algorithm_stl::StrassenAlgSTL::PreProcessingImpl() {
   output_ = std::vector<double>(output_size, 0.0);
 
   size_ = static_cast<int>(std::sqrt(input_size));
+  TRIVIAL_MULTIPLICATION_BOUND_ = static_cast<int>(ppc::matmul::StrassenCutoff());
 
   if ((input_size <= 0) || (input_size & (input_size - 1)) != 0) {
     int new_size = static_cast<int>(std::pow(2, std::ceil(std::log2(size_))));
@@ -67,14 +70,7 @@ void gnitienko_k_strassen_algorithm_stl::StrassenAlgSTL::SubMatrix(const std::ve
 void gnitienko_k_strassen_algorithm_stl::StrassenAlgSTL::TrivialMultiply(const std::vector<double>& a,
                                                                          const std::vector<double>& b,
                                                                          std::vector<double>& c, int size) {
-  for (int i = 0; i < size; ++i) {
-    for (int j = 0; j < size; ++j) {
-      c[(i * size) + j] = 0;
-      for (int k = 0; k < size; ++k) {
-        c[(i * size) + j] += a[(i * size) + k] * b[(k * size) + j];
-      }
-    }
-  }
+  ppc::matmul::Gemm(size, size, size, a.data(), size, b.data(), size, c.data(), size);
 }
 
 void gnitienko_k_strassen_algorithm_stl::ParallelizeTasks(const std::vector<std::function<void(int)>>& tasks,
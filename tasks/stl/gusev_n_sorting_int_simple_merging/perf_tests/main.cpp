@@ -8,6 +8,7 @@
 #include <vector>
 
 #include "core/perf/include/perf.hpp"
+#include "core/perf/include/sort_bench.hpp"
 #include "core/task/include/task.hpp"
 #include "stl/gusev_n_sorting_int_simple_merging/include/ops_stl.hpp"
 
@@ -78,3 +79,12 @@ TEST(gusev_n_sorting_int_simple_merging_stl, test_task_run) {
   std::ranges::sort(expected);
   EXPECT_EQ(expected, out);
 }
+
+TEST(gusev_n_sorting_int_simple_merging_stl, test_sort_bench_suite) {
+  auto results = ppc::core::RunSortBenchSuite(
+      "stl/gusev_n_sorting_int_simple_merging",
+      ppc::core::MakeSortTaskFactory<gusev_n_sorting_int_simple_merging_stl::TestTaskSTL, int>());
+  for (const auto& result : results) {
+    EXPECT_TRUE(result.sorted);
+  }
+}
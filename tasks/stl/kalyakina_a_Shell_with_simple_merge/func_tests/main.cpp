@@ -152,3 +152,41 @@ TEST(kalyakina_a_shell_with_simple_merge_stl, random_vector_10000) {
   std::vector<int> in = CreateRandomVector(10000, -7000, 7000);
   TestOfFunction(in);
 }
+
+TEST(kalyakina_a_shell_with_simple_merge_stl, chains_task_random_vector_10000) {
+  std::vector<int> in = CreateRandomVector(10000, -500, 500);
+  std::vector<int> out(in.size());
+
+  std::shared_ptr<ppc::core::TaskData> task_data_stl = std::make_shared<ppc::core::TaskData>();
+  task_data_stl->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  task_data_stl->inputs_count.emplace_back(in.size());
+  task_data_stl->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  task_data_stl->outputs_count.emplace_back(out.size());
+
+  kalyakina_a_shell_with_simple_merge_stl::ShellSortChainsSTL task_stl(task_data_stl);
+  ASSERT_EQ(task_stl.Validation(), true);
+  task_stl.PreProcessing();
+  task_stl.Run();
+  task_stl.PostProcessing();
+
+  std::ranges::sort(in);
+  ASSERT_EQ(in, out);
+}
+
+TEST(kalyakina_a_shell_with_simple_merge_stl, chains_parallel_random_vector_200000) {
+  std::vector<int> data = CreateRandomVector(200000, -100000, 100000);
+  std::vector<int> expected = data;
+  std::ranges::sort(expected);
+
+  kalyakina_a_shell_with_simple_merge_stl::ShellSortByChains(data, 6);
+  ASSERT_EQ(expected, data);
+}
+
+TEST(kalyakina_a_shell_with_simple_merge_stl, chains_parallel_reverse_sorted_vector_100000) {
+  std::vector<int> data = CreateReverseSortedVector(100000, -50000);
+  std::vector<int> expected = data;
+  std::ranges::sort(expected);
+
+  kalyakina_a_shell_with_simple_merge_stl::ShellSortByChains(data, 4);
+  ASSERT_EQ(expected, data);
+}
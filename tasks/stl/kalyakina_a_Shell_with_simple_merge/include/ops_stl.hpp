@@ -7,6 +7,10 @@
 
 namespace kalyakina_a_shell_with_simple_merge_stl {
 
+// Shell sort of the whole array with Sedgewick gaps. For large gaps the gap interleaved chains are independent
+// and are split between num_threads threads; small gaps run as one row-by-row insertion pass.
+void ShellSortByChains(std::vector<int> &data, unsigned int num_threads);
+
 class ShellSortSTL : public ppc::core::Task {
   static std::vector<unsigned int> CalculationOfGapLengths(unsigned int size);
   void ShellSort(unsigned int left, unsigned int right);
@@ -25,4 +29,16 @@ class ShellSortSTL : public ppc::core::Task {
   std::vector<unsigned int> Sedgwick_sequence_;
 };
 
+class ShellSortChainsSTL : public ppc::core::Task {
+ public:
+  explicit ShellSortChainsSTL(ppc::core::TaskDataPtr task_data) : Task(std::move(task_data)) {}
+  bool PreProcessingImpl() override;
+  bool ValidationImpl() override;
+  bool RunImpl() override;
+  bool PostProcessingImpl() override;
+
+ private:
+  std::vector<int> output_;
+};
+
 }  // namespace kalyakina_a_shell_with_simple_merge_stl
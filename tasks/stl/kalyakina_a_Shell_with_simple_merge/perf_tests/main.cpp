@@ -7,6 +7,7 @@
 #include <vector>
 
 #include "core/perf/include/perf.hpp"
+#include "core/perf/include/sort_bench.hpp"
 #include "core/task/include/task.hpp"
 #include "stl/kalyakina_a_Shell_with_simple_merge/include/ops_stl.hpp"
 
@@ -90,3 +91,21 @@ TEST(kalyakina_a_Shell_with_simple_merge_stl, test_task_run) {
   ppc::core::Perf::PrintPerfStatistic(perf_results);
   ASSERT_TRUE(std::ranges::is_sorted(out.begin(), out.end()));
 }
+
+TEST(kalyakina_a_Shell_with_simple_merge_stl, test_sort_bench_suite) {
+  auto results = ppc::core::RunSortBenchSuite(
+      "stl/kalyakina_a_Shell_with_simple_merge",
+      ppc::core::MakeSortTaskFactory<kalyakina_a_shell_with_simple_merge_stl::ShellSortSTL, int>());
+  for (const auto &result : results) {
+    EXPECT_TRUE(result.sorted);
+  }
+}
+
+TEST(kalyakina_a_Shell_with_simple_merge_stl, test_sort_bench_suite_chains) {
+  auto results = ppc::core::RunSortBenchSuite(
+      "stl/kalyakina_a_Shell_with_simple_merge/chains",
+      ppc::core::MakeSortTaskFactory<kalyakina_a_shell_with_simple_merge_stl::ShellSortChainsSTL, int>());
+  for (const auto &result : results) {
+    EXPECT_TRUE(result.sorted);
+  }
+}
@@ -1,28 +1,85 @@
 #include "stl/kalyakina_a_Shell_with_simple_merge/include/ops_stl.hpp"
 
 #include <algorithm>
+#include <array>
 #include <cmath>
+#include <cstddef>
+#include <functional>
 #include <thread>
 #include <utility>
 #include <vector>
 
 #include "core/util/include/util.hpp"
 
-std::vector<unsigned int> kalyakina_a_shell_with_simple_merge_stl::ShellSortSTL::CalculationOfGapLengths(
-    unsigned int size) {
+namespace {
+
+constexpr std::size_t kMaxGapCount = 32;
+// Chains per thread at least: a thread's share of one row then covers a whole cache line of ints
+constexpr std::size_t kMinChainsPerThread = 16;
+
+// Sedgewick (1986): 9*2^i - 9*2^(i/2) + 1 for even i, 8*2^i - 6*2^((i+1)/2) + 1 for odd i
+constexpr std::array<unsigned long long, kMaxGapCount> MakeSedgewickGaps() {
+  std::array<unsigned long long, kMaxGapCount> gaps{};
+  gaps[0] = 1;
+  for (std::size_t i = 1; i < kMaxGapCount; i++) {
+    gaps[i] = (i % 2 != 0) ? (8ULL << i) - (6ULL << ((i + 1) / 2)) + 1 : (9ULL << i) - (9ULL << (i / 2)) + 1;
+  }
+  return gaps;
+}
+
+constexpr std::array<unsigned long long, kMaxGapCount> kSedgewickGaps = MakeSedgewickGaps();
+
+std::vector<unsigned int> GapsForSize(std::size_t size) {
   std::vector<unsigned int> result;
-  unsigned int local_res = 1;
-  for (unsigned int i = 1; (local_res * 3 <= size) || (local_res == 1); i++) {
-    result.push_back(local_res);
-    if (i % 2 != 0) {
-      local_res = static_cast<unsigned int>((8 * pow(2, i)) - (6 * pow(2, static_cast<float>(i + 1) / 2)) + 1);
-    } else {
-      local_res = static_cast<unsigned int>((9 * pow(2, i)) - (9 * pow(2, static_cast<float>(i) / 2)) + 1);
-    }
+  for (std::size_t i = 0; i < kMaxGapCount && (i == 0 || kSedgewickGaps[i] * 3 <= size); i++) {
+    result.push_back(static_cast<unsigned int>(kSedgewickGaps[i]));
   }
   return result;
 }
 
+// Gap-insertion over the chains [first_chain, last_chain), walked row by row so that neighbouring chains touch
+// neighbouring memory. Elements of a chain are only ever moved inside that chain.
+void InsertionSortChains(std::vector<int> &data, std::size_t gap, std::size_t first_chain, std::size_t last_chain) {
+  const std::size_t size = data.size();
+  for (std::size_t row = gap; row < size; row += gap) {
+    const std::size_t row_end = std::min(size, row + last_chain);
+    for (std::size_t j = row + first_chain; j < row_end; j++) {
+      const int tmp = data[j];
+      std::size_t index = j;
+      while ((index >= gap) && (tmp < data[index - gap])) {
+        data[index] = data[index - gap];
+        index -= gap;
+      }
+      data[index] = tmp;
+    }
+  }
+}
+
+}  // namespace
+
+void kalyakina_a_shell_with_simple_merge_stl::ShellSortByChains(std::vector<int> &data, unsigned int num_threads) {
+  const std::vector<unsigned int> gaps = GapsForSize(data.size());
+  for (std::size_t k = gaps.size(); k > 0;) {
+    const std::size_t gap = gaps[--k];
+    const std::size_t threads = std::min<std::size_t>(num_threads, gap / kMinChainsPerThread);
+    if (threads < 2) {
+      InsertionSortChains(data, gap, 0, gap);
+      continue;
+    }
+    std::vector<std::thread> workers;
+    workers.reserve(threads);
+    for (std::size_t t = 0; t < threads; t++) {
+      workers.emplace_back(InsertionSortChains, std::ref(data), gap, gap * t / threads, gap * (t + 1) / threads);
+    }
+    std::ranges::for_each(workers, [](auto &thread) { thread.join(); });
+  }
+}
+
+std::vector<unsigned int> kalyakina_a_shell_with_simple_merge_stl::ShellSortSTL::CalculationOfGapLengths(
+    unsigned int size) {
+  return GapsForSize(size);
+}
+
 void kalyakina_a_shell_with_simple_merge_stl::ShellSortSTL::ShellSort(unsigned int left, unsigned int right) {
   for (unsigned int k = Sedgwick_sequence_.size(); k > 0;) {
     unsigned int gap = Sedgwick_sequence_[--k];
@@ -127,3 +184,27 @@ bool kalyakina_a_shell_with_simple_merge_stl::ShellSortSTL::PostProcessingImpl()
 
   return true;
 }
+
+bool kalyakina_a_shell_with_simple_merge_stl::ShellSortChainsSTL::PreProcessingImpl() {
+  auto *in_ptr = reinterpret_cast<int *>(task_data->inputs[0]);
+  output_ = std::vector<int>(in_ptr, in_ptr + task_data->inputs_count[0]);
+
+  return true;
+}
+
+bool kalyakina_a_shell_with_simple_merge_stl::ShellSortChainsSTL::ValidationImpl() {
+  return (task_data->inputs_count[0] > 0) && (task_data->outputs_count[0] > 0) &&
+         (task_data->inputs_count[0] == task_data->outputs_count[0]);
+}
+
+bool kalyakina_a_shell_with_simple_merge_stl::ShellSortChainsSTL::RunImpl() {
+  ShellSortByChains(output_, static_cast<unsigned int>(ppc::util::GetPPCNumThreads()));
+
+  return true;
+}
+
+bool kalyakina_a_shell_with_simple_merge_stl::ShellSortChainsSTL::PostProcessingImpl() {
+  std::ranges::copy(output_, reinterpret_cast<int *>(task_data->outputs[0]));
+
+  return true;
+}
@@ -7,6 +7,7 @@
 #include <vector>
 
 #include "core/perf/include/perf.hpp"
+#include "core/perf/include/sort_bench.hpp"
 #include "core/task/include/task.hpp"
 #include "stl/khovansky_d_double_radix_batcher/include/ops_stl.hpp"
 
@@ -96,4 +97,13 @@ TEST(khovansky_d_double_radix_batcher_stl, test_task_run) {
   perf_analyzer->TaskRun(perf_attr, perf_results);
   ppc::core::Perf::PrintPerfStatistic(perf_results);
   ASSERT_EQ(exp_out, out);
-}
\ No newline at end of file
+}
+
+TEST(khovansky_d_double_radix_batcher_stl, test_sort_bench_suite) {
+  auto results = ppc::core::RunSortBenchSuite(
+      "stl/khovansky_d_double_radix_batcher",
+      ppc::core::MakeSortTaskFactory<khovansky_d_double_radix_batcher_stl::RadixSTL, double>());
+  for (const auto& result : results) {
+    EXPECT_TRUE(result.sorted);
+  }
+}
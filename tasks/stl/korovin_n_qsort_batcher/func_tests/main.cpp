@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <climits>
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <random>
@@ -45,6 +46,27 @@ void RunTest(std::vector<int> &in) {
   ASSERT_TRUE(test_task_stl.PostProcessing());
   ASSERT_TRUE(std::ranges::is_sorted(out));
 }
+
+void RunTopKTest(std::vector<int> &in, size_t k) {
+  std::vector<int> out(k);
+
+  auto task_data_stl = std::make_shared<ppc::core::TaskData>();
+  task_data_stl->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  task_data_stl->inputs_count.emplace_back(in.size());
+  task_data_stl->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  task_data_stl->outputs_count.emplace_back(out.size());
+
+  korovin_n_qsort_batcher_stl::TopKTaskSTL test_task_stl(task_data_stl);
+  ASSERT_TRUE(test_task_stl.Validation());
+  ASSERT_TRUE(test_task_stl.PreProcessing());
+  ASSERT_TRUE(test_task_stl.Run());
+  ASSERT_TRUE(test_task_stl.PostProcessing());
+
+  std::vector<int> expected = in;
+  std::ranges::sort(expected);
+  expected.resize(k);
+  ASSERT_EQ(out, expected);
+}
 }  // namespace
 
 TEST(korovin_n_qsort_batcher_stl, test_unsort) {
@@ -122,4 +144,36 @@ TEST(korovin_n_qsort_batcher_stl, test_random_sort_1000) {
 
   std::vector<int> in = GenerateRndVector(param);
   RunTest(in);
-}
\ No newline at end of file
+}
+
+TEST(korovin_n_qsort_batcher_stl, test_top_k_random_100000) {
+  auto param = GenParams();
+  param.size = 100000;
+
+  std::vector<int> in = GenerateRndVector(param);
+  RunTopKTest(in, 1000);
+}
+
+TEST(korovin_n_qsort_batcher_stl, test_top_k_whole_array) {
+  std::vector<int> in = {25, 87, 25, 87, 1, 25, 87, 0, -5};
+  RunTopKTest(in, in.size());
+}
+
+TEST(korovin_n_qsort_batcher_stl, test_top_k_zero) {
+  std::vector<int> in = {3, 2, 1};
+  RunTopKTest(in, 0);
+}
+
+TEST(korovin_n_qsort_batcher_stl, test_top_k_larger_than_input_fails_validation) {
+  std::vector<int> in = {3, 2, 1};
+  std::vector<int> out(4);
+
+  auto task_data_stl = std::make_shared<ppc::core::TaskData>();
+  task_data_stl->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  task_data_stl->inputs_count.emplace_back(in.size());
+  task_data_stl->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  task_data_stl->outputs_count.emplace_back(out.size());
+
+  korovin_n_qsort_batcher_stl::TopKTaskSTL test_task_stl(task_data_stl);
+  ASSERT_FALSE(test_task_stl.Validation());
+}
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <utility>
 #include <vector>
 
@@ -30,4 +31,19 @@ class TestTaskSTL : public ppc::core::Task {
   static void OddEvenMerge(std::vector<BlockRange>& blocks);
 };
 
+// Same input as TestTaskSTL; outputs_count[0] = k receives the k smallest elements in ascending order
+class TopKTaskSTL : public ppc::core::Task {
+ public:
+  explicit TopKTaskSTL(ppc::core::TaskDataPtr task_data) : Task(std::move(task_data)) {}
+
+  bool PreProcessingImpl() override;
+  bool ValidationImpl() override;
+  bool RunImpl() override;
+  bool PostProcessingImpl() override;
+
+ private:
+  std::vector<int> input_;
+  size_t k_{};
+};
+
 }  // namespace korovin_n_qsort_batcher_stl
@@ -8,6 +8,7 @@
 #include <vector>
 
 #include "core/perf/include/perf.hpp"
+#include "core/perf/include/sort_bench.hpp"
 #include "core/task/include/task.hpp"
 #include "stl/korovin_n_qsort_batcher/include/ops_stl.hpp"
 
@@ -84,3 +85,11 @@ TEST(korovin_n_qsort_batcher_stl, test_task_run) {
   ppc::core::Perf::PrintPerfStatistic(perf_results);
   ASSERT_TRUE(std::ranges::is_sorted(out.begin(), out.end()));
 }
+
+TEST(korovin_n_qsort_batcher_stl, test_sort_bench_suite) {
+  auto results = ppc::core::RunSortBenchSuite(
+      "stl/korovin_n_qsort_batcher", ppc::core::MakeSortTaskFactory<korovin_n_qsort_batcher_stl::TestTaskSTL, int>());
+  for (const auto &result : results) {
+    EXPECT_TRUE(result.sorted);
+  }
+}
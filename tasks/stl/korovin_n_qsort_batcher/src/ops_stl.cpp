@@ -11,6 +11,7 @@
 #include <thread>
 #include <vector>
 
+#include "core/sort/include/select.hpp"
 #include "core/util/include/util.hpp"
 
 namespace korovin_n_qsort_batcher_stl {
@@ -151,4 +152,30 @@ bool TestTaskSTL::PostProcessingImpl() {
   return true;
 }
 
+bool TopKTaskSTL::PreProcessingImpl() {
+  unsigned int input_size = task_data->inputs_count[0];
+  auto* in_ptr = reinterpret_cast<int*>(task_data->inputs[0]);
+  input_.assign(in_ptr, in_ptr + input_size);
+  k_ = task_data->outputs_count[0];
+  return true;
+}
+
+bool TopKTaskSTL::ValidationImpl() {
+  return (!task_data->inputs.empty()) && (!task_data->outputs.empty()) &&
+         (task_data->outputs_count[0] <= task_data->inputs_count[0]);
+}
+
+bool TopKTaskSTL::RunImpl() {
+  // Introselect around the k-th element, then only the first k are sorted: O(n + k log k)
+  auto num_threads = static_cast<size_t>(ppc::util::GetPPCNumThreads());
+  ppc::sort::PartialSort(std::span<int>(input_), k_, num_threads);
+  return true;
+}
+
+bool TopKTaskSTL::PostProcessingImpl() {
+  std::copy(input_.begin(), input_.begin() + static_cast<std::ptrdiff_t>(k_),
+            reinterpret_cast<int*>(task_data->outputs[0]));
+  return true;
+}
+
 }  // namespace korovin_n_qsort_batcher_stl
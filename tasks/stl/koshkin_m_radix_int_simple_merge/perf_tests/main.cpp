@@ -10,6 +10,7 @@
 
 #include "../include/ops_stl.hpp"
 #include "core/perf/include/perf.hpp"
+#include "core/perf/include/sort_bench.hpp"
 #include "core/task/include/task.hpp"
 
 namespace {
@@ -61,3 +62,12 @@ void PerformPerfTest(bool test_task_run) {
 
 TEST(koshkin_m_radix_int_simple_merge_stl, test_pipeline_run) { PerformPerfTest(false); }
 TEST(koshkin_m_radix_int_simple_merge_stl, test_task_run) { PerformPerfTest(true); }
+
+TEST(koshkin_m_radix_int_simple_merge_stl, test_sort_bench_suite) {
+  auto results = ppc::core::RunSortBenchSuite(
+      "stl/koshkin_m_radix_int_simple_merge",
+      ppc::core::MakeSortTaskFactory<koshkin_m_radix_int_simple_merge::StlT, int>());
+  for (const auto &result : results) {
+    EXPECT_TRUE(result.sorted);
+  }
+}
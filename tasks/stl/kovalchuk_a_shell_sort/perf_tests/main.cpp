@@ -7,6 +7,7 @@
 #include <vector>
 
 #include "core/perf/include/perf.hpp"
+#include "core/perf/include/sort_bench.hpp"
 #include "core/task/include/task.hpp"
 #include "stl/kovalchuk_a_shell_sort/include/ops_stl.hpp"
 
@@ -75,3 +76,11 @@ TEST(kovalchuk_a_shell_sort_tbb, test_task_run) {
 
   ASSERT_TRUE(std::ranges::is_sorted(out));
 }
+
+TEST(kovalchuk_a_shell_sort_tbb, test_sort_bench_suite) {
+  auto results = ppc::core::RunSortBenchSuite(
+      "stl/kovalchuk_a_shell_sort", ppc::core::MakeSortTaskFactory<kovalchuk_a_shell_sort_stl::ShellSortSTL, int>());
+  for (const auto& result : results) {
+    EXPECT_TRUE(result.sorted);
+  }
+}
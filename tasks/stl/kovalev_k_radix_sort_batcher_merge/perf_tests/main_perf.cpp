@@ -11,6 +11,7 @@
 #include <vector>
 
 #include "core/perf/include/perf.hpp"
+#include "core/perf/include/sort_bench.hpp"
 #include "core/task/include/task.hpp"
 #include "stl/kovalev_k_radix_sort_batcher_merge/include/header.hpp"
 
@@ -91,3 +92,12 @@ TEST(kovalev_k_radix_sort_batcher_merge_stl, test_task_run) {
   }
   ASSERT_EQ(count_viol, 0);
 }
+
+TEST(kovalev_k_radix_sort_batcher_merge_stl, test_sort_bench_suite) {
+  auto results = ppc::core::RunSortBenchSuite(
+      "stl/kovalev_k_radix_sort_batcher_merge",
+      ppc::core::MakeSortTaskFactory<kovalev_k_radix_sort_batcher_merge_stl::TestTaskSTD, long long int>());
+  for (const auto &result : results) {
+    EXPECT_TRUE(result.sorted);
+  }
+}
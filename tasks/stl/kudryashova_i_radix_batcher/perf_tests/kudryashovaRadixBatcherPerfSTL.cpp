@@ -8,6 +8,7 @@
 #include <vector>
 
 #include "core/perf/include/perf.hpp"
+#include "core/perf/include/sort_bench.hpp"
 #include "core/task/include/task.hpp"
 #include "stl/kudryashova_i_radix_batcher/include/kudryashovaRadixBatcherSTL.hpp"
 
@@ -75,3 +76,12 @@ TEST(kudryashova_i_radix_batcher_stl, test_task_run) {
     ASSERT_LE(result[i - 1], result[i]);
   }
 }
+
+TEST(kudryashova_i_radix_batcher_stl, test_sort_bench_suite) {
+  auto results = ppc::core::RunSortBenchSuite(
+      "stl/kudryashova_i_radix_batcher",
+      ppc::core::MakeSortTaskFactory<kudryashova_i_radix_batcher_stl::TestTaskSTL, double>());
+  for (const auto &result : results) {
+    EXPECT_TRUE(result.sorted);
+  }
+}
@@ -9,6 +9,8 @@
 #include <utility>
 #include <vector>
 
+#include "core/sparse/include/compressed.hpp"
+#include "core/sparse/include/task_data.hpp"
 #include "core/task/include/task.hpp"
 #include "stl/lavrentiev_A_CCS/include/ops_stl.hpp"
 
@@ -161,3 +163,37 @@ TEST(lavrentiev_a_ccs_stl, test_25x25_matrix) {
     EXPECT_NEAR(task.result[i], task.random_data[i], kEpsilon);
   }
 }
+
+TEST(lavrentiev_a_ccs_stl, test_sparse_layout_40x30_30x20) {
+  const int m = 40;
+  const int k = 30;
+  const int n = 20;
+  auto a_dense = GenerateRandomMatrix(m * k, 4);
+  auto b_dense = GenerateRandomMatrix(k * n, 3);
+  const auto a = ppc::sparse::CcsMatrix<double>::FromDense(a_dense.data(), m, k);
+  const auto b = ppc::sparse::CcsMatrix<double>::FromDense(b_dense.data(), k, n);
+  ppc::sparse::CcsMatrix<double> c;
+  auto task_data_stl = std::make_shared<ppc::core::TaskData>();
+  ppc::sparse::AddSparseInput(*task_data_stl, a);
+  ppc::sparse::AddSparseInput(*task_data_stl, b);
+  ppc::sparse::AddSparseOutput(*task_data_stl, c);
+
+  lavrentiev_a_ccs_stl::CCSSTL test_task_stl(task_data_stl);
+  ASSERT_EQ(test_task_stl.Validation(), true);
+  test_task_stl.PreProcessing();
+  test_task_stl.Run();
+  test_task_stl.PostProcessing();
+  ASSERT_EQ(c.shape.rows, m);
+  ASSERT_EQ(c.shape.cols, n);
+  std::vector<double> result(static_cast<size_t>(m) * n);
+  c.ToDense(result.data());
+  for (int i = 0; i < m; ++i) {
+    for (int j = 0; j < n; ++j) {
+      double expected = 0.0;
+      for (int p = 0; p < k; ++p) {
+        expected += a_dense[(i * k) + p] * b_dense[(p * n) + j];
+      }
+      EXPECT_NEAR(result[(i * n) + j], expected, kEpsilon);
+    }
+  }
+}
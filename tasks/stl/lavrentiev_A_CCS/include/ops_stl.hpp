@@ -1,31 +1,25 @@
 #pragma once
 
-#include <cmath>
 #include <utility>
-#include <vector>
 
+#include "core/sparse/include/compressed.hpp"
 #include "core/task/include/task.hpp"
 
 namespace lavrentiev_a_ccs_stl {
-struct Sparse {
-  std::pair<int, int> size;
-  std::vector<std::pair<double, int>> elements_and_rows;
-  std::vector<int> columnsSum;
-};
 
+// C = A * B for CCS matrices. Inputs are either A and B in the standard sparse layout (see
+// core/sparse/include/task_data.hpp) with a CcsMatrix<double> output, or two dense row-major matrices with
+// inputs_count {rows A, cols A, rows B, cols B} and a dense output.
 class CCSSTL : public ppc::core::Task {
  private:
-  [[nodiscard]] bool IsEmpty() const;
-  static Sparse ConvertToSparse(std::pair<int, int> size, const std::vector<double>& values);
-  static Sparse Transpose(const Sparse& sparse);
-  static Sparse MatMul(const Sparse& matrix1, const Sparse& matrix2);
-  static int GetElementsCount(int index, const std::vector<int>& columns_sum);
-  static std::vector<double> ConvertFromSparse(const Sparse& matrix);
-  static int CalculateStartIndex(int index, const std::vector<int>& columns_sum);
+  [[nodiscard]] bool IsSparseLayout() const;
 
-  Sparse A_;
-  Sparse B_;
-  Sparse Answer_;
+  // Operands compressed from dense inputs; sparse inputs are read in place
+  ppc::sparse::CcsMatrix<double> dense_a_;
+  ppc::sparse::CcsMatrix<double> dense_b_;
+  ppc::sparse::CompressedView<double> A_;
+  ppc::sparse::CompressedView<double> B_;
+  ppc::sparse::CcsMatrix<double> Answer_;
 
  public:
   explicit CCSSTL(ppc::core::TaskDataPtr task_data) : Task(std::move(task_data)) {}
@@ -35,4 +29,4 @@ class CCSSTL : public ppc::core::Task {
   bool PostProcessingImpl() override;
 };
 
-}  // namespace lavrentiev_a_ccs_stl
\ No newline at end of file
+}  // namespace lavrentiev_a_ccs_stl
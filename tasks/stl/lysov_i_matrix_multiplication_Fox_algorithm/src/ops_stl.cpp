@@ -8,6 +8,8 @@
 #include <thread>
 #include <vector>
 
+#include "core/matmul/include/autotune.hpp"
+
 void lysov_i_matrix_multiplication_fox_algorithm_stl::ProcessBlock(const std::vector<double> &a,
                                                                    const std::vector<double> &b, std::vector<double> &c,
                                                                    std::size_t i, std::size_t j,
@@ -21,27 +23,25 @@ void lysov_i_matrix_multiplication_fox_algorithm_stl::ProcessBlock(const std::ve
   const double *a_ptr = &a[((i * block_size) * n) + (a_block_row * block_size)];
   const double *b_ptr = &b[((a_block_row * block_size) * n) + (j * block_size)];
 
+  // i-k-j order streams rows of B and C, the access pattern the tuned block size is measured with
   for (std::size_t ii = 0; ii < block_h; ++ii) {
-    for (std::size_t jj = 0; jj < block_w; ++jj) {
-      double sum = 0.0;
-      const double *a_row = a_ptr + (ii * n);
-      const double *b_col = b_ptr + (jj);
-
-      for (std::size_t kk = 0; kk + 1 < block_k; kk += 2) {
-        sum += a_row[kk] * b_col[kk * n] + a_row[kk + 1] * b_col[(kk + 1) * n];
-      }
-      if (block_k % 2 != 0) {
-        sum += a_row[block_k - 1] * b_col[(block_k - 1) * n];
+    const double *a_row = a_ptr + (ii * n);
+    double *c_row = c_ptr + (ii * n);
+    for (std::size_t kk = 0; kk < block_k; ++kk) {
+      const double a_val = a_row[kk];
+      const double *b_row = b_ptr + (kk * n);
+      for (std::size_t jj = 0; jj < block_w; ++jj) {
+        c_row[jj] += a_val * b_row[jj];
       }
-
-      c_ptr[(ii * n) + jj] += sum;
     }
   }
 }
 // Init value
 bool lysov_i_matrix_multiplication_fox_algorithm_stl::TestTaskSTL::PreProcessingImpl() {
   n_ = reinterpret_cast<std::size_t *>(task_data->inputs[0])[0];
-  block_size_ = reinterpret_cast<std::size_t *>(task_data->inputs[3])[0];
+  // The block size passed in is only validated: blocks are sized for this CPU's L2 cache instead, but small enough
+  // that every thread gets a block row
+  block_size_ = ppc::matmul::ParallelBlock(ppc::matmul::TunedBlockSizes().l2, n_, ppc::util::GetPPCNumThreads());
   a_.resize(n_ * n_);
   b_.resize(n_ * n_);
   c_.clear();
@@ -8,6 +8,7 @@
 #include <vector>
 
 #include "core/perf/include/perf.hpp"
+#include "core/perf/include/sort_bench.hpp"
 #include "core/task/include/task.hpp"
 #include "stl/malyshev_v_radix_sort/include/ops_stl.hpp"
 
@@ -74,4 +75,12 @@ TEST(malyshev_v_radix_sort_all, test_task_run) {
   for (std::vector<double>::size_type i = 1; i < result.size(); i++) {
     ASSERT_LE(result[i - 1], result[i]);
   }
-}
\ No newline at end of file
+}
+
+TEST(malyshev_v_radix_sort_all, test_sort_bench_suite) {
+  auto results = ppc::core::RunSortBenchSuite(
+      "stl/malyshev_v_radix_sort", ppc::core::MakeSortTaskFactory<malyshev_v_radix_sort_stl::TestTaskSTL, double>());
+  for (const auto& result : results) {
+    EXPECT_TRUE(result.sorted);
+  }
+}
@@ -9,6 +9,7 @@
 #include <vector>
 
 #include "core/perf/include/perf.hpp"
+#include "core/perf/include/sort_bench.hpp"
 #include "core/task/include/task.hpp"
 #include "stl/mezhuev_m_bitwise_integer_sort_with_simple_merge/include/ops_stl.hpp"
 
@@ -89,4 +90,13 @@ TEST(mezhuev_m_bitwise_integer_sort_stl, test_task_run) {
   std::vector<int> expected = in;
   std::ranges::sort(expected);
   ASSERT_EQ(expected, out);
-}
\ No newline at end of file
+}
+
+TEST(mezhuev_m_bitwise_integer_sort_stl, test_sort_bench_suite) {
+  auto results = ppc::core::RunSortBenchSuite(
+      "stl/mezhuev_m_bitwise_integer_sort_with_simple_merge",
+      ppc::core::MakeSortTaskFactory<mezhuev_m_bitwise_integer_sort_stl::SortSTL, int>());
+  for (const auto& result : results) {
+    EXPECT_TRUE(result.sorted);
+  }
+}
@@ -7,6 +7,7 @@
 #include <thread>
 #include <vector>
 
+#include "core/matmul/include/gemm.hpp"
 #include "core/util/include/util.hpp"
 
 namespace nasedkin_e_strassen_algorithm_stl {
@@ -119,8 +120,8 @@ std::vector<double> StrassenStl::TrimMatrixToOriginalSize(const std::vector<doub
 
 std::vector<double> StrassenStl::StrassenMultiply(const std::vector<double>& a, const std::vector<double>& b, int size,
                                                   int num_threads) {
-  if (size <= 32) {
-    return StandardMultiply(a, b, size);
+  if (static_cast<size_t>(size) <= ppc::matmul::StrassenCutoff()) {
+    return ppc::matmul::Multiply(a, b, size);
   }
 
   int half_size = size / 2;
@@ -10,6 +10,7 @@
 #include <vector>
 
 #include "core/perf/include/perf.hpp"
+#include "core/perf/include/sort_bench.hpp"
 #include "core/task/include/task.hpp"
 #include "stl/opolin_d_radix_sort_batcher_merge/include/ops_stl.hpp"
 
@@ -104,4 +105,13 @@ TEST(opolin_d_radix_batcher_sort_stl, test_task_run) {
   perf_analyzer->TaskRun(perf_attr, perf_results);
   ppc::core::Perf::PrintPerfStatistic(perf_results);
   ASSERT_EQ(expected, out);
-}
\ No newline at end of file
+}
+
+TEST(opolin_d_radix_batcher_sort_stl, test_sort_bench_suite) {
+  auto results = ppc::core::RunSortBenchSuite(
+      "stl/opolin_d_radix_sort_batcher_merge",
+      ppc::core::MakeSortTaskFactory<opolin_d_radix_batcher_sort_stl::RadixBatcherSortTaskStl, int>());
+  for (const auto &result : results) {
+    EXPECT_TRUE(result.sorted);
+  }
+}
@@ -10,6 +10,7 @@
 
 #include "../include/ops_stl.hpp"
 #include "core/perf/include/perf.hpp"
+#include "core/perf/include/sort_bench.hpp"
 #include "core/task/include/task.hpp"
 
 namespace {
@@ -73,3 +74,12 @@ TEST(petrov_a_radix_double_batcher_stl, test_task_run) {
   ppc::core::Perf::PrintPerfStatistic(perf_results);
   ASSERT_TRUE(std::ranges::is_sorted(out));
 }
+
+TEST(petrov_a_radix_double_batcher_stl, test_sort_bench_suite) {
+  auto results = ppc::core::RunSortBenchSuite(
+      "stl/petrov_a_radix_double_batcher",
+      ppc::core::MakeSortTaskFactory<petrov_a_radix_double_batcher_stl::TestTaskParallelStl, double>());
+  for (const auto &result : results) {
+    EXPECT_TRUE(result.sorted);
+  }
+}
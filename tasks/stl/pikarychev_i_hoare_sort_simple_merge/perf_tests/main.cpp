@@ -13,6 +13,7 @@
 
 #include "../include/ops_stl.hpp"
 #include "core/perf/include/perf.hpp"
+#include "core/perf/include/sort_bench.hpp"
 #include "core/task/include/task.hpp"
 
 namespace {
@@ -91,3 +92,23 @@ TEST(pikarychev_i_hoare_sort_simple_merge_stl, test_task_run) {
 
   EXPECT_TRUE(std::ranges::is_sorted(out, std::greater<>{}));
 }
+
+TEST(pikarychev_i_hoare_sort_simple_merge_stl, test_sort_bench_suite) {
+  // The task sorts in descending order unless reverse is set. The last-element pivot is quadratic on sorted input,
+  // larger sizes take minutes.
+  bool reverse = true;
+  auto results = ppc::core::RunSortBenchSuite<int>(
+      "stl/pikarychev_i_hoare_sort_simple_merge", [&reverse](std::vector<int> &input, std::vector<int> &output) {
+        auto task_data = std::make_shared<ppc::core::TaskData>();
+        task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(input.data()));
+        task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(&reverse));
+        task_data->inputs_count.emplace_back(input.size());
+        task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(output.data()));
+        task_data->outputs_count.emplace_back(output.size());
+        return std::make_shared<pikarychev_i_hoare_sort_simple_merge::HoareSTL<int>>(task_data);
+      },
+      ppc::core::SortBenchSizes(10000));
+  for (const auto &result : results) {
+    EXPECT_TRUE(result.sorted);
+  }
+}
@@ -10,6 +10,7 @@
 #include <vector>
 
 #include "core/perf/include/perf.hpp"
+#include "core/perf/include/sort_bench.hpp"
 #include "core/task/include/task.hpp"
 #include "stl/shlyakov_m_shell_sort/include/ops_stl.hpp"
 
@@ -115,3 +116,11 @@ TEST(shlyakov_m_shell_sort_stl, test_task_run) {
 
   EXPECT_TRUE(IsSorted(out));
 }
+
+TEST(shlyakov_m_shell_sort_stl, test_sort_bench_suite) {
+  auto results = ppc::core::RunSortBenchSuite(
+      "stl/shlyakov_m_shell_sort", ppc::core::MakeSortTaskFactory<shlyakov_m_shell_sort_stl::TestTaskSTL, int>());
+  for (const auto& result : results) {
+    EXPECT_TRUE(result.sorted);
+  }
+}
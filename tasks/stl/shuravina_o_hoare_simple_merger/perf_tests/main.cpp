@@ -7,6 +7,7 @@
 #include <vector>
 
 #include "core/perf/include/perf.hpp"
+#include "core/perf/include/sort_bench.hpp"
 #include "core/task/include/task.hpp"
 
 TEST(shuravina_o_hoare_simple_merger_stl, test_pipeline_run) {
@@ -79,4 +80,13 @@ TEST(shuravina_o_hoare_simple_merger_stl, test_task_run) {
   for (int i = 0; i < count - 1; i++) {
     ASSERT_LE(out[i], out[i + 1]);
   }
-}
\ No newline at end of file
+}
+
+TEST(shuravina_o_hoare_simple_merger_stl, test_sort_bench_suite) {
+  auto results = ppc::core::RunSortBenchSuite(
+      "stl/shuravina_o_hoare_simple_merger",
+      ppc::core::MakeSortTaskFactory<shuravina_o_hoare_simple_merger::TestTaskSTL, int>());
+  for (const auto& result : results) {
+    EXPECT_TRUE(result.sorted);
+  }
+}
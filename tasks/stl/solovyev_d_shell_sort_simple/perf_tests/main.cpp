@@ -9,6 +9,7 @@
 #include <vector>
 
 #include "core/perf/include/perf.hpp"
+#include "core/perf/include/sort_bench.hpp"
 #include "core/task/include/task.hpp"
 #include "stl/solovyev_d_shell_sort_simple/include/ops_stl.hpp"
 
@@ -107,3 +108,12 @@ TEST(solovyev_d_shell_sort_simple_stl, test_task_run) {
   ppc::core::Perf::PrintPerfStatistic(perf_results);
   ASSERT_TRUE(IsSorted(out));
 }
+
+TEST(solovyev_d_shell_sort_simple_stl, test_sort_bench_suite) {
+  auto results = ppc::core::RunSortBenchSuite(
+      "stl/solovyev_d_shell_sort_simple",
+      ppc::core::MakeSortTaskFactory<solovyev_d_shell_sort_simple_stl::TaskSTL, int>());
+  for (const auto &result : results) {
+    EXPECT_TRUE(result.sorted);
+  }
+}
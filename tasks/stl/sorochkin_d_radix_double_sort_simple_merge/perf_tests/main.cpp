@@ -10,6 +10,7 @@
 
 #include "../include/ops.hpp"
 #include "core/perf/include/perf.hpp"
+#include "core/perf/include/sort_bench.hpp"
 #include "core/task/include/task.hpp"
 
 namespace {
@@ -61,3 +62,12 @@ TEST(sorochkin_d_radix_double_sort_simple_merge_stl, test_task_run) {
     perf_analyzer.TaskRun(perf_attr, perf_results);
   });
 }
+
+TEST(sorochkin_d_radix_double_sort_simple_merge_stl, test_sort_bench_suite) {
+  auto results = ppc::core::RunSortBenchSuite(
+      "stl/sorochkin_d_radix_double_sort_simple_merge",
+      ppc::core::MakeSortTaskFactory<sorochkin_d_radix_double_sort_simple_merge_stl::SortTask, double>());
+  for (const auto &result : results) {
+    EXPECT_TRUE(result.sorted);
+  }
+}
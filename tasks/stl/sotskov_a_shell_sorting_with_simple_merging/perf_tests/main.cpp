@@ -7,6 +7,7 @@
 #include <vector>
 
 #include "core/perf/include/perf.hpp"
+#include "core/perf/include/sort_bench.hpp"
 #include "core/task/include/task.hpp"
 #include "stl/sotskov_a_shell_sorting_with_simple_merging/include/ops_stl.hpp"
 
@@ -115,4 +116,13 @@ TEST(sotskov_a_shell_sorting_with_simple_merging_stl, test_task_run) {
   ppc::core::Perf::PrintPerfStatistic(perf_results);
 
   ASSERT_EQ(out, expected);
-}
\ No newline at end of file
+}
+
+TEST(sotskov_a_shell_sorting_with_simple_merging_stl, test_sort_bench_suite) {
+  auto results = ppc::core::RunSortBenchSuite(
+      "stl/sotskov_a_shell_sorting_with_simple_merging",
+      ppc::core::MakeSortTaskFactory<sotskov_a_shell_sorting_with_simple_merging_stl::TestTaskSTL, int>());
+  for (const auto &result : results) {
+    EXPECT_TRUE(result.sorted);
+  }
+}
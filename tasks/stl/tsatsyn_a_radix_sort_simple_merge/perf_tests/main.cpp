@@ -8,6 +8,7 @@
 #include <vector>
 
 #include "core/perf/include/perf.hpp"
+#include "core/perf/include/sort_bench.hpp"
 #include "core/task/include/task.hpp"
 #include "stl/tsatsyn_a_radix_sort_simple_merge/include/ops_stl.hpp"
 namespace {
@@ -97,3 +98,12 @@ TEST(tsatsyn_a_radix_sort_simple_merge_stl, test_task_run) {
   std::ranges::sort(in);
   ASSERT_EQ(in, out);
 }
+
+TEST(tsatsyn_a_radix_sort_simple_merge_stl, test_sort_bench_suite) {
+  auto results = ppc::core::RunSortBenchSuite(
+      "stl/tsatsyn_a_radix_sort_simple_merge",
+      ppc::core::MakeSortTaskFactory<tsatsyn_a_radix_sort_simple_merge_stl::TestTaskSTL, double>());
+  for (const auto &result : results) {
+    EXPECT_TRUE(result.sorted);
+  }
+}
@@ -11,6 +11,7 @@
 #include <vector>
 
 #include "core/perf/include/perf.hpp"
+#include "core/perf/include/sort_bench.hpp"
 #include "core/task/include/task.hpp"
 #include "stl/tyshkevich_a_hoare_simple_merge/include/ops_stl.hpp"
 
@@ -86,4 +87,16 @@ TEST(tyshkevich_a_hoare_simple_merge_stl, test_task_run) {
   ppc::core::Perf::PrintPerfStatistic(perf_results);
 
   EXPECT_TRUE(std::ranges::is_sorted(out, std::greater<>()));
-}
\ No newline at end of file
+}
+
+TEST(tyshkevich_a_hoare_simple_merge_stl, test_sort_bench_suite) {
+  // The last-element pivot is quadratic on few-unique input; larger sizes take minutes
+  auto results = ppc::core::RunSortBenchSuite(
+      "stl/tyshkevich_a_hoare_simple_merge",
+      ppc::core::MakeSortTaskFactory<tyshkevich_a_hoare_simple_merge_stl::HoareSortTask<int, std::less<>>, int>(
+          std::less<>()),
+      ppc::core::SortBenchSizes(10000));
+  for (const auto &result : results) {
+    EXPECT_TRUE(result.sorted);
+  }
+}
@@ -9,6 +9,7 @@
 #include <vector>
 
 #include "core/perf/include/perf.hpp"
+#include "core/perf/include/sort_bench.hpp"
 #include "core/task/include/task.hpp"
 #include "stl/vershinina_a_hoare_sort/include/ops_stl.hpp"
 
@@ -85,3 +86,14 @@ TEST(vershinina_a_hoare_sort_stl, test_task_run) {
   ppc::core::Perf::PrintPerfStatistic(perf_results);
   ASSERT_TRUE(std::ranges::is_sorted(out));
 }
+
+TEST(vershinina_a_hoare_sort_stl, test_sort_bench_suite) {
+  // The last-element pivot is quadratic on few-unique input; larger sizes take minutes
+  auto results = ppc::core::RunSortBenchSuite(
+      "stl/vershinina_a_hoare_sort",
+      ppc::core::MakeSortTaskFactory<vershinina_a_hoare_sort_stl::TestTaskSTL, double>(),
+      ppc::core::SortBenchSizes(10000));
+  for (const auto& result : results) {
+    EXPECT_TRUE(result.sorted);
+  }
+}
@@ -10,6 +10,7 @@
 #include <vector>
 
 #include "core/perf/include/perf.hpp"
+#include "core/perf/include/sort_bench.hpp"
 #include "core/task/include/task.hpp"
 #include "stl/volochaev_s_Shell_sort_with_Batchers_even-odd_merge/include/ops_stl.hpp"
 
@@ -110,3 +111,12 @@ TEST(volochaev_s_Shell_sort_with_Batchers_even_odd_merge_stl, test_task_run) {
   ppc::core::Perf::PrintPerfStatistic(perf_results);
   ASSERT_EQ(ans, out);
 }
+
+TEST(volochaev_s_Shell_sort_with_Batchers_even_odd_merge_stl, test_sort_bench_suite) {
+  auto results = ppc::core::RunSortBenchSuite(
+      "stl/volochaev_s_Shell_sort_with_Batchers_even-odd_merge",
+      ppc::core::MakeSortTaskFactory<volochaev_s_shell_sort_with_batchers_even_odd_merge_stl::ShellSortSTL, int>());
+  for (const auto &result : results) {
+    EXPECT_TRUE(result.sorted);
+  }
+}
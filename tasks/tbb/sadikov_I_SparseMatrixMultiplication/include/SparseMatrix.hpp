@@ -6,6 +6,8 @@
 #include <utility>
 #include <vector>
 
+#include "core/sparse/include/compressed.hpp"
+
 namespace sadikov_i_sparse_matrix_multiplication_task_tbb {
 class SparseMatrix {
   constexpr static double kMEpsilon = 0.000001;
@@ -23,11 +25,8 @@ class SparseMatrix {
   int m_columnsCount_ = 0;
   MatrixComponents m_compontents_;
 
-  static SparseMatrix Transpose(const SparseMatrix& matrix);
-  static int GetElementsCount(int index, const std::vector<int>& elements_sum);
-  static double CalculateSum(const SparseMatrix& fmatrix, const SparseMatrix& smatrix,
-                             const std::vector<int>& felements_sum, const std::vector<int>& selements_sum, int i_index,
-                             int j_index);
+  // View for the sparse engine; column_ptr receives the column offsets, which start with a 0 unlike m_elementsSum
+  ppc::sparse::CompressedView<double> View(std::vector<int>& column_ptr) const;
 
  public:
   SparseMatrix() = default;